@@ -0,0 +1,159 @@
+#ifndef GATHER_BENCHMARK_H_
+#define GATHER_BENCHMARK_H_
+
+#include <csignal>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "benchmark.h"
+#include "succinct_client.h"
+
+/*
+ * Measures the latency of aggregated queries when one shard is slow. Spawns
+ * a local query server per shard, with the first one holding up every query
+ * by a fixed delay, and an aggregator with a per-query timeout in front of
+ * them; the processes are stopped when the benchmark is destroyed.
+ */
+class GatherBenchmark : public Benchmark {
+ public:
+  GatherBenchmark(const std::string& server_path,
+                  const std::string& aggregator_path,
+                  const std::string& data_path, uint32_t num_shards,
+                  uint32_t delay_ms, uint32_t timeout_ms,
+                  std::string query_file = "")
+      : Benchmark() {
+    for (uint32_t i = 0; i < num_shards; i++) {
+      std::string port = std::to_string(SERVER_PORT + i);
+      std::string delay = std::to_string(i == 0 ? delay_ms : 0);
+      std::string data_file = data_path + "/data_" + std::to_string(i);
+      Spawn({ server_path, "-m", "0", "-p", port, "-d", delay, data_file });
+    }
+    Spawn({ aggregator_path, "-s", std::to_string(num_shards), "-t",
+        std::to_string(timeout_ms) });
+
+    for (uint32_t i = 0; i < num_shards; i++) {
+      WaitForPort(SERVER_PORT + i);
+    }
+    WaitForPort(AGGREGATOR_PORT);
+
+    fprintf(stderr, "Initializing shards...\n");
+    std::shared_ptr<TSocket> socket(
+        new TSocket("localhost", AGGREGATOR_PORT));
+    std::shared_ptr<TTransport> transport(new TFramedTransport(socket));
+    std::shared_ptr<TProtocol> protocol(new TBinaryProtocol(transport));
+    transport->open();
+    AggregatorServiceClient(protocol).Initialize();
+    transport->close();
+
+    client_ = new SuccinctClient("localhost");
+    fprintf(stderr, "Connected!\n");
+
+    if (query_file != "") {
+      ReadQueries(query_file);
+    }
+  }
+
+  ~GatherBenchmark() {
+    delete client_;
+    for (auto pid : children_) {
+      kill(pid, SIGTERM);
+      waitpid(pid, NULL, 0);
+    }
+  }
+
+  void BenchmarkCountLatency(std::string result_path) {
+    TimeStamp t0, t1, tdiff;
+    std::ofstream result_stream(result_path);
+
+    fprintf(stderr, "Measuring for %zu queries...\n", queries_.size());
+    for (uint32_t i = 0; i < queries_.size(); i++) {
+      t0 = GetTimestamp();
+      int64_t result = client_->Count(queries_[i]);
+      t1 = GetTimestamp();
+      tdiff = t1 - t0;
+      result_stream << i << "\t" << result << "\t"
+                    << client_->GetNumMissedShards() << "\t" << tdiff << "\n";
+    }
+    fprintf(stderr, "Measure complete.\n");
+
+    result_stream.close();
+  }
+
+  // Latency of the first page of limit results; all results if negative
+  void BenchmarkSearchLatency(std::string result_path, int64_t limit) {
+    TimeStamp t0, t1, tdiff;
+    std::ofstream result_stream(result_path);
+
+    fprintf(stderr, "Measuring for %zu queries...\n", queries_.size());
+    for (uint32_t i = 0; i < queries_.size(); i++) {
+      std::vector<int64_t> result;
+      t0 = GetTimestamp();
+      client_->Search(result, queries_[i], 0, limit);
+      t1 = GetTimestamp();
+      tdiff = t1 - t0;
+      result_stream << i << "\t" << result.size() << "\t"
+                    << client_->GetNumMissedShards() << "\t" << tdiff << "\n";
+    }
+    fprintf(stderr, "Measure complete.\n");
+
+    result_stream.close();
+  }
+
+ private:
+  void Spawn(const std::vector<std::string>& args) {
+    pid_t pid = fork();
+    if (pid == 0) {
+      std::vector<char *> argv;
+      for (auto& arg : args) {
+        argv.push_back(const_cast<char *>(arg.c_str()));
+      }
+      argv.push_back(NULL);
+      execv(argv[0], &argv[0]);
+      fprintf(stderr, "Could not start %s\n", argv[0]);
+      _exit(1);
+    }
+    children_.push_back(pid);
+  }
+
+  // Wait for a spawned process to listen on port
+  static void WaitForPort(int port) {
+    for (uint32_t attempt = 0; ; attempt++) {
+      try {
+        TSocket socket("localhost", port);
+        socket.open();
+        socket.close();
+        return;
+      } catch (std::exception& e) {
+        if (attempt == kMaxConnectAttempts) {
+          fprintf(stderr, "Nothing listening on port %d: %s\n", port,
+                  e.what());
+          throw;
+        }
+        usleep(100000);
+      }
+    }
+  }
+
+  void ReadQueries(std::string filename) {
+    std::ifstream inputfile(filename);
+    if (!inputfile.is_open()) {
+      fprintf(stderr, "Error: Query file [%s] may be missing.\n",
+              filename.c_str());
+      return;
+    }
+
+    std::string line;
+    while (getline(inputfile, line)) {
+      queries_.push_back(line.substr(0, line.find_first_of('\t')));
+    }
+    inputfile.close();
+  }
+
+  static const uint32_t kMaxConnectAttempts = 100;
+
+  std::vector<pid_t> children_;
+  SuccinctClient *client_;
+};
+
+#endif
@@ -169,7 +169,7 @@ class ShardBenchmark : public Benchmark {
     sum = 0;
     fprintf(stderr, "Warming up for %llu queries_...\n", kWarmupCount);
     for (uint64_t i = 0; i < std::min(queries_.size(), 100UL); i++) {
-      std::set<int64_t> result;
+      std::vector<int64_t> result;
       shard_->Search(result, queries_[i]);
       sum = (sum + result.size()) % shard_->GetOriginalSize();
     }
@@ -180,7 +180,7 @@ class ShardBenchmark : public Benchmark {
     sum = 0;
     fprintf(stderr, "Measuring for %llu queries_...\n", kMeasureCount);
     for (uint64_t i = 0; i < queries_.size(); i++) {
-      std::set<int64_t> result;
+      std::vector<int64_t> result;
       t0 = GetTimestamp();
       shard_->Search(result, queries_[i]);
       t1 = GetTimestamp();
@@ -194,7 +194,7 @@ class ShardBenchmark : public Benchmark {
     result_stream.close();
   }
 
-  void BenchmarkGetThroughput() {
+  double BenchmarkGetThroughput() {
     double thput = 0;
     std::string value;
     try {
@@ -235,6 +235,8 @@ class ShardBenchmark : public Benchmark {
     ofs.open("throughput_results_get", std::ofstream::out | std::ofstream::app);
     ofs << thput << "\n";
     ofs.close();
+
+    return thput;
   }
 
   void BenchmarkAccessThroughput(int32_t fetch_length) {
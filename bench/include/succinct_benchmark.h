@@ -39,7 +39,7 @@ class SuccinctBenchmark : public Benchmark {
     for (uint32_t i = 0; i < queries_.size(); i++) {
       for (uint32_t j = 0; j < 10; j++) {
         fprintf(stderr, "Running iteration %u of query %u\n", j, i);
-        std::set<int64_t> result;
+        std::vector<int64_t> result;
         t0 = GetTimestamp();
         client_->Regex(result, queries_[i]);
         t1 = GetTimestamp();
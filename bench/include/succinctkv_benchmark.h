@@ -147,7 +147,7 @@ class SuccinctKVBenchmark : public Benchmark {
     fprintf(stderr, "Warming up for %zu queries...\n",
             std::min(queries_.size(), 100UL));
     for (uint64_t i = 0; i < std::min(queries_.size(), 100UL); i++) {
-      std::set<int64_t> result;
+      std::vector<int64_t> result;
       client_->Search(result, queries_[i]);
       sum = (sum + result.size()) % kMaxSum;
     }
@@ -158,7 +158,7 @@ class SuccinctKVBenchmark : public Benchmark {
     sum = 0;
     fprintf(stderr, "Measuring for %zu queries...\n", queries_.size());
     for (uint64_t i = 0; i < queries_.size(); i++) {
-      std::set<int64_t> result;
+      std::vector<int64_t> result;
       t0 = GetTimestamp();
       client_->Search(result, queries_[i]);
       t1 = GetTimestamp();
@@ -183,7 +183,7 @@ class SuccinctKVBenchmark : public Benchmark {
     for (uint32_t i = 0; i < queries_.size(); i++) {
       for (uint32_t j = 0; j < 10; j++) {
         fprintf(stderr, "Running iteration %u of query %u\n", j, i);
-        std::set<int64_t> result;
+        std::vector<int64_t> result;
         t0 = GetTimestamp();
         client_->Regex(result, queries_[i]);
         t1 = GetTimestamp();
@@ -393,7 +393,7 @@ class SuccinctKVBenchmark : public Benchmark {
       long i = 0;
       TimeStamp warmup_start = GetTimestamp();
       while (GetTimestamp() - warmup_start < kWarmupTime) {
-        std::set<int64_t> results;
+        std::vector<int64_t> results;
         client.Search(results, data.queries[i % data.queries.size()]);
         i++;
       }
@@ -402,7 +402,7 @@ class SuccinctKVBenchmark : public Benchmark {
       i = 0;
       TimeStamp start = GetTimestamp();
       while (GetTimestamp() - start < kMeasureTime) {
-        std::set<int64_t> results;
+        std::vector<int64_t> results;
         client.Search(results, data.queries[i % data.queries.size()]);
         i++;
       }
@@ -414,7 +414,7 @@ class SuccinctKVBenchmark : public Benchmark {
       i = 0;
       TimeStamp cooldown_start = GetTimestamp();
       while (GetTimestamp() - cooldown_start < kCooldownTime) {
-        std::set<int64_t> results;
+        std::vector<int64_t> results;
         client.Search(results, data.queries[i % data.queries.size()]);
         i++;
       }
@@ -488,7 +488,7 @@ class SuccinctKVBenchmark : public Benchmark {
           std::string result;
           client.Get(result, data.randoms[(i / 2) % data.randoms.size()]);
         } else {
-          std::set<int64_t> results;
+          std::vector<int64_t> results;
           client.Search(results, data.queries[(i / 2) % data.queries.size()]);
         }
         i++;
@@ -502,7 +502,7 @@ class SuccinctKVBenchmark : public Benchmark {
           std::string result;
           client.Get(result, data.randoms[(i / 2) % data.randoms.size()]);
         } else {
-          std::set<int64_t> results;
+          std::vector<int64_t> results;
           client.Search(results, data.queries[(i / 2) % data.queries.size()]);
         }
         i++; count++;
@@ -518,7 +518,7 @@ class SuccinctKVBenchmark : public Benchmark {
           std::string result;
           client.Get(result, data.randoms[(i / 2) % data.randoms.size()]);
         } else {
-          std::set<int64_t> results;
+          std::vector<int64_t> results;
           client.Search(results, data.queries[(i / 2) % data.queries.size()]);
         }
         i++;
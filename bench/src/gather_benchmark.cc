@@ -0,0 +1,68 @@
+#include <cassert>
+#include <iostream>
+#include <fstream>
+#include <unistd.h>
+
+#include "gather_benchmark.h"
+
+void print_usage(char *exec) {
+  fprintf(stderr,
+          "Usage: %s [-n num-shards] [-d delay-ms] [-t timeout-ms] [-l limit] [-q query-file] server-path aggregator-path data-path bench-type\n",
+          exec);
+}
+
+int main(int argc, char **argv) {
+  if (argc < 5 || argc > 15) {
+    print_usage(argv[0]);
+    return -1;
+  }
+
+  int c;
+  uint32_t num_shards = 4, delay_ms = 100, timeout_ms = 0;
+  int64_t limit = -1;
+  std::string queryfile = "";
+  while ((c = getopt(argc, argv, "n:d:t:l:q:")) != -1) {
+    switch (c) {
+      case 'n':
+        num_shards = atoi(optarg);
+        break;
+      case 'd':
+        delay_ms = atoi(optarg);
+        break;
+      case 't':
+        timeout_ms = atoi(optarg);
+        break;
+      case 'l':
+        limit = atoll(optarg);
+        break;
+      case 'q':
+        queryfile = std::string(optarg);
+        break;
+      default:
+        fprintf(stderr, "Error parsing command line arguments.\n");
+    }
+  }
+
+  if (optind + 4 != argc) {
+    print_usage(argv[0]);
+    return -1;
+  }
+
+  std::string server_path = std::string(argv[optind]);
+  std::string aggregator_path = std::string(argv[optind + 1]);
+  std::string data_path = std::string(argv[optind + 2]);
+  std::string benchmark_type = std::string(argv[optind + 3]);
+
+  GatherBenchmark g_bench(server_path, aggregator_path, data_path, num_shards,
+                          delay_ms, timeout_ms, queryfile);
+  if (benchmark_type == "latency-count") {
+    g_bench.BenchmarkCountLatency("latency_results_gather_count");
+  } else if (benchmark_type == "latency-search") {
+    g_bench.BenchmarkSearchLatency("latency_results_gather_search", limit);
+  } else {
+    // Not supported
+    assert(0);
+  }
+
+  return 0;
+}
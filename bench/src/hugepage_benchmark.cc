@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <unistd.h>
+
+#include "benchmark.h"
+#include "succinct_base.h"
+
+/**
+ * Micro-benchmark comparing random lookup throughput on a large bitmap array
+ * backed by regular pages against one backed by huge pages. Lookups either
+ * go to independent random indexes, or follow a chain where each value is
+ * the index of the next lookup, as NPA and SA traversals do.
+ */
+
+void print_usage(char *exec) {
+  fprintf(stderr, "Usage: %s [-n num_values] [-q num_queries]\n", exec);
+}
+
+// Returns the average time per random lookup, in nanoseconds
+double MeasureRandomLookups(SuccinctBase::Bitmap *B, uint32_t bits,
+                            std::vector<uint64_t> &queries,
+                            uint64_t *checksum) {
+  Benchmark::TimeStamp start = Benchmark::GetTimestamp();
+  for (auto query : queries) {
+    *checksum += SuccinctBase::LookupBitmapArray(B, query, bits);
+  }
+  Benchmark::TimeStamp end = Benchmark::GetTimestamp();
+  return (double) (end - start) * 1000.0 / queries.size();
+}
+
+// Returns the average time per dependent lookup, in nanoseconds
+double MeasureChainedLookups(SuccinctBase::Bitmap *B, uint32_t bits,
+                             uint64_t num_queries, uint64_t *checksum) {
+  uint64_t idx = 0;
+  Benchmark::TimeStamp start = Benchmark::GetTimestamp();
+  for (uint64_t i = 0; i < num_queries; i++) {
+    idx = SuccinctBase::LookupBitmapArray(B, idx, bits);
+  }
+  Benchmark::TimeStamp end = Benchmark::GetTimestamp();
+  *checksum += idx;
+  return (double) (end - start) * 1000.0 / num_queries;
+}
+
+int main(int argc, char **argv) {
+  int c;
+  uint64_t num_values = 1ULL << 27;
+  uint64_t num_queries = 1 << 22;
+  while ((c = getopt(argc, argv, "n:q:")) != -1) {
+    switch (c) {
+      case 'n':
+        num_values = atol(optarg);
+        break;
+      case 'q':
+        num_queries = atol(optarg);
+        break;
+      default:
+        print_usage(argv[0]);
+        return -1;
+    }
+  }
+
+  // Values form a single random cycle over the indexes of the array (Sattolo's
+  // shuffle), so that a chain of lookups visits every value before repeating
+  uint32_t bits = std::max<uint32_t>(SuccinctUtils::IntegerLog2(num_values), 1);
+  std::mt19937_64 rng(0);
+  std::vector<uint64_t> values(num_values);
+  for (uint64_t i = 0; i < num_values; i++) {
+    values[i] = i;
+  }
+  for (uint64_t i = num_values - 1; i > 0; i--) {
+    std::swap(values[i],
+              values[std::uniform_int_distribution<uint64_t>(0, i - 1)(rng)]);
+  }
+  std::uniform_int_distribution<uint64_t> idx_dist(0, num_values - 1);
+  std::vector<uint64_t> queries(num_queries);
+  for (auto &query : queries) {
+    query = idx_dist(rng);
+  }
+
+  fprintf(stdout, "pages\trandom(ns)\tchained(ns)\trandom(Mlookups/s)\n");
+  uint64_t checksums[2] = { 0, 0 };
+  for (int use_hugepages = 0; use_hugepages <= 1; use_hugepages++) {
+    SuccinctAllocator s_allocator(use_hugepages);
+    SuccinctBase::Bitmap *B = new SuccinctBase::Bitmap;
+    SuccinctBase::CreateBitmapArray(&B, &values[0], num_values, bits,
+                                    s_allocator);
+
+    double random_time = MeasureRandomLookups(B, bits, queries,
+                                              &checksums[use_hugepages]);
+    double chained_time = MeasureChainedLookups(B, bits, num_queries,
+                                                &checksums[use_hugepages]);
+    fprintf(stdout, "%s\t%.2lf\t%.2lf\t%.2lf\n",
+            use_hugepages ? "huge" : "regular", random_time, chained_time,
+            1000.0 / random_time);
+    if (use_hugepages) {
+      fprintf(stderr, "Huge pages: %zu bytes explicit, %zu bytes transparent, "
+              "%zu fallbacks\n", SuccinctAllocator::HugeTLBBytes(),
+              SuccinctAllocator::TransparentHugePageBytes(),
+              SuccinctAllocator::NumFallbacks());
+    }
+
+    SuccinctBase::DestroyBitmap(&B, s_allocator);
+  }
+
+  if (checksums[0] != checksums[1]) {
+    fprintf(stderr, "Lookups disagree between page sizes\n");
+    return -1;
+  }
+  return 0;
+}
@@ -0,0 +1,119 @@
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <unistd.h>
+
+#include "benchmark.h"
+#include "npa/elias_gamma_encoded_npa.h"
+
+/**
+ * Micro-benchmark comparing the word-at-a-time elias-gamma decoder against the
+ * 16-bit prefix sum table decoder, over random NPA-like delta streams.
+ */
+
+void print_usage(char *exec) {
+  fprintf(stderr, "Usage: %s [-n num_deltas] [-q num_queries] [-m mean_delta]\n",
+          exec);
+}
+
+typedef uint64_t (*PrefixSumFn)(SuccinctBase::Bitmap *B, uint64_t offset,
+                                uint64_t i);
+
+uint64_t WordPrefixSum(SuccinctBase::Bitmap *B, uint64_t offset, uint64_t i) {
+  return EliasGammaEncodedNPA::EliasGammaPrefixSum(B, offset, i);
+}
+
+uint64_t TablePrefixSum(SuccinctBase::Bitmap *B, uint64_t offset, uint64_t i) {
+  return EliasGammaEncodedNPA::EliasGammaPrefixSumTable(B, offset, i);
+}
+
+// Returns the average time per prefix sum, in nanoseconds
+double MeasurePrefixSum(PrefixSumFn fn, SuccinctBase::Bitmap *B,
+                        std::vector<uint64_t> &offsets,
+                        std::vector<std::pair<uint64_t, uint64_t>> &queries,
+                        uint64_t *checksum) {
+  Benchmark::TimeStamp start = Benchmark::GetTimestamp();
+  for (auto &query : queries) {
+    *checksum += fn(B, offsets[query.first], query.second);
+  }
+  Benchmark::TimeStamp end = Benchmark::GetTimestamp();
+  return (double) (end - start) * 1000.0 / queries.size();
+}
+
+int main(int argc, char **argv) {
+  int c;
+  uint64_t num_deltas = 1 << 24;
+  uint64_t num_queries = 1 << 20;
+  double mean_delta = 64;
+  while ((c = getopt(argc, argv, "n:q:m:")) != -1) {
+    switch (c) {
+      case 'n':
+        num_deltas = atol(optarg);
+        break;
+      case 'q':
+        num_queries = atol(optarg);
+        break;
+      case 'm':
+        mean_delta = atof(optarg);
+        break;
+      default:
+        print_usage(argv[0]);
+        return -1;
+    }
+  }
+
+  // NPA deltas within a column are roughly geometrically distributed
+  SuccinctAllocator s_allocator;
+  std::mt19937_64 rng(0);
+  std::geometric_distribution<uint64_t> delta_dist(1.0 / mean_delta);
+  std::vector<uint64_t> deltas(num_deltas);
+  uint64_t size = 0;
+  for (auto &delta : deltas) {
+    delta = 1 + delta_dist(rng);
+    size += EliasGammaEncodedNPA::EliasGammaEncodingSize(delta);
+  }
+
+  SuccinctBase::Bitmap *B = new SuccinctBase::Bitmap;
+  SuccinctBase::InitBitmap(&B, size, s_allocator);
+  uint64_t pos = 0;
+  for (auto delta : deltas) {
+    uint32_t bits = EliasGammaEncodedNPA::EliasGammaEncodingSize(delta);
+    SuccinctBase::SetBitmapAtPos(&B, pos, delta, bits);
+    pos += bits;
+  }
+
+  fprintf(stdout, "sampling_rate\ttable(ns)\tword(ns)\tspeedup\n");
+  for (uint32_t sampling_rate = 32; sampling_rate <= 128; sampling_rate *= 2) {
+    // Offsets of the delta blocks between consecutive samples
+    std::vector<uint64_t> offsets;
+    pos = 0;
+    for (uint64_t i = 0; i < num_deltas; i++) {
+      if (i % (sampling_rate - 1) == 0)
+        offsets.push_back(pos);
+      pos += EliasGammaEncodedNPA::EliasGammaEncodingSize(deltas[i]);
+    }
+
+    // Random (block, number of deltas) pairs, as for random NPA lookups
+    std::uniform_int_distribution<uint64_t> block_dist(0, offsets.size() - 2);
+    std::uniform_int_distribution<uint64_t> idx_dist(0, sampling_rate - 1);
+    std::vector<std::pair<uint64_t, uint64_t>> queries(num_queries);
+    for (auto &query : queries) {
+      query = std::make_pair(block_dist(rng), idx_dist(rng));
+    }
+
+    uint64_t table_checksum = 0, word_checksum = 0;
+    double table_time = MeasurePrefixSum(TablePrefixSum, B, offsets, queries,
+                                         &table_checksum);
+    double word_time = MeasurePrefixSum(WordPrefixSum, B, offsets, queries,
+                                        &word_checksum);
+    if (table_checksum != word_checksum) {
+      fprintf(stderr, "Decoders disagree at sampling rate %u\n", sampling_rate);
+      return -1;
+    }
+    fprintf(stdout, "%u\t%.2lf\t%.2lf\t%.2lfx\n", sampling_rate, table_time,
+            word_time, table_time / word_time);
+  }
+
+  SuccinctBase::DestroyBitmap(&B, s_allocator);
+  return 0;
+}
@@ -41,6 +41,72 @@ NPA::NPAEncodingScheme EncodingSchemeFromOption(int opt) {
   }
 }
 
+// Measures get throughput with the shard placed on each NUMA node in turn,
+// and the benchmark thread on each node in turn, so that lookups to local
+// memory can be compared with lookups to remote memory
+void BenchmarkNumaThroughput(const std::string &inputpath, SuccinctMode mode,
+                             uint32_t sa_sampling_rate,
+                             uint32_t isa_sampling_rate,
+                             uint32_t npa_sampling_rate, SamplingScheme scheme,
+                             NPA::NPAEncodingScheme npa_scheme,
+                             const std::string &querypath) {
+  int num_nodes = NumaUtils::NumNodes();
+  if (num_nodes == 1) {
+    fprintf(stderr, "Single NUMA node; all lookups are local.\n");
+  }
+
+  std::vector<std::vector<double>> thputs(num_nodes,
+                                          std::vector<double>(num_nodes, 0));
+  for (int mem_node = 0; mem_node < num_nodes; mem_node++) {
+    std::vector<int> cpus;
+    if (!NumaUtils::NodeCpus(mem_node, &cpus) || cpus.empty())
+      continue;
+
+    // Load from the node itself, so that the shard is allocated there
+    PageInConfig config;
+    config.numa_node = mem_node;
+    NumaUtils::BindThread(mem_node);
+    SuccinctShard *fd = new SuccinctShard(0, inputpath, mode, sa_sampling_rate,
+                                          isa_sampling_rate, npa_sampling_rate,
+                                          scheme, scheme, npa_scheme, 3, 1024,
+                                          1, config);
+    ShardBenchmark s_bench(fd, querypath);
+    for (int cpu_node = 0; cpu_node < num_nodes; cpu_node++) {
+      if (!NumaUtils::BindThread(cpu_node))
+        continue;
+      fprintf(stderr, "Shard on node %d, lookups from node %d\n", mem_node,
+              cpu_node);
+      thputs[mem_node][cpu_node] = s_bench.BenchmarkGetThroughput();
+    }
+    delete fd;
+  }
+
+  double local = 0, remote = 0;
+  int num_local = 0, num_remote = 0;
+  printf("mem_node\tcpu_node\tplacement\tthroughput\n");
+  for (int mem_node = 0; mem_node < num_nodes; mem_node++) {
+    for (int cpu_node = 0; cpu_node < num_nodes; cpu_node++) {
+      double thput = thputs[mem_node][cpu_node];
+      if (thput == 0)
+        continue;
+      bool is_local = (mem_node == cpu_node);
+      printf("%d\t%d\t%s\t%lf\n", mem_node, cpu_node,
+             is_local ? "local" : "remote", thput);
+      if (is_local) {
+        local += thput;
+        num_local++;
+      } else {
+        remote += thput;
+        num_remote++;
+      }
+    }
+  }
+  if (num_local > 0)
+    printf("Local get throughput: %lf\n", local / num_local);
+  if (num_remote > 0)
+    printf("Remote get throughput: %lf\n", remote / num_remote);
+}
+
 int main(int argc, char **argv) {
   if (argc < 2 || argc > 24) {
     print_usage(argv[0]);
@@ -145,6 +211,20 @@ int main(int argc, char **argv) {
 
   std::string inputpath = std::string(argv[optind]);
 
+  if (type == "throughput-numa") {
+    if (mode != 1 && mode != 2) {
+      fprintf(stderr, "NUMA benchmark needs a serialized shard (mode 1 or 2).\n");
+      return -1;
+    }
+    BenchmarkNumaThroughput(
+        inputpath,
+        mode == 1 ? SuccinctMode::LOAD_IN_MEMORY :
+            SuccinctMode::LOAD_MEMORY_MAPPED,
+        sa_sampling_rate, isa_sampling_rate, npa_sampling_rate, scheme,
+        npa_scheme, querypath);
+    return 0;
+  }
+
   SuccinctShard *fd;
   if (mode == 0) {
     fprintf(stderr, "SuccinctMode = Construct in memory.\n");
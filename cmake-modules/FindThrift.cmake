@@ -1,12 +1,17 @@
 # - Find Thrift (a cross platform RPC lib/tool)
 # This module defines
-#  THRIFT_VERSION_STRING, version string of ant if found
+#  THRIFT_VERSION_STRING, version of the thrift compiler, e.g. 0.12.0
 #  THRIFT_LIBRARIES, libraries to link
+#  THRIFT_NB_LIBRARIES, libraries to link for non-blocking servers
 #  THRIFT_INCLUDE_DIR, where to find THRIFT headers
 #  THRIFT_COMPILER, thrift compiler executable
 #  THRIFT_FOUND, If false, do not try to use ant
 # Function
 #  thrift_gen_cpp(<path to thrift file> <source destination> <include destination> <source list>)
+#
+# A minimum version may be given to find_package(Thrift <version>); it is
+# checked against both the compiler and the headers, which must match, since
+# the generated code is built against the headers.
 
 # prefer the thrift version supplied in THRIFT_HOME (cmake -DTHRIFT_HOME then environment)
 find_path(THRIFT_INCLUDE_DIR
@@ -34,6 +39,33 @@ find_library(THRIFT_LIBRARIES
         lib lib64
 )
 
+# non-blocking servers run on libevent
+find_library(THRIFT_NB_LIBRARY
+    NAMES
+        thriftnb libthriftnb
+    HINTS
+        ${THRIFT_HOME}
+        ENV THRIFT_HOME
+        /usr/local
+        /opt/local
+    PATH_SUFFIXES
+        lib lib64
+)
+
+find_library(LIBEVENT_LIBRARY
+    NAMES
+        event libevent
+    HINTS
+        ${LIBEVENT_HOME}
+        ENV LIBEVENT_HOME
+        /usr/local
+        /opt/local
+    PATH_SUFFIXES
+        lib lib64
+)
+
+set(THRIFT_NB_LIBRARIES ${THRIFT_NB_LIBRARY} ${LIBEVENT_LIBRARY})
+
 find_program(THRIFT_COMPILER
     NAMES
         thrift
@@ -49,12 +81,11 @@ find_program(THRIFT_COMPILER
 if (THRIFT_COMPILER)
     exec_program(${THRIFT_COMPILER}
         ARGS -version OUTPUT_VARIABLE __thrift_OUT RETURN_VALUE THRIFT_RETURN)
-    string(REGEX MATCH "[0-9]+.[0-9]+.[0-9]+-[a-z]+$" THRIFT_VERSION_STRING ${__thrift_OUT})
+    string(REGEX MATCH "[0-9]+\\.[0-9]+\\.[0-9]+" THRIFT_VERSION_STRING "${__thrift_OUT}")
 
     # define utility function to generate cpp files
     function(thrift_gen_cpp thrift_file dst_src dst_inc SRC_LIST)
-        set(_res)
-        set(_res_inc_path)
+        set(_sources)
         if(EXISTS ${thrift_file})
             get_filename_component(_target_dir ${thrift_file} NAME_WE)
             message(STATUS "Generating thrift C++ files for ${_target_dir}")
@@ -67,8 +98,6 @@ if (THRIFT_COMPILER)
         else()
             message(SEND_ERROR "thrift_gen_cpp: File ${thrift_file} does not exist")
         endif()
-        set(${THRIFT_CPP_FILES} "${__result_src}" PARENT_SCOPE)
-        set(${THRIFT_H_FILES} "${__result_hdr}" PARENT_SCOPE)
         foreach(src_file ${__result_src})
             get_filename_component(filename ${src_file} NAME)
             if(filename MATCHES "(.*)\\.skeleton\\.(.*)")
@@ -85,7 +114,19 @@ if (THRIFT_COMPILER)
     endfunction()
 endif()
 
+# the headers must come from the same release as the compiler
+if (THRIFT_VERSION_STRING AND EXISTS ${THRIFT_INCLUDE_DIR}/thrift/config.h)
+    file(STRINGS ${THRIFT_INCLUDE_DIR}/thrift/config.h __thrift_hdr_version
+        REGEX "#define PACKAGE_VERSION ")
+    string(REGEX MATCH "[0-9]+\\.[0-9]+\\.[0-9]+" __thrift_hdr_version "${__thrift_hdr_version}")
+    if (__thrift_hdr_version AND NOT __thrift_hdr_version VERSION_EQUAL THRIFT_VERSION_STRING)
+        message(SEND_ERROR "Thrift compiler ${THRIFT_COMPILER} is version ${THRIFT_VERSION_STRING}, but the headers in ${THRIFT_INCLUDE_DIR} are version ${__thrift_hdr_version}")
+    endif()
+endif()
+
 include(FindPackageHandleStandardArgs)
-FIND_PACKAGE_HANDLE_STANDARD_ARGS(Thrift DEFAULT_MSG THRIFT_LIBRARIES THRIFT_INCLUDE_DIR THRIFT_COMPILER)
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(Thrift
+    REQUIRED_VARS THRIFT_LIBRARIES THRIFT_NB_LIBRARY LIBEVENT_LIBRARY THRIFT_INCLUDE_DIR THRIFT_COMPILER
+    VERSION_VAR THRIFT_VERSION_STRING)
 
-mark_as_advanced(THRIFT_LIBRARIES THRIFT_INCLUDE_DIR THRIFT_COMPILER THRIFT_VERSION_STRING)
+mark_as_advanced(THRIFT_LIBRARIES THRIFT_NB_LIBRARY LIBEVENT_LIBRARY THRIFT_INCLUDE_DIR THRIFT_COMPILER THRIFT_VERSION_STRING)
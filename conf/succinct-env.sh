@@ -1,5 +1,16 @@
 #export SUCCINCT_DATA_PATH="/mnt"
 #export NUM_SHARDS="8"
+#export SHARDS_PER_SERVER="4"
 #export ISA_SAMPLING_RATE="8"
 #export SA_SAMPLING_RATE="8"
 #export REGEX_OPT="TRUE"
+#export QUERY_TIMEOUT_MS="500"
+#export SERVER_MODE="pooled"
+#export SERVER_WORKERS="16"
+#export SERVER_MAX_PENDING="1024"
+#export AGGREGATOR_MAX_IDLE="64"
+#export HUGE_PAGES="TRUE"
+#export MEMORY_MAPPED="TRUE"
+#export PAGE_IN="prefetch,keyval=populate"
+#export PREFETCH_MBPS="200"
+#export NUMA_NODES="0 1"
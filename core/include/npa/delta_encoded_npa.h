@@ -5,6 +5,7 @@
 
 #include "utils/succinct_utils.h"
 #include "utils/definitions.h"
+#include "utils/packed_array.h"
 #include "utils/array_stream.h"
 #include "utils/thread_pool.h"
 #include "npa.h"
@@ -18,6 +19,10 @@ class DeltaEncodedNPA : public NPA {
 
     uint8_t sample_bits;
     uint8_t delta_offset_bits;
+
+    // Readers for samples and delta offsets, specialized for their widths
+    PackedArrayReader sample_reader;
+    PackedArrayReader delta_offset_reader;
   } DeltaEncodedVector;
 
   virtual size_t SerializeDeltaEncodedVector(DeltaEncodedVector *dv,
@@ -52,6 +57,7 @@ class DeltaEncodedNPA : public NPA {
     in_size += SuccinctBase::DeserializeBitmap(&(dv->samples), in);
     in_size += SuccinctBase::DeserializeBitmap(&(dv->deltas), in);
     in_size += SuccinctBase::DeserializeBitmap(&(dv->delta_offsets), in);
+    InitDeltaEncodedVectorReaders(dv);
 
     return in_size;
   }
@@ -69,6 +75,7 @@ class DeltaEncodedNPA : public NPA {
     data += SuccinctBase::MemoryMapBitmap(&(dv->samples), data);
     data += SuccinctBase::MemoryMapBitmap(&(dv->deltas), data);
     data += SuccinctBase::MemoryMapBitmap(&(dv->delta_offsets), data);
+    InitDeltaEncodedVectorReaders(dv);
 
     return data - data_beg;
   }
@@ -89,6 +96,16 @@ class DeltaEncodedNPA : public NPA {
     return SuccinctUtils::IntegerLog2(n + 1) - 1;
   }
 
+  // Resolve the readers for samples and delta offsets once the vector's
+  // bitmaps and widths are set
+  static void InitDeltaEncodedVectorReaders(DeltaEncodedVector *dv) {
+    dv->sample_reader.Reset(
+        (dv->samples == NULL) ? NULL : dv->samples->bitmap, dv->sample_bits);
+    dv->delta_offset_reader.Reset(
+        (dv->delta_offsets == NULL) ? NULL : dv->delta_offsets->bitmap,
+        dv->delta_offset_bits);
+  }
+
   // Create delta encoded vector
   virtual void CreateDeltaEncodedVector(DeltaEncodedVector *dv,
                                         std::vector<uint64_t> &data) = 0;
@@ -97,6 +114,10 @@ class DeltaEncodedNPA : public NPA {
   virtual uint64_t LookupDeltaEncodedVector(DeltaEncodedVector *dv,
                                             uint64_t i) = 0;
 
+  // Sum the i delta values encoded at *offset in the deltas bitmap B, and
+  // advance *offset past them
+  virtual uint64_t SumDeltas(Bitmap *B, uint64_t *offset, uint64_t i) = 0;
+
  public:
   // Constructor
   DeltaEncodedNPA(uint64_t npa_size, uint64_t sigma_size, uint32_t context_len,
@@ -118,10 +139,13 @@ class DeltaEncodedNPA : public NPA {
 
     // Initialize Auxiliary NPA structures
     col_offsets_ = col_offsets;
+    InitColumnLookup();
 
-    // Get all NPA values
-    int64_t *lNPA = new int64_t[npa_size_]();
-    uint64_t first_idx, cur_idx, nxt_idx, num_elements_per_chunk;
+    // Get all NPA values; they are written straight into a memory-mapped
+    // npa_file, so that they need not fit in memory
+    int64_t *lNPA = (int64_t *) SuccinctUtils::MemoryMapWritable(
+        npa_file, npa_size_ * sizeof(int64_t));
+    uint64_t first_idx, num_elements_per_chunk;
     std::thread constructor_thread[8];
 
     ArrayStream isa_stream(isa_file);
@@ -133,9 +157,10 @@ class DeltaEncodedNPA : public NPA {
               0 : npa_size_ - i * num_elements_per_chunk;
       uint64_t num_elements = SuccinctUtils::Min(remaining_elements,
                                                  num_elements_per_chunk);
-      constructor_thread[i] = std::thread(&DeltaEncodedNPA::ConstructNPAChunk, lNPA,
-                                    isa_file, i * num_elements_per_chunk,
-                                    num_elements, (i == 7) ? first_idx : -1ULL);
+      constructor_thread[i] = std::thread(&DeltaEncodedNPA::ConstructNPAChunk,
+                                          lNPA, isa_file,
+                                          i * num_elements_per_chunk,
+                                          num_elements, npa_size_, first_idx);
     }
 
     for (uint8_t i = 0; i < 8; i++) {
@@ -144,8 +169,7 @@ class DeltaEncodedNPA : public NPA {
 
     isa_stream.CloseAndRemove();
 
-    SuccinctUtils::WriteToFile(lNPA, npa_size_, npa_file);
-    delete[] lNPA;
+    SuccinctUtils::MemoryUnmap(lNPA, npa_size_ * sizeof(int64_t));
 
     del_npa_ = new DeltaEncodedVector[sigma_size_];
     ThreadPool pool(8);
@@ -163,13 +187,89 @@ class DeltaEncodedNPA : public NPA {
   // Access element at index i
   virtual uint64_t operator[](uint64_t i) {
     // Get column id
-    uint64_t column_id = SuccinctBase::GetRank1(&col_offsets_, i) - 1;
+    uint64_t column_id = GetColumnId(i);
     assert(column_id < sigma_size_);
     uint64_t npa_val = LookupDeltaEncodedVector(&(del_npa_[column_id]),
                                                 i - col_offsets_[column_id]);
     return npa_val;
   }
 
+  // Follow the NPA from index i for n suffixes, writing their first
+  // characters to out. Besides keeping the current column, the delta block
+  // decoded by the previous step is kept: when the next index lies further
+  // along the same block, decoding resumes from where it stopped instead of
+  // starting over from the sample.
+  virtual uint64_t Extract(uint64_t i, uint64_t n, const char *alphabet,
+                           char *out) {
+    uint64_t col_id = 0, col_start = 1, col_end = 0;
+
+    // State of the last delta block decoded
+    DeltaEncodedVector *dv = NULL;
+    uint64_t dv_sample = 0, dv_pos = 0, dv_offset = 0, dv_val = 0;
+
+    for (uint64_t k = 0; k < n; k++) {
+      if (k != 0) {
+        uint64_t local_idx = i - col_start;
+        uint64_t sample_offset = local_idx / sampling_rate_;
+        uint64_t pos = local_idx % sampling_rate_;
+        DeltaEncodedVector *cur = &del_npa_[col_id];
+        if (cur != dv || sample_offset != dv_sample || pos < dv_pos) {
+          dv = cur;
+          dv_sample = sample_offset;
+          dv_pos = 0;
+          dv_offset = dv->delta_offset_reader[sample_offset];
+          dv_val = dv->sample_reader[sample_offset];
+        }
+        dv_val += SumDeltas(dv->deltas, &dv_offset, pos - dv_pos);
+        dv_pos = pos;
+        i = dv_val;
+      }
+      if (i < col_start || i >= col_end)
+        FindColumn(i, &col_id, &col_start, &col_end);
+      out[k] = alphabet[col_id];
+    }
+    return i;
+  }
+
+  // Access elements at each of the n indexes in idx, writing them to out.
+  // Lookups are processed in groups of kLookupBatchSize: the sample and delta
+  // offset words for the whole group are prefetched first, then the delta
+  // words, so that the cache misses of independent lookups overlap.
+  virtual void LookupBatch(const uint64_t *idx, uint64_t *out, size_t n) {
+    const uint64_t batch_size = SuccinctBase::kLookupBatchSize;
+    DeltaEncodedVector *dv[batch_size];
+    uint64_t local_idx[batch_size];
+
+    for (size_t s = 0; s < n; s += batch_size) {
+      size_t m = SuccinctUtils::Min(n - s, batch_size);
+
+      // Resolve columns; prefetch samples and delta offsets
+      for (size_t k = 0; k < m; k++) {
+        uint64_t column_id = GetColumnId(idx[s + k]);
+        assert(column_id < sigma_size_);
+        dv[k] = &del_npa_[column_id];
+        local_idx[k] = idx[s + k] - col_offsets_[column_id];
+        uint64_t sample_offset = local_idx[k] / sampling_rate_;
+        dv[k]->sample_reader.Prefetch(sample_offset);
+        dv[k]->delta_offset_reader.Prefetch(sample_offset);
+      }
+
+      // Prefetch the first word of deltas to be decoded
+      for (size_t k = 0; k < m; k++) {
+        if (local_idx[k] % sampling_rate_ == 0)
+          continue;
+        uint64_t delta_offset = dv[k]->delta_offset_reader[local_idx[k]
+            / sampling_rate_];
+        PREFETCH(&dv[k]->deltas->bitmap[delta_offset / 64]);
+      }
+
+      // Decode
+      for (size_t k = 0; k < m; k++) {
+        out[s + k] = LookupDeltaEncodedVector(dv[k], local_idx[k]);
+      }
+    }
+  }
+
   virtual size_t StorageSize() {
     size_t tot_size = 3 * sizeof(uint64_t) + 2 * sizeof(uint32_t);
     tot_size += sizeof(contexts_.size())
@@ -246,6 +346,7 @@ class DeltaEncodedNPA : public NPA {
 
     // Read coloffsets
     in_size += SuccinctBase::DeserializeVector(col_offsets_, in);
+    InitColumnLookup();
 
     // Read delta encoded vectors
     del_npa_ = new DeltaEncodedVector[sigma_size_];
@@ -256,9 +357,9 @@ class DeltaEncodedNPA : public NPA {
     return in_size;
   }
 
-  virtual size_t MemoryMap(std::string filename) {
+  virtual size_t MapBuffer(uint8_t *buf) {
     uint8_t *data, *data_beg;
-    data = data_beg = (uint8_t *) SuccinctUtils::MemoryMap(filename);
+    data = data_beg = buf;
 
     encoding_scheme_ = (NPAEncodingScheme) (*((uint64_t *) data));
     data += sizeof(uint64_t);
@@ -273,6 +374,7 @@ class DeltaEncodedNPA : public NPA {
 
     // Read coloffsets
     data += SuccinctBase::MemoryMapVector(col_offsets_, data);
+    InitColumnLookup();
 
     // Read delta encoded vectors
     del_npa_ = new DeltaEncodedVector[sigma_size_];
@@ -289,19 +391,25 @@ class DeltaEncodedNPA : public NPA {
  private:
   static void ConstructNPAChunk(int64_t *lNPA, std::string isa_file,
                                 uint64_t start_pos, uint64_t n_elems,
-                                int64_t first_idx) {
+                                uint64_t npa_size, int64_t first_idx) {
+    if (n_elems == 0)
+      return;
+
     // ISA Stream is configured to start reading from correct position
     uint64_t cur_idx, nxt_idx;
     ArrayStream isa_stream(isa_file, start_pos);
     cur_idx = isa_stream.Get();
 
-    for (uint64_t i = 0; i < n_elems; i++) {
+    for (uint64_t i = start_pos + 1; i < start_pos + n_elems; i++) {
       nxt_idx = isa_stream.Get();
       lNPA[cur_idx] = nxt_idx;
       cur_idx = nxt_idx;
     }
 
-    if (first_idx > 0) {
+    // The last suffix wraps around to the first
+    if (start_pos + n_elems < npa_size) {
+      lNPA[cur_idx] = isa_stream.Get();
+    } else {
       lNPA[cur_idx] = first_idx;
     }
     isa_stream.Close();
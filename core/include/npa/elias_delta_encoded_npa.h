@@ -14,6 +14,9 @@ class EliasDeltaEncodedNPA : public DeltaEncodedNPA {
   // Lookup Elias-Delta encoded vector at index i
   virtual uint64_t LookupDeltaEncodedVector(DeltaEncodedVector *dv, uint64_t i);
 
+  // Sum the i Elias-Delta encoded deltas at *offset, advancing *offset
+  virtual uint64_t SumDeltas(Bitmap *B, uint64_t *offset, uint64_t i);
+
  public:
   EliasDeltaEncodedNPA(uint64_t npa_size, uint64_t sigma_size,
                        uint32_t context_len, uint32_t sampling_rate,
@@ -37,8 +40,9 @@ class EliasDeltaEncodedNPA : public DeltaEncodedNPA {
   // in the deltas bitmaps
   uint64_t EliasDeltaDecode(Bitmap *B, uint64_t *offset);
 
-  // Compute the prefix sum for the Elias-Delta encoded deltas
-  uint64_t EliasDeltaPrefixSum(Bitmap *B, uint64_t offset, uint64_t i);
+  // Compute the prefix sum for the Elias-Delta encoded deltas, advancing
+  // offset past them
+  uint64_t EliasDeltaPrefixSum(Bitmap *B, uint64_t *offset, uint64_t i);
 
 };
 
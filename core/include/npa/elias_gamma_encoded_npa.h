@@ -4,9 +4,9 @@
 #include "delta_encoded_npa.h"
 
 /* Gamma prefix sum table functions */
-#define PREFIX_OFF(i)   ((prefixsum_[(i)] >> 24) & 0xFF)
-#define PREFIX_CNT(i)   ((prefixsum_[i] >> 16) & 0xFF)
-#define PREFIX_SUM(i)   (prefixsum_[i] & 0xFFFF)
+#define PREFIX_OFF(t, i)   (((t)[(i)] >> 24) & 0xFF)
+#define PREFIX_CNT(t, i)   (((t)[(i)] >> 16) & 0xFF)
+#define PREFIX_SUM(t, i)   ((t)[(i)] & 0xFFFF)
 
 class EliasGammaEncodedNPA : public DeltaEncodedNPA {
  public:
@@ -28,6 +28,23 @@ class EliasGammaEncodedNPA : public DeltaEncodedNPA {
 
   virtual int64_t BinarySearch(int64_t val, uint64_t s, uint64_t e, bool flag);
 
+  // Narrows both bounds of range in a single pass: the decoding cursor that
+  // finds the left bound is carried on to the right bound, and only moves
+  // to a later sample when that sample is known to lie within range.
+  virtual std::pair<int64_t, int64_t> BinarySearchRange(
+      std::pair<int64_t, int64_t> range, uint64_t s, uint64_t e);
+
+  // Compute the prefix sum of the first i elias-gamma encoded delta values
+  // starting at offset in the deltas bitmap. Codes are decoded from 64-bit
+  // windows of the bitmap, using count-leading-zeros to find code lengths.
+  static uint64_t EliasGammaPrefixSum(const Bitmap *B, uint64_t offset,
+                                      uint64_t i);
+
+  // Same as EliasGammaPrefixSum, but decodes 16 bits at a time using a table
+  // of pre-computed prefix sums; kept as a reference for the word decoder
+  static uint64_t EliasGammaPrefixSumTable(Bitmap *B, uint64_t offset,
+                                           uint64_t i);
+
  protected:
   // Create elias-gamma delta encoded vector
   virtual void CreateDeltaEncodedVector(DeltaEncodedVector *dv,
@@ -36,16 +53,20 @@ class EliasGammaEncodedNPA : public DeltaEncodedNPA {
   // Lookup elias-gamma delta encoded vector at index i
   virtual uint64_t LookupDeltaEncodedVector(DeltaEncodedVector *dv, uint64_t i);
 
+  // Sum the i elias-gamma encoded deltas at *offset, advancing *offset
+  virtual uint64_t SumDeltas(Bitmap *B, uint64_t *offset, uint64_t i);
+
  private:
   // Accesses data from a 64 bit integer represented as a bit map
   // from a specified position and for a specified number of bits
-  uint16_t AccessDataPos16(uint16_t data, uint32_t pos, uint32_t b);
+  static uint16_t AccessDataPos16(uint16_t data, uint32_t pos, uint32_t b);
 
   int64_t BinarySearchSamples(DeltaEncodedVector *dv, uint64_t val, uint64_t s,
                               uint64_t e);
 
-  // Initialize pre-computed prefix sums
-  void InitPrefixSum();
+  // Get the pre-computed prefix sums for 16-bit blocks, shared by all
+  // instances and initialized on first use
+  static const uint32_t *PrefixSumTable();
 
   // Encode a sorted vector using elias-gamma encoding
   void EliasGammaEncode(Bitmap **B, std::vector<uint64_t> &deltas,
@@ -54,13 +75,6 @@ class EliasGammaEncodedNPA : public DeltaEncodedNPA {
   // Decode a particular elias-gamma encoded delta value at a provided offset
   // in the deltas bitmap
   uint64_t EliasGammaDecode(Bitmap *B, uint64_t *offset);
-
-  // Compute the prefix sum of elias-gamma encoded delta values
-  uint64_t EliasGammaPrefixSum(Bitmap *B, uint64_t offset, uint64_t i);
-
-  // Pre-computed prefix sums for elias gamma encoded NPA
-  uint32_t prefixsum_[65536];
-
 };
 
 #endif
@@ -1,6 +1,8 @@
 #ifndef NPA_H
 #define NPA_H
 
+#include <algorithm>
+
 #include "utils/definitions.h"
 #include "succinct_base.h"
 
@@ -30,6 +32,7 @@ class NPA {
     cell_offsets_ = NULL;
     encoding_scheme_ = encoding_scheme;
     s_allocator_ = s_allocator;
+    col_lookup_shift_ = 0;
   }
   // Virtual destructor
   virtual ~NPA() {
@@ -53,6 +56,20 @@ class NPA {
     return sampling_rate_;
   }
 
+  // Get the id of the column holding index i. The column lookup table maps
+  // the high bits of i to the columns at the first and last index sharing
+  // them; only columns that start within that bucket are searched.
+  uint64_t GetColumnId(uint64_t i) {
+    assert(i < npa_size_);
+    uint64_t b = i >> col_lookup_shift_;
+    uint64_t lo = col_lookup_[b], hi = col_lookup_[b + 1];
+    if (lo == hi)
+      return lo;
+    return std::upper_bound(col_offsets_.begin() + lo + 1,
+                            col_offsets_.begin() + hi + 1, i)
+        - col_offsets_.begin() - 1;
+  }
+
   // Access element at index i
   virtual uint64_t operator[](uint64_t i) = 0;
 
@@ -61,11 +78,43 @@ class NPA {
     return operator[](i);
   }
 
+  // Access elements at each of the n indexes in idx, writing them to out;
+  // idx and out may point to the same buffer
+  virtual void LookupBatch(const uint64_t *idx, uint64_t *out, size_t n) {
+    for (size_t k = 0; k < n; k++) {
+      out[k] = operator[](idx[k]);
+    }
+  }
+
+  // Follow the NPA from index i, writing the first character of each of the
+  // n suffixes visited (i, NPA[i], NPA[NPA[i]], ...) to out, where alphabet
+  // holds the character of each column; returns the last index visited.
+  // The current column is kept across steps, and only searched for again
+  // when the index leaves it.
+  virtual uint64_t Extract(uint64_t i, uint64_t n, const char *alphabet,
+                           char *out) {
+    uint64_t col_id = 0, col_start = 1, col_end = 0;
+    for (uint64_t k = 0; k < n; k++) {
+      if (k != 0)
+        i = operator[](i);
+      if (i < col_start || i >= col_end)
+        FindColumn(i, &col_id, &col_start, &col_end);
+      out[k] = alphabet[col_id];
+    }
+    return i;
+  }
+
   virtual size_t Serialize(std::ostream& out) = 0;
 
   virtual size_t Deserialize(std::istream& in) = 0;
 
-  virtual size_t MemoryMap(std::string filename) = 0;
+  // Lay out the NPA over a buffer holding its serialized form; the buffer
+  // must outlive the NPA
+  virtual size_t MapBuffer(uint8_t *buf) = 0;
+
+  virtual size_t MemoryMap(std::string filename) {
+    return MapBuffer((uint8_t *) SuccinctUtils::MemoryMap(filename));
+  }
 
   virtual size_t StorageSize() = 0;
 
@@ -87,8 +136,57 @@ class NPA {
     return flag ? ep : sp;
   }
 
+  // Narrow range, a range of NPA values, to the indexes in [s, e] whose
+  // values lie within it: the first index holding a value >= range.first,
+  // and the last index holding a value <= range.second. Indexes [s, e] must
+  // lie within a single column.
+  virtual std::pair<int64_t, int64_t> BinarySearchRange(
+      std::pair<int64_t, int64_t> range, uint64_t s, uint64_t e) {
+    int64_t left = BinarySearch(range.first, s, e, false);
+    int64_t right = BinarySearch(range.second, left, e, true);
+    return std::pair<int64_t, int64_t>(left, right);
+  }
+
  protected:
 
+  // Build the column lookup table from col_offsets_; must be called whenever
+  // col_offsets_ is (re)initialized. Indexes are bucketed on their high bits,
+  // with about kColumnLookupDensity buckets per column, so that most buckets
+  // fall within a single column.
+  void InitColumnLookup() {
+    static const uint64_t kColumnLookupDensity = 8;
+
+    col_lookup_.clear();
+    col_lookup_shift_ = 0;
+    if (npa_size_ == 0 || col_offsets_.empty())
+      return;
+
+    uint64_t max_buckets = kColumnLookupDensity * col_offsets_.size();
+    while (((npa_size_ - 1) >> col_lookup_shift_) >= max_buckets)
+      col_lookup_shift_++;
+
+    // Entry b holds the column of the first index of bucket b; the extra
+    // entry at the end holds the column of the last index
+    uint64_t num_buckets = ((npa_size_ - 1) >> col_lookup_shift_) + 1;
+    col_lookup_.resize(num_buckets + 1);
+    uint64_t c = 0;
+    for (uint64_t b = 0; b <= num_buckets; b++) {
+      uint64_t i = SuccinctUtils::Min(b << col_lookup_shift_, npa_size_ - 1);
+      while (c + 1 < col_offsets_.size() && col_offsets_[c + 1] <= i)
+        c++;
+      col_lookup_[b] = c;
+    }
+  }
+
+  // Get the id and the [start, end) index range of the column holding index i
+  void FindColumn(uint64_t i, uint64_t *col_id, uint64_t *col_start,
+                  uint64_t *col_end) {
+    *col_id = GetColumnId(i);
+    *col_start = col_offsets_[*col_id];
+    *col_end = (*col_id + 1 < col_offsets_.size()) ?
+        col_offsets_[*col_id + 1] : npa_size_;
+  }
+
   bool CompareDataBitmap(Bitmap *data_bitmap, uint64_t i, uint64_t j,
                            uint64_t k) {
     uint32_t sigma_bits = SuccinctUtils::IntegerLog2(sigma_size_);
@@ -127,6 +225,10 @@ class NPA {
   uint32_t sampling_rate_;
   SuccinctAllocator s_allocator_;
 
+  // Column lookup table
+  std::vector<uint32_t> col_lookup_;
+  uint32_t col_lookup_shift_;
+
  public:
   // Public data structures
   std::map<uint64_t, uint64_t> contexts_;
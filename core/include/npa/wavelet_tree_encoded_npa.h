@@ -40,8 +40,8 @@ class WaveletTreeEncodedNPA : public NPA {
   // Deserialize the wavelet tree encoded NPA
   virtual size_t Deserialize(std::istream& in);
 
-  // Memory map the wavelet tree encoded NPA
-  virtual size_t MemoryMap(std::string filename);
+  // Lay out the wavelet tree encoded NPA over a buffer
+  virtual size_t MapBuffer(uint8_t *buf);
 
   virtual size_t StorageSize();
 
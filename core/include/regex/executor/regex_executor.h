@@ -2,17 +2,18 @@
 #define REGEX_EXECUTOR_H
 
 #include <cstdint>
-#include <set>
+#include <vector>
 #include <algorithm>
 #include <iterator>
 
 #include "regex/regex_types.h"
 #include "succinct_core.h"
+#include "utils/sorted_vector.h"
 
 class RegExExecutor {
  public:
   typedef std::pair<size_t, size_t> OffsetLength;
-  typedef std::set<OffsetLength> RegExResult;
+  typedef std::vector<OffsetLength> RegExResult;   // Sorted, no duplicates
   typedef RegExResult::iterator RegExResultIterator;
 
   RegExExecutor(SuccinctCore *succinct_core, RegEx *regex) {
@@ -32,7 +33,7 @@ class RegExExecutor {
  protected:
   SuccinctCore *succinct_core_;
   RegEx *regex_;
-  std::set<OffsetLength> final_results_;
+  RegExResult final_results_;
 
 };
 
@@ -71,10 +72,12 @@ class RegExExecutorBlackBox : public RegExExecutor {
             if (primitive == ".") {
               primitive = std::string(succinct_core_->GetAlphabet());
             }
-            for (auto c : primitive) {
-              RegExPrimitive char_primitive(std::string(1, c));
-              MgramSearch(results, &char_primitive);
+            std::vector<RegExResult> char_results(primitive.length());
+            for (size_t k = 0; k < primitive.length(); k++) {
+              RegExPrimitive char_primitive(std::string(1, primitive[k]));
+              MgramSearch(char_results[k], &char_primitive);
             }
+            SortedVector::MultiwayUnion(results, char_results);
             break;
           }
         }
@@ -111,18 +114,17 @@ class RegExExecutorBlackBox : public RegExExecutor {
     std::pair<int64_t, int64_t> range = succinct_core_->BwdSearch(mgram);
     if (range.first > range.second)
       return;
-    offsets.reserve((uint64_t) (range.second - range.first + 1));
-    for (int64_t i = range.first; i <= range.second; i++) {
-      offsets.push_back((int64_t) succinct_core_->LookupSA(i));
-    }
+    offsets.resize((uint64_t) (range.second - range.first + 1));
+    succinct_core_->LookupSARange(range, &offsets[0]);
+    SortedVector::RadixSort(offsets);
+    mgram_results.reserve(mgram_results.size() + offsets.size());
     for (auto offset : offsets)
-      mgram_results.insert(OffsetLength(offset, len));
+      mgram_results.push_back(OffsetLength(offset, len));
   }
 
   void Union(RegExResult &union_results, RegExResult &first,
              RegExResult &second) {
-    std::set_union(first.begin(), first.end(), second.begin(), second.end(),
-                   std::inserter(union_results, union_results.begin()));
+    SortedVector::Union(union_results, first, second);
   }
 
   void Concat(RegExResult &concat_results, RegExResult &left,
@@ -138,9 +140,12 @@ class RegExExecutorBlackBox : public RegExExecutor {
         break;
 
       if (right_it->first == left_it->first + left_it->second)
-        concat_results.insert(
+        concat_results.push_back(
             OffsetLength(left_it->first, left_it->second + right_it->second));
     }
+
+    // Offsets come out in order, but lengths under an offset may not
+    SortedVector::SortUnique(concat_results);
   }
 
   void Repeat(RegExResult &repeat_results, RegExResult &internal,
@@ -235,13 +240,13 @@ class RegExExecutorSuccinct : public RegExExecutor {
     size_t length_;
   } ResultEntry;
   struct ResultEntryComparator {
-    bool operator()(const ResultEntry &lhs, const ResultEntry &rhs) {
+    bool operator()(const ResultEntry &lhs, const ResultEntry &rhs) const {
       if (lhs.range_ == rhs.range_)
         return lhs.length_ < rhs.length_;
       return lhs.range_ < rhs.range_;
     }
   } result_comparator;
-  typedef std::set<ResultEntry, ResultEntryComparator> ResultSet;
+  typedef std::vector<ResultEntry> ResultSet;   // Sorted, no duplicates
   typedef ResultSet::iterator ResultIterator;
 
   RegExExecutorSuccinct(SuccinctCore *succinct_core, RegEx *regex)
@@ -265,28 +270,67 @@ class RegExExecutorSuccinct : public RegExExecutor {
   void Execute() {
     Compute(regex_results_, regex_);
 
-    // Process final results
-    std::map<int64_t, size_t> sa_buf;
-    std::vector<std::pair<size_t, size_t>> results;
+    // Look up each SA index covered by the result ranges once
+    std::vector<int64_t> sa_idx;
+    for (ResultIterator r_it = regex_results_.begin();
+        r_it != regex_results_.end(); r_it++) {
+      Range range = r_it->range_;
+      for (int64_t i = range.first; i <= range.second; i++) {
+        sa_idx.push_back(i);
+      }
+    }
+    SortedVector::SortUnique(sa_idx);
+    std::vector<uint64_t> sa_buf(sa_idx.size());
+    succinct_core_->LookupSABatch((const uint64_t *) sa_idx.data(),
+                                  sa_buf.data(), sa_idx.size());
+
+    // Process final results; each range is contiguous in sa_idx
+    final_results_.clear();
     for (ResultIterator r_it = regex_results_.begin();
         r_it != regex_results_.end(); r_it++) {
       Range range = r_it->range_;
       if (!IsEmpty(range)) {
+        size_t pos = std::lower_bound(sa_idx.begin(), sa_idx.end(), range.first)
+            - sa_idx.begin();
         for (int64_t i = range.first; i <= range.second; i++) {
-          if (sa_buf.find(i) == sa_buf.end()) {
-            sa_buf[i] = succinct_core_->LookupSA(i);
-          }
-          results.push_back(OffsetLength(sa_buf[i], r_it->length_));
+          final_results_.push_back(OffsetLength(sa_buf[pos++], r_it->length_));
         }
       }
     }
-    final_results_ = std::set<std::pair<size_t, size_t>>(results.begin(),
-                                                         results.end());
+    SortedVector::SortUnique(final_results_);
   }
 
  protected:
   virtual void Compute(ResultSet &results, RegEx *regex) = 0;
 
+  // Restore the sorted, duplicate-free order of results built by appending
+  void Normalize(ResultSet &results) {
+    SortedVector::SortUnique(results, result_comparator);
+  }
+
+  // Union of sorted first and second, merged into union_results; either
+  // input may alias union_results
+  void Union(ResultSet &union_results, const ResultSet &first,
+             const ResultSet &second) {
+    ResultSet merged;
+    SortedVector::Union(merged, first, second, result_comparator);
+    if (union_results.empty())
+      union_results.swap(merged);
+    else
+      SortedVector::UnionInto(union_results, merged, result_comparator);
+  }
+
+  // Union of each of the sorted inputs, merged into union_results
+  void MultiwayUnion(ResultSet &union_results,
+                     const std::vector<ResultSet> &inputs) {
+    ResultSet merged;
+    SortedVector::MultiwayUnion(merged, inputs, result_comparator);
+    if (union_results.empty())
+      union_results.swap(merged);
+    else
+      SortedVector::UnionInto(union_results, merged, result_comparator);
+  }
+
   bool IsEmpty(Range range) {
     return range.first > range.second;
   }
@@ -295,7 +339,7 @@ class RegExExecutorSuccinct : public RegExExecutor {
     return IsEmpty(entry.range_);
   }
 
-  bool IsEmpty(ResultSet results) {
+  bool IsEmpty(const ResultSet &results) {
     for (auto result : results) {
       if (!IsEmpty(result.range_))
         return false;
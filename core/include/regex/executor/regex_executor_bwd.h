@@ -21,7 +21,7 @@ class RegExExecutorBwd : public RegExExecutorSuccinct {
           case RegExPrimitiveType::MGRAM: {
             Range range = succinct_core_->BwdSearch(p->GetPrimitive());
             if (!IsEmpty(range))
-              results.insert(ResultEntry(range, p->GetPrimitive().length()));
+              results.push_back(ResultEntry(range, p->GetPrimitive().length()));
             break;
           }
           case RegExPrimitiveType::DOT: {
@@ -30,16 +30,18 @@ class RegExExecutorBwd : public RegExExecutorSuccinct {
                 continue;
               Range range = succinct_core_->BwdSearch(std::string(1, c));
               if (!IsEmpty(range))
-                results.insert(ResultEntry(range, 1));
+                results.push_back(ResultEntry(range, 1));
             }
+            Normalize(results);
             break;
           }
           case RegExPrimitiveType::RANGE: {
             for (char c : p->GetPrimitive()) {
               Range range = succinct_core_->BwdSearch(std::string(1, c));
               if (!IsEmpty(range))
-                results.insert(ResultEntry(range, 1));
+                results.push_back(ResultEntry(range, 1));
             }
+            Normalize(results);
             break;
           }
         }
@@ -55,11 +57,11 @@ class RegExExecutorBwd : public RegExExecutorSuccinct {
       case RegExType::CONCAT: {
         ResultSet right_results;
         Compute(right_results, ((RegExConcat *) regex)->getRight());
-        for (auto right_result : right_results) {
-          ResultSet temp;
-          Concat(temp, ((RegExConcat *) regex)->getLeft(), right_result);
-          Union(results, results, temp);
+        std::vector<ResultSet> temp(right_results.size());
+        for (size_t k = 0; k < right_results.size(); k++) {
+          Concat(temp[k], ((RegExConcat *) regex)->getLeft(), right_results[k]);
         }
+        MultiwayUnion(results, temp);
         break;
       }
       case RegExType::REPEAT: {
@@ -83,11 +85,6 @@ class RegExExecutorBwd : public RegExExecutorSuccinct {
     }
   }
 
-  void Union(ResultSet &union_results, ResultSet first, ResultSet second) {
-    std::set_union(first.begin(), first.end(), second.begin(), second.end(),
-                   std::inserter(union_results, union_results.begin()), result_comparator);
-  }
-
   void Concat(ResultSet &concat_results, RegEx *regex,
               ResultEntry right_result) {
     switch (regex->GetType()) {
@@ -101,7 +98,7 @@ class RegExExecutorBwd : public RegExExecutorSuccinct {
             Range range = succinct_core_->ContinueBwdSearch(
                 p->GetPrimitive(), right_result.range_);
             if (!IsEmpty(range))
-              concat_results.insert(
+              concat_results.push_back(
                   ResultEntry(
                       range, right_result.length_ + p->GetPrimitive().length()));
             break;
@@ -113,9 +110,10 @@ class RegExExecutorBwd : public RegExExecutorSuccinct {
               Range range = succinct_core_->ContinueBwdSearch(
                   std::string(1, c), right_result.range_);
               if (!IsEmpty(range))
-                concat_results.insert(
+                concat_results.push_back(
                     ResultEntry(range, right_result.length_ + 1));
             }
+            Normalize(concat_results);
             break;
           }
           case RegExPrimitiveType::RANGE: {
@@ -123,9 +121,10 @@ class RegExExecutorBwd : public RegExExecutorSuccinct {
               Range range = succinct_core_->ContinueBwdSearch(
                   std::string(1, c), right_result.range_);
               if (!IsEmpty(range))
-                concat_results.insert(
+                concat_results.push_back(
                     ResultEntry(range, right_result.length_ + 1));
             }
+            Normalize(concat_results);
             break;
           }
         }
@@ -142,11 +141,12 @@ class RegExExecutorBwd : public RegExExecutorSuccinct {
         ResultSet left_right_results;
         Concat(left_right_results, ((RegExConcat *) regex)->getRight(),
                right_result);
-        for (auto left_right_result : left_right_results) {
-          ResultSet temp;
-          Concat(temp, ((RegExConcat *) regex)->getLeft(), left_right_result);
-          Union(concat_results, concat_results, temp);
+        std::vector<ResultSet> temp(left_right_results.size());
+        for (size_t k = 0; k < left_right_results.size(); k++) {
+          Concat(temp[k], ((RegExConcat *) regex)->getLeft(),
+                 left_right_results[k]);
         }
+        MultiwayUnion(concat_results, temp);
         break;
       }
       case RegExType::REPEAT: {
@@ -154,7 +154,8 @@ class RegExExecutorBwd : public RegExExecutorSuccinct {
         switch (rep_r->GetRepeatType()) {
           case RegExRepeatType::ZeroOrMore: {
             RepeatOneOrMore(concat_results, rep_r->GetInternal(), right_result);
-            concat_results.insert(right_result);
+            concat_results.push_back(right_result);
+            Normalize(concat_results);
             break;
           }
           case RegExRepeatType::OneOrMore: {
@@ -21,7 +21,7 @@ class RegExExecutorFwd : public RegExExecutorSuccinct {
           case RegExPrimitiveType::MGRAM: {
             Range range = succinct_core_->FwdSearch(primitive->GetPrimitive());
             if (!IsEmpty(range))
-              results.insert(
+              results.push_back(
                   ResultEntry(range, primitive->GetPrimitive().length()));
             break;
           }
@@ -31,16 +31,18 @@ class RegExExecutorFwd : public RegExExecutorSuccinct {
                 continue;
               Range range = succinct_core_->FwdSearch(std::string(1, c));
               if (!IsEmpty(range))
-                results.insert(ResultEntry(range, 1));
+                results.push_back(ResultEntry(range, 1));
             }
+            Normalize(results);
             break;
           }
           case RegExPrimitiveType::RANGE: {
             for (char c : primitive->GetPrimitive()) {
               Range range = succinct_core_->FwdSearch(std::string(1, c));
               if (!IsEmpty(range))
-                results.insert(ResultEntry(range, 1));
+                results.push_back(ResultEntry(range, 1));
             }
+            Normalize(results);
             break;
           }
         }
@@ -56,11 +58,11 @@ class RegExExecutorFwd : public RegExExecutorSuccinct {
       case RegExType::CONCAT: {
         ResultSet left_results;
         Compute(left_results, ((RegExConcat *) regex)->getLeft());
-        for (auto left_result : left_results) {
-          ResultSet temp;
-          Concat(temp, ((RegExConcat *) regex)->getRight(), left_result);
-          Union(results, results, temp);
+        std::vector<ResultSet> temp(left_results.size());
+        for (size_t k = 0; k < left_results.size(); k++) {
+          Concat(temp[k], ((RegExConcat *) regex)->getRight(), left_results[k]);
         }
+        MultiwayUnion(results, temp);
         break;
       }
       case RegExType::REPEAT: {
@@ -84,12 +86,6 @@ class RegExExecutorFwd : public RegExExecutorSuccinct {
     }
   }
 
-  void Union(ResultSet &union_results, ResultSet first, ResultSet second) {
-    std::set_union(first.begin(), first.end(), second.begin(), second.end(),
-                   std::inserter(union_results, union_results.begin()),
-                   result_comparator);
-  }
-
   void Concat(ResultSet &concat_results, RegEx *r, ResultEntry left_result) {
     switch (r->GetType()) {
       case RegExType::BLANK: {
@@ -102,7 +98,7 @@ class RegExExecutorFwd : public RegExExecutorSuccinct {
             Range range = succinct_core_->ContinueFwdSearch(
                 p->GetPrimitive(), left_result.range_, left_result.length_);
             if (!IsEmpty(range))
-              concat_results.insert(
+              concat_results.push_back(
                   ResultEntry(
                       range, left_result.length_ + p->GetPrimitive().length()));
             break;
@@ -114,9 +110,10 @@ class RegExExecutorFwd : public RegExExecutorSuccinct {
               Range range = succinct_core_->ContinueFwdSearch(
                   std::string(1, c), left_result.range_, left_result.length_);
               if (!IsEmpty(range))
-                concat_results.insert(
+                concat_results.push_back(
                     ResultEntry(range, left_result.length_ + 1));
             }
+            Normalize(concat_results);
             break;
           }
           case RegExPrimitiveType::RANGE: {
@@ -124,9 +121,10 @@ class RegExExecutorFwd : public RegExExecutorSuccinct {
               Range range = succinct_core_->ContinueFwdSearch(
                   std::string(1, c), left_result.range_, left_result.length_);
               if (!IsEmpty(range))
-                concat_results.insert(
+                concat_results.push_back(
                     ResultEntry(range, left_result.length_ + 1));
             }
+            Normalize(concat_results);
             break;
           }
         }
@@ -142,11 +140,12 @@ class RegExExecutorFwd : public RegExExecutorSuccinct {
       case RegExType::CONCAT: {
         ResultSet right_left_results;
         Concat(right_left_results, ((RegExConcat *) r)->getLeft(), left_result);
-        for (auto right_left_result : right_left_results) {
-          ResultSet temp;
-          Concat(temp, ((RegExConcat *) r)->getRight(), right_left_result);
-          Union(concat_results, concat_results, temp);
+        std::vector<ResultSet> temp(right_left_results.size());
+        for (size_t k = 0; k < right_left_results.size(); k++) {
+          Concat(temp[k], ((RegExConcat *) r)->getRight(),
+                 right_left_results[k]);
         }
+        MultiwayUnion(concat_results, temp);
         break;
       }
       case RegExType::REPEAT: {
@@ -154,7 +153,8 @@ class RegExExecutorFwd : public RegExExecutorSuccinct {
         switch (rep_r->GetRepeatType()) {
           case RegExRepeatType::ZeroOrMore: {
             RepeatOneOrMore(concat_results, rep_r->GetInternal(), left_result);
-            concat_results.insert(left_result);
+            concat_results.push_back(left_result);
+            Normalize(concat_results);
             break;
           }
           case RegExRepeatType::OneOrMore: {
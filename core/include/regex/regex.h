@@ -15,7 +15,7 @@
 class SRegEx {
  public:
   typedef std::pair<size_t, size_t> OffsetLength;
-  typedef std::set<OffsetLength> RegExResults;
+  typedef std::vector<OffsetLength> RegExResults;   // Sorted, no duplicates
   typedef RegExResults::iterator RegExResultsIterator;
 
   SRegEx(std::string exp, SuccinctCore *s_core, bool opt = true) {
@@ -53,14 +53,17 @@ class SRegEx {
     RegExResultsIterator left_it, right_it;
     for (left_it = left.begin(); left_it != left.end(); left_it++) {
       OffsetLength search_candidate(left_it->first + left_it->second, 0);
-      RegExResultsIterator first_entry = right.lower_bound(search_candidate);
+      RegExResultsIterator first_entry = std::lower_bound(right.begin(),
+                                                          right.end(),
+                                                          search_candidate);
       for (right_it = first_entry; right_it != right.end(); right_it++) {
         size_t offset = left_it->first;
         size_t length = right_it->first - left_it->first + right_it->second;
-        wildcard_res.insert(OffsetLength(offset, length));
+        wildcard_res.push_back(OffsetLength(offset, length));
       }
     }
-    right = wildcard_res;
+    SortedVector::SortUnique(wildcard_res);
+    right.swap(wildcard_res);
   }
 
   void Subquery(RegExResults &result, std::string sub_expression) {
@@ -134,7 +137,7 @@ class SRegEx {
           if (ssexp == ".") {
             for (RegExResultsIterator it = last_results.begin();
                 it != last_results.end(); it++) {
-              range_results.insert(OffsetLength(it->first, it->second + 1));
+              range_results.push_back(OffsetLength(it->first, it->second + 1));
             }
           } else if (ssexp[ssexp.length() - 1] == '+') {
             std::string range = ssexp.substr(1, ssexp.length() - 3);
@@ -146,7 +149,7 @@ class SRegEx {
               while (true) {
                 c = s_core->CharAt(start_pos + len);
                 if (range.find(c) != std::string::npos) {
-                  range_results.insert(
+                  range_results.push_back(
                       OffsetLength(it->first, it->second + len));
                 } else {
                   break;
@@ -156,7 +159,7 @@ class SRegEx {
             }
           } else if (ssexp[ssexp.length() - 1] == '+') {
             std::string range = ssexp.substr(1, ssexp.length() - 3);
-            range_results.insert(last_results.begin(), last_results.end());
+            range_results = last_results;
             for (RegExResultsIterator it = last_results.begin();
                 it != last_results.end(); it++) {
               size_t start_pos = it->first + it->second - 1;
@@ -165,7 +168,7 @@ class SRegEx {
               while (true) {
                 c = s_core->CharAt(start_pos + len);
                 if (range.find(c) != std::string::npos) {
-                  range_results.insert(
+                  range_results.push_back(
                       OffsetLength(it->first, it->second + len));
                 } else {
                   break;
@@ -180,11 +183,12 @@ class SRegEx {
               size_t cur_pos = it->first + it->second;
               char c = s_core->CharAt(cur_pos);
               if (range.find(c) != std::string::npos) {
-                range_results.insert(OffsetLength(it->first, it->second + 1));
+                range_results.push_back(OffsetLength(it->first, it->second + 1));
               }
             }
           }
-          last_results = range_results;
+          SortedVector::SortUnique(range_results);
+          last_results.swap(range_results);
         } else {
 
           bool backtrack = false;
@@ -213,7 +217,7 @@ class SRegEx {
               if (ssexp == ".") {
                 for (RegExResultsIterator it = last_results.begin();
                     it != last_results.end(); it++) {
-                  range_results.insert(
+                  range_results.push_back(
                       OffsetLength(it->first - 1, it->second + 1));
                 }
               } else if (ssexp[ssexp.length() - 1] == '+') {
@@ -223,19 +227,19 @@ class SRegEx {
                   size_t cur_pos = it->first - 1;
                   char c = s_core->CharAt(cur_pos);
                   if (range.find(c) != std::string::npos) {
-                    range_results.insert(
+                    range_results.push_back(
                         OffsetLength(it->first - 1, it->second + 1));
                   }
                 }
               } else if (ssexp[ssexp.length() - 1] == '*') {
                 std::string range = ssexp.substr(1, ssexp.length() - 2);
-                range_results.insert(last_results.begin(), last_results.end());
+                range_results = last_results;
                 for (RegExResultsIterator it = last_results.begin();
                     it != last_results.end(); it++) {
                   size_t cur_pos = it->first - 1;
                   char c = s_core->CharAt(cur_pos);
                   if (range.find(c) != std::string::npos) {
-                    range_results.insert(
+                    range_results.push_back(
                         OffsetLength(it->first - 1, it->second + 1));
                   }
                 }
@@ -246,12 +250,13 @@ class SRegEx {
                   size_t cur_pos = it->first - 1;
                   char c = s_core->CharAt(cur_pos);
                   if (range.find(c) != std::string::npos) {
-                    range_results.insert(
+                    range_results.push_back(
                         OffsetLength(it->first - 1, it->second + 1));
                   }
                 }
               }
-              last_results = range_results;
+              SortedVector::SortUnique(range_results);
+              last_results.swap(range_results);
             }
           } else {
             RegExResults concat_results;
@@ -266,12 +271,13 @@ class SRegEx {
                 break;
 
               if (right_it->first == left_it->first + left_it->second) {
-                concat_results.insert(
+                concat_results.push_back(
                     OffsetLength(left_it->first,
                                  left_it->second + right_it->second));
               }
             }
-            last_results = concat_results;
+            SortedVector::SortUnique(concat_results);
+            last_results.swap(concat_results);
           }
         }
       }
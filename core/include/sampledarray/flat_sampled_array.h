@@ -4,6 +4,7 @@
 #include <ostream>
 
 #include "succinct_base.h"
+#include "utils/packed_array.h"
 #include "utils/succinct_allocator.h"
 #include "npa/npa.h"
 #include "sampled_array.h"
@@ -52,7 +53,7 @@ class FlatSampledArray : public SampledArray {
   virtual uint64_t operator[](uint64_t i) = 0;
 
   virtual uint64_t GetSampleAt(uint64_t i) {
-    return SuccinctBase::LookupBitmapArray(data_, i, data_bits_);
+    return data_reader_[i];
   }
 
   virtual size_t Serialize(std::ostream& out) {
@@ -87,13 +88,14 @@ class FlatSampledArray : public SampledArray {
     in_size += sizeof(uint32_t);
 
     in_size += SuccinctBase::DeserializeBitmap(&data_, in);
+    InitDataReader();
 
     return in_size;
   }
 
-  virtual size_t MemoryMap(std::string filename) {
+  virtual size_t MapBuffer(uint8_t *buf) {
     uint8_t *data_buf, *data_beg;
-    data_buf = data_beg = (uint8_t *) SuccinctUtils::MemoryMap(filename);
+    data_buf = data_beg = buf;
 
     data_size_ = *((uint64_t *) data_buf);
     data_buf += sizeof(uint64_t);
@@ -105,6 +107,7 @@ class FlatSampledArray : public SampledArray {
     data_buf += sizeof(uint32_t);
 
     data_buf += SuccinctBase::MemoryMapBitmap(&data_, data_buf);
+    InitDataReader();
 
     return data_buf - data_beg;
   }
@@ -118,11 +121,18 @@ class FlatSampledArray : public SampledArray {
   // Sample original array using the sampling scheme
   virtual void Sample(ArrayStream& original, uint64_t n) = 0;
 
+  // Resolve the reader for the sampled values once data_ and data_bits_ are
+  // set
+  void InitDataReader() {
+    data_reader_.Reset((data_ == NULL) ? NULL : data_->bitmap, data_bits_);
+  }
+
   bitmap_t *data_;
   uint8_t data_bits_;
   uint64_t data_size_;
   uint64_t original_size_;
   uint32_t sampling_rate_;
+  PackedArrayReader data_reader_;
 
   NPA *npa_;
   SuccinctAllocator succinct_allocator_;
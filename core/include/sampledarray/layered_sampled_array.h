@@ -244,9 +244,9 @@ class LayeredSampledArray : public SampledArray {
     return in_size;
   }
 
-  virtual size_t MemoryMap(std::string filename) {
+  virtual size_t MapBuffer(uint8_t *buf) {
     uint8_t *data, *data_beg;
-    data = data_beg = (uint8_t *) SuccinctUtils::MemoryMap(filename);
+    data = data_beg = buf;
 
     layer_map_ = *((uint64_t *) data);
     data += sizeof(uint64_t);
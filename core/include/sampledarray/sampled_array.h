@@ -17,9 +17,24 @@ class SampledArray {
     return operator[](i);
   }
 
+  // Access elements at each of the n indexes in idx, writing them to out;
+  // idx and out may point to the same buffer
+  virtual void LookupBatch(const uint64_t *idx, uint64_t *out, size_t n) {
+    for (size_t k = 0; k < n; k++) {
+      out[k] = operator[](idx[k]);
+    }
+  }
+
   virtual size_t Serialize(std::ostream& out) = 0;
   virtual size_t Deserialize(std::istream& in) = 0;
-  virtual size_t MemoryMap(std::string filename) = 0;
+
+  // Lay out the array over a buffer holding its serialized form; the buffer
+  // must outlive the array
+  virtual size_t MapBuffer(uint8_t *buf) = 0;
+
+  virtual size_t MemoryMap(std::string filename) {
+    return MapBuffer((uint8_t *) SuccinctUtils::MemoryMap(filename));
+  }
 
   SamplingScheme GetSamplingScheme() {
     return sampling_scheme_;
@@ -15,6 +15,10 @@ class SampledByIndexISA : public FlatSampledArray {
   // Access element at index i
   virtual uint64_t operator[](uint64_t i);
 
+  // Access elements at each of the n indexes in idx, advancing the NPA
+  // walks for independent indexes in lockstep
+  virtual void LookupBatch(const uint64_t *idx, uint64_t *out, size_t n);
+
  protected:
   // Sample by index for ISA using original SA
   virtual void Sample(ArrayStream& original, uint64_t n);
@@ -15,6 +15,10 @@ class SampledByIndexSA : public FlatSampledArray {
   // Access element at index i
   virtual uint64_t operator[](uint64_t i);
 
+  // Access elements at each of the n indexes in idx, advancing the NPA
+  // walks for independent indexes in lockstep
+  virtual void LookupBatch(const uint64_t *idx, uint64_t *out, size_t n);
+
  protected:
   // Sample original SA by index
   virtual void Sample(ArrayStream& sa_stream, uint64_t n);
@@ -39,22 +39,58 @@ class SuccinctBase {
   static const uint64_t kTwo32 = 1L << 32;
   static const uint64_t kAllOnes = ~(0ULL);
 
+  // Number of 1s (or 0s) between consecutive RANK9 select hints
+  static const uint64_t kSelectHintRate = 512;
+
+  // Number of independent lookups interleaved by the batched lookup functions
+  static const uint64_t kLookupBatchSize = 32;
+
   // Bitmap stored as a 64-bit array
   typedef struct _bitmap {
     uint64_t *bitmap;
     uint64_t size;
   } Bitmap;
 
+  // Dictionary encoding schemes
+  typedef enum dictionary_type {
+    // 16-bit blocks stored as (class, offset) pairs, with three-level rank
+    // directories; compact, but rank/select decode blocks through tables
+    CLASS_OFFSET_ENCODED = 0,
+    // Plain bitmap with interleaved 512-bit block counters and sampled select
+    // hints; rank/select take a handful of loads and hardware pop-counts
+    RANK9 = 1
+  } DictionaryType;
+
   // Dictionary stored as a bitmap with rank data structures
   typedef struct _dict {
+    DictionaryType type;
     Bitmap *B;
     uint64_t size;
+
+    // CLASS_OFFSET_ENCODED rank directories
     uint64_t *rank_l12;
     uint64_t *rank_l3;
     uint64_t *pos_l12;
     uint64_t *pos_l3;
+
+    // RANK9 block counters and select hints
+    uint64_t *rank_blocks;
+    uint64_t num_select1_hints;
+    uint64_t *select1_hints;
+    uint64_t num_select0_hints;
+    uint64_t *select0_hints;
   } Dictionary;
 
+  // Monotone (non-decreasing) sequence stored in Elias-Fano form: the low
+  // bits of each value are packed in a fixed-width bitmap array, and the high
+  // bits are stored in unary in a dictionary
+  typedef struct _ef {
+    uint64_t size;
+    uint64_t low_bits;
+    Bitmap *low;
+    Dictionary *high;
+  } EliasFanoVector;
+
   /* Constant tables used for encoding/decoding
    * dictionary and delta encoded vector */
   static uint16_t *decode_table[17];
@@ -105,6 +141,10 @@ class SuccinctBase {
   // Lookup a value in the bitmap, treating it as an array of fixed length
   static uint64_t LookupBitmapArray(Bitmap *B, uint64_t i, uint32_t b);
 
+  // Prefetch the word holding a value in the bitmap, treating it as an array
+  // of fixed length
+  static void PrefetchBitmapArray(Bitmap *B, uint64_t i, uint32_t b);
+
   // Set a value in the bitmap at a specified offset
   static void SetBitmapAtPos(Bitmap **B, uint64_t pos, uint64_t val,
                              uint32_t b);
@@ -123,7 +163,10 @@ class SuccinctBase {
 
   /* Dictionary access/modifier functions */
   // Create dictionary from a bitmap
-  static uint64_t CreateDictionary(Bitmap *B, Dictionary *D, SuccinctAllocator& s_allocator);
+  static uint64_t CreateDictionary(Bitmap *B, Dictionary *D,
+                                   SuccinctAllocator& s_allocator,
+                                   DictionaryType type =
+                                       DictionaryType::CLASS_OFFSET_ENCODED);
 
   // Get the 1-rank of the dictionary at the specified index
   static uint64_t GetRank1(Dictionary *D, uint64_t i);
@@ -146,12 +189,43 @@ class SuccinctBase {
   // Memory map dictionary
   static size_t MemoryMapDictionary(Dictionary **D, uint8_t *buf);
 
+  /* Elias-Fano vector access/modifier functions */
+  // Create Elias-Fano vector from a non-decreasing array of n values
+  static void CreateEliasFanoVector(EliasFanoVector *E, const uint64_t *A,
+                                    uint64_t n, SuccinctAllocator& s_allocator);
+
+  // Lookup the value at the specified index in the Elias-Fano vector
+  static uint64_t LookupEliasFanoVector(EliasFanoVector *E, uint64_t i);
+
+  // Get the index of the last value <= val in the Elias-Fano vector, or -1 if
+  // there is no such value
+  static int64_t GetPredecessor(EliasFanoVector *E, uint64_t val);
+
+  // Serialize Elias-Fano vector to output stream
+  static size_t SerializeEliasFanoVector(EliasFanoVector *E, std::ostream& out);
+
+  // Deserialize Elias-Fano vector from input stream
+  static size_t DeserializeEliasFanoVector(EliasFanoVector *E,
+                                           std::istream& in);
+
+  // Memory map Elias-Fano vector
+  static size_t MemoryMapEliasFanoVector(EliasFanoVector **E, uint8_t *buf);
+
+  // Destroy an Elias-Fano vector; its arrays are freed only if owns_data is
+  // set, i.e., if it was created or deserialized rather than memory mapped
+  static void DestroyEliasFanoVector(EliasFanoVector **E,
+                                     SuccinctAllocator& s_allocator,
+                                     bool owns_data);
+
   // Get size of bitmap
   static size_t BitmapSize(Bitmap *B);
 
   // Get size of dictionary
   static size_t DictionarySize(Dictionary *D);
 
+  // Get size of Elias-Fano vector
+  static size_t EliasFanoVectorSize(EliasFanoVector *E);
+
   // Get size of vector
   static size_t VectorSize(std::vector<uint64_t> &v);
 
@@ -164,6 +238,26 @@ class SuccinctBase {
  private:
   static void InitTables();
 
+  /* RANK9 dictionary functions */
+  static uint64_t CreateRank9Dictionary(Bitmap *B, Dictionary *D,
+                                        SuccinctAllocator& s_allocator);
+
+  static uint64_t GetRank1Rank9(Dictionary *D, uint64_t i);
+
+  static uint64_t GetSelect1Rank9(Dictionary *D, uint64_t i);
+
+  static uint64_t GetSelect0Rank9(Dictionary *D, uint64_t i);
+
+  static size_t SerializeRank9Dictionary(Dictionary *D, std::ostream& out);
+
+  static size_t DeserializeRank9Dictionary(Dictionary *D, std::istream& in);
+
+  static size_t MemoryMapRank9Dictionary(Dictionary *D, uint8_t *buf);
+
+  // Marks a serialized RANK9 dictionary; CLASS_OFFSET_ENCODED dictionaries
+  // start with their size in bits instead, which can never take this value
+  static const uint64_t kRank9Marker = kAllOnes;
+
 };
 
 #endif
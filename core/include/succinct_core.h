@@ -21,9 +21,20 @@
 #include "sampledarray/sampled_by_value_sa.h"
 #include "succinct_base.h"
 #include "utils/array_stream.h"
+#include "utils/succinct_container.h"
 #include "utils/divsufsortxx.h"
 #include "utils/divsufsortxx_utility.h"
-
+#include "utils/numa_utils.h"
+#include "utils/page_warmer.h"
+#include "utils/parallel_suffix_sort.h"
+
+// CONSTRUCT_MEMORY_MAPPED builds the same structures as CONSTRUCT_IN_MEMORY,
+// but keeps the uncompressed input, SA, ISA and NPA in temporary MAP_SHARED
+// file mappings rather than on the heap, so the kernel may write them back
+// and evict them. It is not external-memory construction: the arrays are
+// still built and read in random order, so construction only stays fast
+// while they fit in the page cache; the compressed structures, and a
+// shard's keys and value offsets, are built in memory as before.
 typedef enum {
   CONSTRUCT_IN_MEMORY = 0,
   CONSTRUCT_MEMORY_MAPPED = 1,
@@ -33,7 +44,17 @@ typedef enum {
 
 class SuccinctCore : public SuccinctBase {
  public:
-  typedef std::map<char, std::pair<uint64_t, uint32_t>> AlphabetMap;
+  // Alphabet map entry for a character: the index of the first suffix
+  // starting with it, the id of its column, and whether it occurs in the
+  // input. The alphabet map holds an entry for every character, indexed by
+  // character, and is serialized and memory mapped as is.
+  typedef struct {
+    uint64_t col_start;
+    uint32_t col_id;
+    uint32_t present;
+  } AlphabetEntry;
+
+  static const uint32_t kAlphabetMapSize = 256;
   typedef std::pair<int64_t, int64_t> Range;
 
   /* Constructors */
@@ -47,7 +68,8 @@ class SuccinctCore : public SuccinctBase {
                    SamplingScheme::FLAT_SAMPLE_BY_INDEX,
                NPA::NPAEncodingScheme npa_encoding_scheme =
                    NPA::NPAEncodingScheme::ELIAS_GAMMA_ENCODED,
-               uint32_t sampling_range = 1024);
+               uint32_t sampling_range = 1024, uint32_t num_threads = 1,
+               const PageInConfig& page_in_config = PageInConfig());
 
   SuccinctCore() {
     this->alphabet_ = NULL;
@@ -56,9 +78,15 @@ class SuccinctCore : public SuccinctBase {
     this->npa_ = NULL;
     this->alphabet_size_ = 0;
     this->input_size_ = 0;
+    this->container_ = NULL;
+    this->page_warmer_ = NULL;
+    this->loaded_ = false;
   }
 
   virtual ~SuccinctCore() {
+    // Stop prefetching before the sections are unmapped
+    delete page_warmer_;
+    delete container_;
   }
 
   /* Lookup functions for each of the core data structures */
@@ -71,13 +99,30 @@ class SuccinctCore : public SuccinctBase {
   // Lookup ISA at index i
   uint64_t LookupISA(uint64_t i);
 
+  // Lookup NPA at each of the n indexes in idx
+  void LookupNPABatch(const uint64_t *idx, uint64_t *out, size_t n);
+
+  // Lookup SA at each of the n indexes in idx
+  void LookupSABatch(const uint64_t *idx, uint64_t *out, size_t n);
+
+  // Lookup ISA at each of the n indexes in idx
+  void LookupISABatch(const uint64_t *idx, uint64_t *out, size_t n);
+
+  // Lookup SA at every index in the range [first, second]
+  void LookupSARange(Range range, int64_t *out);
+
   // Get index of value v in C
   uint64_t LookupC(uint64_t val);
 
   // Get the character at index i
   char CharAt(uint64_t i);
 
-  // Serialize succinct data structures
+  // Extract len characters of the input into out, starting with the first
+  // character of the suffix at index idx of the suffix array; returns the
+  // index of the suffix for the last character extracted
+  uint64_t ExtractChars(uint64_t idx, uint64_t len, char *out);
+
+  // Serialize succinct data structures into a single-file container
   virtual size_t Serialize(const std::string& filename);
 
   // Deserialize succinct data structures
@@ -86,6 +131,18 @@ class SuccinctCore : public SuccinctBase {
   // Memory map succinct data structures
   virtual size_t MemoryMap(const std::string& filename);
 
+  // False if the data structures could not be deserialized or memory mapped,
+  // e.g., because the file is missing or corrupt; the other methods must not
+  // be called then
+  bool IsLoaded();
+
+  // Set how the pages of each section are brought in when memory mapped
+  void SetPageInConfig(const PageInConfig& page_in_config);
+
+  // Block until the sections prefetched in the background are faulted in;
+  // returns the number of bytes prefetched
+  size_t WaitForPrefetch();
+
   // Get size of original input
   uint64_t GetOriginalSize();
 
@@ -112,6 +169,21 @@ class SuccinctCore : public SuccinctBase {
   Range BwdSearch(std::string mgram);
   Range ContinueBwdSearch(std::string mgram, Range range);
 
+  // Narrow range, the range of suffixes that follow p[0..len) in the input,
+  // to the range of suffixes prefixed by p[0..len)
+  Range ContinueBwdSearch(const char *p, uint64_t len, Range range);
+
+  // Get the range of suffixes starting with c; empty if c is not in the
+  // input
+  Range GetColumnRange(char c) {
+    const AlphabetEntry &entry = alphabet_map_[(uint8_t) c];
+    if (!entry.present || entry.col_id >= alphabet_size_)
+      return Range(0, -1);
+    return Range(entry.col_start,
+                 alphabet_map_[(uint8_t) alphabet_[entry.col_id + 1]].col_start
+                     - 1);
+  }
+
   Range FwdSearch(const std::string& mgram);
   Range ContinueFwdSearch(const std::string& mgram, Range range, size_t len);
 
@@ -123,21 +195,29 @@ class SuccinctCore : public SuccinctBase {
                 NPA::NPAEncodingScheme npa_encoding_scheme,
                 uint32_t sampling_range);
 
-  // Constructs the core data structures
+  // Constructs the core data structures; the suffix array is built with
+  // num_threads threads. If memory_map is set, the input, SA, ISA and NPA
+  // are kept in memory-mapped temporary files instead of memory.
   void Construct(const std::string& filename, uint32_t sa_sampling_rate,
                  uint32_t isa_sampling_rate, uint32_t npa_sampling_rate,
                  uint32_t context_len, SamplingScheme sa_sampling_scheme,
                  SamplingScheme isa_sampling_scheme,
                  NPA::NPAEncodingScheme npa_encoding_scheme,
-                 uint32_t sampling_range);
-
-  // Constructs the core data structures
+                 uint32_t sampling_range, uint32_t num_threads = 1,
+                 bool memory_map = false);
+
+  // Constructs the core data structures; the suffix array is built with
+  // num_threads threads. If memory_map is set, input must have been mapped
+  // with SuccinctUtils::MemoryMapWritable, and the SA, ISA and NPA are kept
+  // in memory-mapped temporary files instead of memory. Takes ownership of
+  // input.
   void Construct(uint8_t* input, size_t input_size, uint32_t sa_sampling_rate,
                  uint32_t isa_sampling_rate, uint32_t npa_sampling_rate,
                  uint32_t context_len, SamplingScheme sa_sampling_scheme,
                  SamplingScheme isa_sampling_scheme,
                  NPA::NPAEncodingScheme npa_encoding_scheme,
-                 uint32_t sampling_range);
+                 uint32_t sampling_range, uint32_t num_threads = 1,
+                 bool memory_map = false);
 
  protected:
 
@@ -151,10 +231,32 @@ class SuccinctCore : public SuccinctBase {
 
   /* Auxiliary data structures */
   char *alphabet_;
-  AlphabetMap alphabet_map_;
+  AlphabetEntry *alphabet_map_;        // Entry for each character
   uint32_t alphabet_size_;             // Size of the input alphabet_
 
+  SuccinctContainer *container_;       // Container loaded from, if any
+  PageInConfig page_in_config_;        // Page-in policies of mapped sections
+  PageWarmer *page_warmer_;            // Prefetches sections, if any
+  bool loaded_;                        // Whether the last load succeeded
+
+  // Write each of the serialized data structures into a section
+  virtual size_t SerializeSections(SuccinctContainer::Writer& writer);
+
+  // Returns the section called name of the data structures serialized at
+  // path, read into memory if in_memory is set, and memory mapped
+  // otherwise with the page-in policy of the section; path is either a
+  // container or a directory with a file per section. The size of the
+  // section is stored in size, if given.
+  uint8_t *LoadSection(const std::string& path, const std::string& name,
+                       bool in_memory, size_t *size = NULL);
+
  private:
+  // Lay out the data structures over the sections serialized at path
+  size_t Load(const std::string& path, bool in_memory);
+
+  // Lay out a sampled array over its serialized section
+  size_t LoadSampledArray(SampledArray *A, const std::string& path,
+                          const std::string& name, bool in_memory);
 
   uint64_t ComputeContextValue(char* data, uint32_t i, uint32_t context_len) {
     uint64_t val = 0;
@@ -22,7 +22,9 @@ class SuccinctFile : public SuccinctCore {
                    SamplingScheme::FLAT_SAMPLE_BY_INDEX,
                NPA::NPAEncodingScheme npa_encoding_scheme =
                    NPA::NPAEncodingScheme::ELIAS_GAMMA_ENCODED,
-               uint32_t context_len = 3, uint32_t sampling_range = 1024);
+               uint32_t context_len = 3, uint32_t sampling_range = 1024,
+               uint32_t num_threads = 1,
+               const PageInConfig& page_in_config = PageInConfig());
 
   /*
    * Random access into the Succinct file with the specified offset
@@ -42,9 +44,19 @@ class SuccinctFile : public SuccinctCore {
   void Search(std::vector<int64_t>& result, const std::string& str);
 
   /*
-   * Get the offsets corresponding to matches of regex.
+   * Get a page of up to limit occurrence offsets of a string, after
+   * skipping offset occurrences; a negative limit gets all of the remaining
+   * occurrences. Pages follow SA order, so only the occurrences in the page
+   * are looked up.
    */
-  void RegexSearch(std::set<std::pair<size_t, size_t>>& results, const std::string& query);
+  void Search(std::vector<int64_t>& result, const std::string& str,
+              int64_t offset, int64_t limit);
+
+  /*
+   * Get the (offset, length) matches of regex, in increasing order.
+   */
+  void RegexSearch(std::vector<std::pair<size_t, size_t>>& results,
+                   const std::string& query);
 
  private:
   // std::pair<int64_t, int64_t> GetRangeSlow(const char *str, uint64_t len);
@@ -29,18 +29,15 @@ class SuccinctSemistructuredShard : public SuccinctShard {
                                        uint32_t sampling_range = 1024)
       : SuccinctShard() {
     switch (s_mode) {
-      case SuccinctMode::CONSTRUCT_IN_MEMORY: {
+      case SuccinctMode::CONSTRUCT_IN_MEMORY:
+      case SuccinctMode::CONSTRUCT_MEMORY_MAPPED: {
         std::string formatted = Format(filename);
         Construct(formatted, sa_sampling_rate, isa_sampling_rate,
                   npa_sampling_rate, context_len, sa_sampling_scheme,
-                  isa_sampling_scheme, npa_encoding_scheme, sampling_range);
+                  isa_sampling_scheme, npa_encoding_scheme, sampling_range, 1,
+                  s_mode == SuccinctMode::CONSTRUCT_MEMORY_MAPPED);
         invalid_offsets_ = new Bitmap;
-        InitBitmap(&invalid_offsets_, keys_.size(), s_allocator);
-        break;
-      }
-      case SuccinctMode::CONSTRUCT_MEMORY_MAPPED: {
-        fprintf(stderr, "Unsupported mode.\n");
-        assert(0);
+        InitBitmap(&invalid_offsets_, GetNumKeys(), s_allocator);
         break;
       }
       case SuccinctMode::LOAD_IN_MEMORY: {
@@ -48,32 +45,6 @@ class SuccinctSemistructuredShard : public SuccinctShard {
                  context_len, sa_sampling_scheme, isa_sampling_scheme,
                  npa_encoding_scheme, sampling_range);
         Deserialize(filename);
-
-        // Read keys, value offsets, and invalid bitmap from file
-        std::ifstream keyval(filename + "/keyval");
-
-        // Read keys
-        size_t keys_size;
-        keyval.read(reinterpret_cast<char *>(&keys_size), sizeof(size_t));
-        keys_.reserve(keys_size);
-        for (size_t i = 0; i < keys_size; i++) {
-          uint64_t key;
-          keyval.read(reinterpret_cast<char *>(&key), sizeof(int64_t));
-          keys_.push_back(key);
-        }
-
-        // Read values
-        size_t value_offsets_size;
-        keyval.read(reinterpret_cast<char *>(&value_offsets_size), sizeof(size_t));
-        value_offsets_.reserve(value_offsets_size);
-        for (size_t i = 0; i < value_offsets_size; i++) {
-          uint64_t value_offset;
-          keyval.read(reinterpret_cast<char *>(&value_offset), sizeof(int64_t));
-          value_offsets_.push_back(value_offset);
-        }
-
-        // Read bitmap
-        SuccinctBase::DeserializeBitmap(&invalid_offsets_, keyval);
         break;
       }
       case SuccinctMode::LOAD_MEMORY_MAPPED: {
@@ -81,28 +52,6 @@ class SuccinctSemistructuredShard : public SuccinctShard {
                  context_len, sa_sampling_scheme, isa_sampling_scheme,
                  npa_encoding_scheme, sampling_range);
         MemoryMap(filename);
-        uint8_t *data, *data_beg;
-        data = data_beg = (uint8_t *) SuccinctUtils::MemoryMap(
-            filename + "/keyval");
-
-        // Read keys
-        size_t keys_size = *((size_t *) data);
-        data += sizeof(size_t);
-        buf_allocator<int64_t> key_allocator((int64_t *) data);
-        keys_ = std::vector<int64_t>((int64_t *) data,(int64_t *) data + keys_size, key_allocator);
-        data += (sizeof(int64_t) * keys_size);
-
-        // Read values
-        size_t value_offsets_size = *((size_t *) data);
-        data += sizeof(size_t);
-        buf_allocator<int64_t> value_offsets_allocator((int64_t *) data);
-        value_offsets_ = std::vector<int64_t>(
-            (int64_t *) data, (int64_t *) data + value_offsets_size,
-            value_offsets_allocator);
-        data += (sizeof(int64_t) * value_offsets_size);
-
-        // Read bitmap
-        data += SuccinctBase::MemoryMapBitmap(&invalid_offsets_, data);
         break;
       }
     }
@@ -119,7 +68,7 @@ class SuccinctSemistructuredShard : public SuccinctShard {
     return Count(query);
   }
 
-  void SearchAttribute(std::set<int64_t> &keys, const std::string &attr_key,
+  void SearchAttribute(std::vector<int64_t> &keys, const std::string &attr_key,
                        const std::string &attr_val) {
     if (attr_key_to_delimiter_map_.find(attr_key)
         == attr_key_to_delimiter_map_.end())
@@ -177,6 +126,7 @@ class SuccinctSemistructuredShard : public SuccinctShard {
     std::ifstream infile = std::ifstream(filename);
     std::ofstream formatted = std::ofstream(outf);
     std::string line;
+    std::vector<uint64_t> keys, value_offsets;
     int64_t line_no = 0;
     while (std::getline(infile, line)) {
       if (line_no != 0) {
@@ -186,8 +136,8 @@ class SuccinctSemistructuredShard : public SuccinctShard {
       std::stringstream linestream(line);
       std::string attr_val_pair;
       int64_t attr_val_no = 1;
-      keys_.push_back(line_no);
-      value_offsets_.push_back(formatted.tellp());
+      keys.push_back(line_no);
+      value_offsets.push_back(formatted.tellp());
       while (std::getline(linestream, attr_val_pair, delim)) {
         std::string::size_type pos = attr_val_pair.find('=');
         if (pos != std::string::npos) {
@@ -219,6 +169,7 @@ class SuccinctSemistructuredShard : public SuccinctShard {
     }
     formatted.close();
     infile.close();
+    CreateKeyValue(keys, value_offsets);
     return outf;
   }
 
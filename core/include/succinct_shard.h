@@ -1,6 +1,7 @@
 #ifndef SUCCINCT_SHARD_H
 #define SUCCINCT_SHARD_H
 
+#include <algorithm>
 #include <cstdint>
 #include <string>
 #include <cstring>
@@ -19,6 +20,7 @@
 
 #include "regex/regex.h"
 #include "succinct_core.h"
+#include "utils/sorted_vector.h"
 
 class SuccinctShard : public SuccinctCore {
  public:
@@ -29,15 +31,22 @@ class SuccinctShard : public SuccinctCore {
                 SamplingScheme sa_sampling_scheme = SamplingScheme::FLAT_SAMPLE_BY_INDEX,
                 SamplingScheme isa_sampling_scheme = SamplingScheme::FLAT_SAMPLE_BY_INDEX,
                 NPA::NPAEncodingScheme npa_encoding_scheme = NPA::NPAEncodingScheme::ELIAS_GAMMA_ENCODED,
-                uint32_t context_len = 3, uint32_t sampling_range = 1024);
+                uint32_t context_len = 3, uint32_t sampling_range = 1024,
+                uint32_t num_threads = 1,
+                const PageInConfig& page_in_config = PageInConfig());
 
   SuccinctShard()
       : SuccinctCore() {
     id_ = 0;
+    keys_ = nullptr;
+    value_offsets_ = nullptr;
     invalid_offsets_ = nullptr;
+    has_invalid_values_ = false;
+    owns_key_value_ = false;
+    key_value_buf_ = nullptr;
   }
 
-  ~SuccinctShard() override = default;
+  ~SuccinctShard() override;
 
   uint32_t GetSASamplingRate();
 
@@ -51,9 +60,24 @@ class SuccinctShard : public SuccinctCore {
 
   void Access(std::string &result, int64_t key, int32_t offset, int32_t len);
 
-  int64_t Count(const std::string &str);
-
-  void Search(std::set<int64_t> &result, const std::string &str);
+  // Count the keys whose values contain str. If approximate is set, the
+  // occurrences of str are counted instead (see FlatCount); this is an upper
+  // bound on the number of keys that needs no SA lookups.
+  int64_t Count(const std::string &str, bool approximate = false);
+
+  // Get the keys whose values contain str, in increasing order
+  void Search(std::vector<int64_t> &result, const std::string &str);
+
+  // Get a page of up to limit keys whose values contain str, after skipping
+  // offset keys; a negative limit gets all of the remaining keys. Pages
+  // follow the SA order of the last occurrence of str in each value, so
+  // only the occurrences that make it into the page are looked up in the
+  // SA; the keys within a page are sorted. Successive pages (offset +=
+  // limit) hold each key exactly once. A page walks every occurrence up to
+  // its end, skipped ones included; the walks are bounded by the cost of
+  // looking up the SA for every occurrence of str.
+  void Search(std::vector<int64_t> &result, const std::string &str,
+              int64_t offset, int64_t limit);
 
   int64_t FlatCount(const std::string &str);
 
@@ -61,14 +85,12 @@ class SuccinctShard : public SuccinctCore {
 
   void FlatExtract(std::string &result, int64_t offset, int64_t len);
 
-  void RegexSearch(std::set<std::pair<size_t, size_t>> &result,
+  // Get the (offset, length) matches of the regex, in increasing order
+  void RegexSearch(std::vector<std::pair<size_t, size_t>> &result,
                    const std::string &str, bool opt = true);
 
   void RegexCount(std::vector<size_t> &result, const std::string &str);
 
-  // Serialize succinct data structures
-  size_t Serialize(const std::string &path) override;
-
   // Deserialize succinct data structures
   size_t Deserialize(const std::string &path) override;
 
@@ -82,14 +104,78 @@ class SuccinctShard : public SuccinctCore {
   int64_t GetKeyPos(int64_t value_offset);
   int64_t GetValueOffsetPos(int64_t key);
 
+  // Get the value offset at the specified position; the position one past
+  // the last value maps to the end of the input
+  int64_t GetValueOffset(int64_t pos);
+
+  // Extract len characters of the input starting at offset into out; the
+  // ISA is looked up again at each sampled position instead of following
+  // the NPA
+  void ExtractValue(int64_t offset, int64_t len, char *out);
+
+  // Check if any of the values are marked invalid
+  bool HasInvalidValues();
+
+  // Follow the occurrence at SA index i through the NPA to the newline (or
+  // the input end, at SA index input_end) ending its value, unless another
+  // occurrence in range is met first. Returns 1 if i is the last occurrence
+  // in its value, 0 if it is not, and -1 if more than budget steps are
+  // needed; budget is decremented by the steps taken.
+  int32_t IsLastInValue(int64_t i, std::pair<int64_t, int64_t> range,
+                        std::pair<int64_t, int64_t> delimiters,
+                        int64_t input_end, uint64_t &budget);
+
+  // Count the values holding the occurrences in range, by counting the last
+  // occurrence in each value (see IsLastInValue). Returns -1 if the walks
+  // get longer than looking up the SA for every occurrence, or if any
+  // values are invalid.
+  int64_t CountValueEnds(std::pair<int64_t, int64_t> range);
+
+  // Mark whether each occurrence in range is the last in its value (see
+  // IsLastInValue), by looking up the offsets of all of them in the SA
+  void FindLastInValues(std::pair<int64_t, int64_t> range,
+                        std::vector<bool> &last);
+
+  // Count the values holding the occurrences in range, by looking up their
+  // offsets in the SA
+  int64_t CountValueOffsets(std::pair<int64_t, int64_t> range);
+
   // std::pair<int64_t, int64_t> get_range_slow(const char *str, uint64_t len);
   std::pair<int64_t, int64_t> GetRange(const char *str, uint64_t len);
 
   uint64_t ComputeContextValue(const char *str, uint64_t pos);
 
-  std::vector<int64_t> keys_;
-  std::vector<int64_t> value_offsets_;
+  // Create compressed keys and value offsets from sorted arrays
+  void CreateKeyValue(const std::vector<uint64_t> &keys,
+                      const std::vector<uint64_t> &value_offsets);
+
+  // Write the core data structures, followed by a keyval section
+  size_t SerializeSections(SuccinctContainer::Writer &writer) override;
+
+  // Serialize keys, value offsets and invalid bitmap
+  size_t SerializeKeyValue(std::ostream &out);
+
+  // Deserialize keys, value offsets and invalid bitmap
+  size_t DeserializeKeyValue(std::istream &in);
+
+  // Memory map keys, value offsets and invalid bitmap; keys and value
+  // offsets are read directly from the mapped buffer
+  size_t MemoryMapKeyValue(uint8_t *buf);
+
+  // Lay out keys, value offsets, and invalid bitmap over the keyval section
+  // serialized at path, if the core data structures were loaded; returns 0
+  // and marks the shard as not loaded if the section could not be loaded
+  size_t LoadKeyValue(const std::string &path, bool in_memory);
+
+  // Count the values marked invalid in the invalid bitmap
+  uint64_t CountInvalidValues();
+
+  EliasFanoVector *keys_;
+  EliasFanoVector *value_offsets_;
   Bitmap *invalid_offsets_;
+  bool has_invalid_values_;            // Any bit of invalid_offsets_ set
+  bool owns_key_value_;                // Keys, offsets and bitmap allocated
+  uint8_t *key_value_buf_;             // Keyval section read into memory
   uint32_t id_;
 };
 
@@ -0,0 +1,116 @@
+#ifndef CONNECTION_POOL_H
+#define CONNECTION_POOL_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*
+ * Thread-safe pool of connections to a set of shards, shared by all the
+ * handlers of a server. A handler leases a connection to each shard it
+ * sends requests to, and gives it back once no reply is outstanding on it;
+ * idle connections are reused by later leases. The number of connections to
+ * a shard thus follows the number of requests running on it at once, rather
+ * than the number of clients.
+ *
+ * Leases are exclusive by design, although replies carry the sequence id
+ * of their request and could be matched to it on a shared connection: a
+ * handler then owns every reply it polls for, and can drop a connection
+ * whose reply missed its deadline without affecting other requests.
+ *
+ * Idle connections are checked before they are leased again, and those
+ * that fail the check, such as connections closed by a query server that
+ * restarted, are discarded. The pool keeps at most max_idle idle
+ * connections to each shard, and closes those that stay idle for longer
+ * than idle_timeout_ms, so that a burst of requests does not leave
+ * connections open to the query servers for good.
+ */
+template<typename Connection>
+class ConnectionPool {
+ public:
+  typedef std::function<std::shared_ptr<Connection>(uint32_t)> Connector;
+  typedef std::function<bool(Connection&)> Checker;
+  typedef std::chrono::steady_clock Clock;
+
+  static const uint32_t kDefaultMaxIdle = 64;
+  static const int64_t kDefaultIdleTimeoutMs = 60000;
+
+  // Pool of connections to num_shards shards, opened with connect(shard);
+  // idle connections are reused only if check(connection) holds, if set
+  ConnectionPool(uint32_t num_shards, Connector connect,
+                 Checker check = Checker(),
+                 uint32_t max_idle = kDefaultMaxIdle,
+                 int64_t idle_timeout_ms = kDefaultIdleTimeoutMs)
+      : idle_(num_shards),
+        connect_(connect),
+        check_(check),
+        max_idle_(max_idle),
+        idle_timeout_(std::chrono::milliseconds(idle_timeout_ms)) {
+  }
+
+  // Take an idle connection to shard that passes the check, or open a new
+  // one if there is none; throws if the connection cannot be opened
+  std::shared_ptr<Connection> Lease(uint32_t shard) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::vector<IdleConnection>& idle = idle_.at(shard);
+      Expire(idle);
+      while (!idle.empty()) {
+        std::shared_ptr<Connection> connection = idle.back().connection;
+        idle.pop_back();
+        if (!check_ || check_(*connection))
+          return connection;
+      }
+    }
+    return connect_(shard);
+  }
+
+  // Give back a connection to shard, with no reply outstanding on it; the
+  // connection is closed instead if the pool already holds max_idle idle
+  // connections to shard
+  void Return(uint32_t shard, std::shared_ptr<Connection> connection) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<IdleConnection>& idle = idle_.at(shard);
+    Expire(idle);
+    if (idle.size() >= max_idle_)
+      return;
+    IdleConnection entry;
+    entry.connection = connection;
+    entry.since = Clock::now();
+    idle.push_back(entry);
+  }
+
+ private:
+  struct IdleConnection {
+    std::shared_ptr<Connection> connection;
+    Clock::time_point since;            // When it was returned
+  };
+
+  // Close the connections in idle that have been idle for too long; idle
+  // is ordered by the time they were returned
+  void Expire(std::vector<IdleConnection>& idle) {
+    Clock::time_point oldest = Clock::now() - idle_timeout_;
+    size_t expired = 0;
+    while (expired < idle.size() && idle[expired].since < oldest)
+      expired++;
+    idle.erase(idle.begin(), idle.begin() + expired);
+  }
+
+  std::mutex mutex_;
+  std::vector<std::vector<IdleConnection>> idle_;
+  Connector connect_;
+  Checker check_;
+  uint32_t max_idle_;
+  Clock::duration idle_timeout_;
+};
+
+template<typename Connection>
+const uint32_t ConnectionPool<Connection>::kDefaultMaxIdle;
+
+template<typename Connection>
+const int64_t ConnectionPool<Connection>::kDefaultIdleTimeoutMs;
+
+#endif /* CONNECTION_POOL_H */
@@ -23,6 +23,9 @@
 #define BITS2BLOCKS(bits) \
     (((bits) % 64 == 0) ? ((bits) / 64) : (((bits) / 64) + 1))
 
+/* Software prefetch for reads */
+#define PREFETCH(addr)  __builtin_prefetch((addr), 0, 1)
+
 /* Pop-count Constants */
 #define m1   0x5555555555555555 //binary: 0101...
 #define m2   0x3333333333333333 //binary: 00110011..
@@ -32,5 +35,6 @@
 #define m32  0x00000000ffffffff //binary: 32 zeros, 32 ones
 #define hff  0xffffffffffffffff //binary: all ones
 #define h01  0x0101010101010101 //the sum of 256 to the power of 0,1,2,3...
+#define h80  0x8080808080808080 //the most significant bit of each byte
 
 #endif
@@ -0,0 +1,34 @@
+#ifndef NUMA_UTILS_H
+#define NUMA_UTILS_H
+
+#include <cstddef>
+#include <vector>
+
+/*
+ * Placement of threads and memory on NUMA nodes, through the kernel's
+ * memory policy and affinity system calls; systems without NUMA support
+ * behave as a single node.
+ */
+class NumaUtils {
+ public:
+  // Number of NUMA nodes
+  static int NumNodes();
+
+  // CPUs of node; false if node does not exist
+  static bool NodeCpus(int node, std::vector<int> *cpus);
+
+  // Restrict the calling thread to the CPUs of node, and allocate its
+  // memory on node where possible; threads it creates afterwards inherit
+  // both
+  static bool BindThread(int node);
+
+  // Bind the pages spanning size bytes at data to node, moving those that
+  // are already faulted in; the pages must not be shared with other
+  // allocations, such as those of the heap
+  static bool BindMemory(const void *data, size_t size, int node);
+
+  // Node holding the page at data; -1 if it is not faulted in
+  static int NodeOf(const void *data);
+};
+
+#endif /* NUMA_UTILS_H */
@@ -0,0 +1,208 @@
+#ifndef PACKED_ARRAY_H
+#define PACKED_ARRAY_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+// The AVX2 batch lookup is compiled on x86 with GCC or Clang whatever the
+// build flags, and picked at runtime on CPUs that support it
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PACKED_ARRAY_AVX2
+#include <immintrin.h>
+#endif
+
+#include "utils/definitions.h"
+
+/*
+ * Array of Bits-bit values packed into 64-bit words, in the same layout as
+ * SuccinctBase bitmap arrays: value i occupies bits [i * Bits, (i + 1) * Bits)
+ * of the bitmap, most significant bit first. Bitmaps written by
+ * SuccinctBase::SetBitmapArray can be read as is.
+ *
+ * Lookups read the words holding the first and last bit of the value, and
+ * combine them without branching; when Bits divides 64, values never
+ * straddle words and a single word is read. Batch lookups do the same for
+ * four values at a time with AVX2 gathers where the CPU supports them (see
+ * PackedArrayReader).
+ */
+template<uint32_t Bits>
+class PackedArray {
+ public:
+  static const uint64_t kMask = ~(0ULL) >> (64 - Bits);
+
+  // Lookup the value at index i
+  static uint64_t Lookup(const uint64_t *data, uint64_t i) {
+    uint64_t s = i * Bits, e = s + (Bits - 1);
+    uint64_t hi = (data[s / 64] << (s % 64)) >> (64 - Bits);
+    if (64 % Bits == 0)
+      return hi;
+    uint64_t lo = (data[e / 64] >> (63 - e % 64)) & kMask;
+    return hi | lo;
+  }
+
+  // Lookup the values at each of the n indexes in idx
+  static void LookupBatch(const uint64_t *data, const uint64_t *idx,
+                          uint64_t *out, size_t n) {
+    for (size_t k = 0; k < n; k++) {
+      out[k] = Lookup(data, idx[k]);
+    }
+  }
+
+#ifdef PACKED_ARRAY_AVX2
+  // LookupBatch with AVX2 gathers; the CPU must support AVX2
+  __attribute__((target("avx2")))
+  static void LookupBatchAVX2(const uint64_t *data, const uint64_t *idx,
+                              uint64_t *out, size_t n) {
+    size_t k = 0;
+    const __m256i last = _mm256_set1_epi64x(Bits - 1);
+    const __m256i word_mask = _mm256_set1_epi64x(63);
+    const __m256i mask = _mm256_set1_epi64x(kMask);
+    const long long *words = (const long long *) data;
+    for (; k + 4 <= n; k += 4) {
+      __m256i s = _mm256_set_epi64x(idx[k + 3] * Bits, idx[k + 2] * Bits,
+                                    idx[k + 1] * Bits, idx[k] * Bits);
+      __m256i e = _mm256_add_epi64(s, last);
+      __m256i w0 = _mm256_i64gather_epi64(words, _mm256_srli_epi64(s, 6), 8);
+      __m256i w1 = _mm256_i64gather_epi64(words, _mm256_srli_epi64(e, 6), 8);
+      __m256i hi = _mm256_srli_epi64(
+          _mm256_sllv_epi64(w0, _mm256_and_si256(s, word_mask)), 64 - Bits);
+      __m256i lo = _mm256_and_si256(
+          _mm256_srlv_epi64(
+              w1, _mm256_sub_epi64(word_mask, _mm256_and_si256(e, word_mask))),
+          mask);
+      _mm256_storeu_si256((__m256i *) (out + k), _mm256_or_si256(hi, lo));
+    }
+    for (; k < n; k++) {
+      out[k] = Lookup(data, idx[k]);
+    }
+  }
+#endif
+
+  // Prefetch the word holding the value at index i
+  static void Prefetch(const uint64_t *data, uint64_t i) {
+    PREFETCH(&data[(i * Bits) / 64]);
+  }
+};
+
+// Zero-width arrays hold no data; every value is 0
+template<>
+class PackedArray<0> {
+ public:
+  static uint64_t Lookup(const uint64_t *data, uint64_t i) {
+    return 0;
+  }
+
+  static void LookupBatch(const uint64_t *data, const uint64_t *idx,
+                          uint64_t *out, size_t n) {
+    for (size_t k = 0; k < n; k++) {
+      out[k] = 0;
+    }
+  }
+
+  static void Prefetch(const uint64_t *data, uint64_t i) {
+  }
+};
+
+typedef uint64_t (*PackedArrayLookupFn)(const uint64_t *data, uint64_t i);
+typedef void (*PackedArrayLookupBatchFn)(const uint64_t *data,
+                                         const uint64_t *idx, uint64_t *out,
+                                         size_t n);
+typedef void (*PackedArrayPrefetchFn)(const uint64_t *data, uint64_t i);
+
+// Whether the CPU runs PackedArray::LookupBatchAVX2
+inline bool PackedArrayHasAVX2() {
+#ifdef PACKED_ARRAY_AVX2
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+#else
+  return false;
+#endif
+}
+
+// Fills in the PackedArray functions for widths [0, Bits], with the AVX2
+// batch lookups if avx2 is set
+template<uint32_t Bits>
+struct PackedArrayTable {
+  static void Fill(PackedArrayLookupFn *lookup,
+                   PackedArrayLookupBatchFn *lookup_batch,
+                   PackedArrayPrefetchFn *prefetch, bool avx2) {
+    lookup[Bits] = &PackedArray<Bits>::Lookup;
+    lookup_batch[Bits] = &PackedArray<Bits>::LookupBatch;
+#ifdef PACKED_ARRAY_AVX2
+    if (avx2)
+      lookup_batch[Bits] = &PackedArray<Bits>::LookupBatchAVX2;
+#endif
+    prefetch[Bits] = &PackedArray<Bits>::Prefetch;
+    PackedArrayTable<Bits - 1>::Fill(lookup, lookup_batch, prefetch, avx2);
+  }
+};
+
+template<>
+struct PackedArrayTable<0> {
+  static void Fill(PackedArrayLookupFn *lookup,
+                   PackedArrayLookupBatchFn *lookup_batch,
+                   PackedArrayPrefetchFn *prefetch, bool avx2) {
+    lookup[0] = &PackedArray<0>::Lookup;
+    lookup_batch[0] = &PackedArray<0>::LookupBatch;
+    prefetch[0] = &PackedArray<0>::Prefetch;
+  }
+};
+
+/*
+ * Reader over a packed array whose width is only known at runtime (e.g., when
+ * it is read from a serialized file). The PackedArray specialization for the
+ * width is picked once, when the reader is reset, rather than on every lookup.
+ */
+class PackedArrayReader {
+ public:
+  PackedArrayReader() {
+    Reset(NULL, 0);
+  }
+
+  // Read bits-bit values from data
+  void Reset(const uint64_t *data, uint32_t bits) {
+    assert(bits <= 64);
+    const Specializations &specializations = GetSpecializations();
+    data_ = data;
+    lookup_ = specializations.lookup[bits];
+    lookup_batch_ = specializations.lookup_batch[bits];
+    prefetch_ = specializations.prefetch[bits];
+  }
+
+  uint64_t operator[](uint64_t i) const {
+    return lookup_(data_, i);
+  }
+
+  void LookupBatch(const uint64_t *idx, uint64_t *out, size_t n) const {
+    lookup_batch_(data_, idx, out, n);
+  }
+
+  void Prefetch(uint64_t i) const {
+    prefetch_(data_, i);
+  }
+
+ private:
+  struct Specializations {
+    Specializations() {
+      PackedArrayTable<64>::Fill(lookup, lookup_batch, prefetch,
+                                 PackedArrayHasAVX2());
+    }
+
+    PackedArrayLookupFn lookup[65];
+    PackedArrayLookupBatchFn lookup_batch[65];
+    PackedArrayPrefetchFn prefetch[65];
+  };
+
+  static const Specializations& GetSpecializations() {
+    static const Specializations specializations;
+    return specializations;
+  }
+
+  const uint64_t *data_;
+  PackedArrayLookupFn lookup_;
+  PackedArrayLookupBatchFn lookup_batch_;
+  PackedArrayPrefetchFn prefetch_;
+};
+
+#endif /* PACKED_ARRAY_H */
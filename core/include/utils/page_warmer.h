@@ -0,0 +1,104 @@
+#ifndef PAGE_WARMER_H
+#define PAGE_WARMER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/*
+ * How the pages of a memory-mapped section are brought in: all of them
+ * before the section is used, on first access, or by a background thread
+ * while the section is already in use.
+ */
+typedef enum {
+  PAGE_IN_POPULATE = 0,
+  PAGE_IN_LAZY = 1,
+  PAGE_IN_PREFETCH = 2
+} PageInPolicy;
+
+/*
+ * Page-in policies of the memory-mapped sections of a shard, by section
+ * name, the bandwidth that background prefetching may use, and the NUMA
+ * node that the pages of every section are placed on.
+ */
+struct PageInConfig {
+  PageInConfig()
+      : default_policy(PAGE_IN_POPULATE),
+        prefetch_rate(0),
+        numa_node(-1) {
+  }
+
+  // Policy of the section called name
+  PageInPolicy GetPolicy(const std::string& name) const;
+
+  // Parses a policy followed by optional per-section overrides, such as
+  // "lazy" or "prefetch,metadata=populate,keyval=populate"; returns false
+  // if spec is malformed
+  static bool Parse(const std::string& spec, PageInConfig *config);
+
+  PageInPolicy default_policy;                 // Policy of other sections
+  std::map<std::string, PageInPolicy> policies;
+  uint64_t prefetch_rate;                      // Bytes/s; 0 for no limit
+  int numa_node;                               // -1 for no placement
+};
+
+/*
+ * Faults in memory-mapped ranges from a background thread, at most
+ * bytes_per_sec bytes per second, so that a mapping can serve queries
+ * while it warms up; pages are moved to numa_node as they are faulted in,
+ * if it is set. Ranges are warmed in the order they are added, and must
+ * stay mapped until the warmer is destroyed or Wait returns.
+ */
+class PageWarmer {
+ public:
+  explicit PageWarmer(uint64_t bytes_per_sec = 0, int numa_node = -1);
+  ~PageWarmer();
+
+  // Queue size bytes at data to be faulted in
+  void Add(const void *data, size_t size);
+
+  // Block until all of the queued ranges are faulted in
+  void Wait();
+
+  // Bytes faulted in so far
+  size_t BytesWarmed();
+
+  // Fault in size bytes at data before returning, reading ahead of the
+  // accesses
+  static void Populate(const void *data, size_t size);
+
+  // Advise the kernel on how the mapped pages of size bytes at data are
+  // read under policy: lazy sections are only read at random by queries,
+  // so their faults do not read ahead, while populated and prefetched
+  // sections are read in order first and keep the default read-ahead
+  static void Advise(const void *data, size_t size, PageInPolicy policy);
+
+  static const size_t kChunkSize = 1 << 20;
+
+ private:
+  struct Range {
+    const uint8_t *data;
+    size_t size;
+  };
+
+  void Run();
+
+  uint64_t bytes_per_sec_;
+  int numa_node_;
+  std::deque<Range> ranges_;
+  std::mutex mutex_;
+  std::condition_variable work_;
+  std::condition_variable done_;
+  bool busy_;
+  std::atomic<bool> stop_;
+  std::atomic<size_t> bytes_warmed_;
+  std::thread thread_;
+};
+
+#endif /* PAGE_WARMER_H */
@@ -0,0 +1,263 @@
+#ifndef PARALLEL_SUFFIX_SORT_H
+#define PARALLEL_SUFFIX_SORT_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/*
+ * Multi-threaded suffix array construction by prefix doubling.
+ *
+ * Suffixes are first bucketed on their first two symbols; each round then
+ * sorts every bucket that still holds more than one suffix on the rank of the
+ * suffix h positions ahead, and splits it into buckets sharing the first 2h
+ * symbols. Buckets are independent, so each round hands them out to threads
+ * largest first; a bucket too large for one thread is sorted by all of them.
+ * Suffixes running off the end of the text sort before all others, so the
+ * output is identical to divsufsortxx::constructSA.
+ *
+ * Besides SA, the sort takes a rank per suffix and, while a round runs, a
+ * (key, suffix) pair per suffix of the buckets being sorted; both are 32-bit
+ * for texts shorter than 4 GB, so at most 12n bytes, plus a merge buffer of
+ * up to half a bucket sorted by all threads.
+ */
+namespace parallelsa {
+
+typedef std::pair<int64_t, int64_t> Bucket;         // [first, last)
+
+// Buckets at least this large are sorted by all threads when they would
+// otherwise keep one thread busy for longer than the others
+const int64_t kMinParallelBucket = 1 << 12;
+
+// Runs f(t) for t in [0, num_threads), each on its own thread
+template<typename Function>
+void RunThreads(uint32_t num_threads, Function f) {
+  std::vector<std::thread> threads;
+  for (uint32_t t = 1; t < num_threads; t++) {
+    threads.emplace_back(f, t);
+  }
+  f(0);
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
+// Runs f(t, b, buckets[b]) for every bucket, on up to num_threads threads;
+// t is the thread running the call
+template<typename Function>
+void ForEachBucket(const std::vector<Bucket> &buckets, uint32_t num_threads,
+                   Function f) {
+  std::atomic<size_t> next(0);
+  RunThreads(std::min<size_t>(num_threads, buckets.size()), [&](uint32_t t) {
+    for (size_t b = next++; b < buckets.size(); b = next++) {
+      f(t, b, buckets[b]);
+    }
+  });
+}
+
+template<typename Rank>
+class SuffixSorter {
+ public:
+  typedef std::pair<Rank, Rank> KeyedSuffix;         // (key, suffix)
+
+  SuffixSorter(const uint8_t *text, int64_t n, int64_t *SA,
+               uint32_t num_threads)
+      : text_(text),
+        n_(n),
+        SA_(SA),
+        num_threads_(num_threads),
+        rank_(n),
+        keyed_(num_threads) {
+  }
+
+  void Sort() {
+    std::vector<Bucket> buckets = InitialBuckets();
+    for (h_ = 2; !buckets.empty(); h_ *= 2) {
+      // Hand out the largest buckets first to balance the threads
+      std::sort(buckets.begin(), buckets.end(),
+                [](const Bucket &a, const Bucket &b) {
+                  return a.second - a.first > b.second - b.first;
+                });
+
+      // Sort each bucket on the rank h positions ahead, marking where the
+      // keys change in SA; ranks are only read
+      int64_t total = 0;
+      for (auto &bucket : buckets) {
+        total += bucket.second - bucket.first;
+      }
+      size_t large = 0;
+      while (large < buckets.size() && num_threads_ > 1
+          && IsLarge(buckets[large], total)) {
+        SortBucket(buckets[large], num_threads_);
+        large++;
+      }
+      std::vector<Bucket> rest(buckets.begin() + large, buckets.end());
+      ForEachBucket(rest, num_threads_,
+                    [&](uint32_t t, size_t, const Bucket &bucket) {
+        SortBucket(bucket, keyed_[t]);
+      });
+      for (auto &keyed : keyed_) {
+        std::vector<KeyedSuffix>().swap(keyed);
+      }
+
+      // Split each bucket at the marks; only the bucket's own SA entries
+      // are read
+      std::vector<std::vector<Bucket>> split(buckets.size());
+      ForEachBucket(buckets, num_threads_,
+                    [&](uint32_t, size_t b, const Bucket &bucket) {
+        int64_t first = bucket.first;
+        for (int64_t j = bucket.first; j < bucket.second; j++) {
+          if (SA_[j] & kKeyChange) {
+            SA_[j] &= ~kKeyChange;
+            if (j - first > 1)
+              split[b].push_back(Bucket(first, j));
+            first = j;
+          }
+          rank_[SA_[j]] = first;
+        }
+        if (bucket.second - first > 1)
+          split[b].push_back(Bucket(first, bucket.second));
+      });
+
+      buckets.clear();
+      for (auto &s : split) {
+        buckets.insert(buckets.end(), s.begin(), s.end());
+      }
+    }
+  }
+
+ private:
+  // Set on SA entries whose key differs from the previous entry's, between
+  // sorting and splitting a bucket
+  static const int64_t kKeyChange = INT64_C(1) << 62;
+
+  // Bucket suffixes on their first two symbols; a missing second symbol
+  // sorts first. Returns the buckets holding more than one suffix.
+  std::vector<Bucket> InitialBuckets() {
+    const int64_t kNumKeys = 256 * 257;
+    std::vector<int64_t> bucket_start(kNumKeys + 1, 0);
+    auto initial_key = [&](int64_t i) {
+      return text_[i] * 257 + (i + 1 < n_ ? text_[i + 1] + 1 : 0);
+    };
+    for (int64_t i = 0; i < n_; i++) {
+      bucket_start[initial_key(i) + 1]++;
+    }
+    for (int64_t k = 0; k < kNumKeys; k++) {
+      bucket_start[k + 1] += bucket_start[k];
+    }
+
+    std::vector<Bucket> buckets;
+    for (int64_t k = 0; k < kNumKeys; k++) {
+      if (bucket_start[k + 1] - bucket_start[k] > 1)
+        buckets.push_back(Bucket(bucket_start[k], bucket_start[k + 1]));
+    }
+    std::vector<int64_t> next_pos(bucket_start.begin(), bucket_start.end() - 1);
+    for (int64_t i = 0; i < n_; i++) {
+      int64_t k = initial_key(i);
+      rank_[i] = bucket_start[k];
+      SA_[next_pos[k]++] = i;
+    }
+    return buckets;
+  }
+
+  // Whether bucket holds more than one thread's share of the total
+  bool IsLarge(const Bucket &bucket, int64_t total) {
+    int64_t size = bucket.second - bucket.first;
+    return size >= kMinParallelBucket && size * num_threads_ > total;
+  }
+
+  // Key of suffix i: one more than the rank h positions ahead, or 0 if the
+  // suffix ends before that
+  Rank Key(int64_t i) {
+    return i + h_ < n_ ? rank_[i + h_] + 1 : 0;
+  }
+
+  // Sort bucket on one thread, with keyed as scratch space
+  void SortBucket(const Bucket &bucket, std::vector<KeyedSuffix> &keyed) {
+    keyed.resize(bucket.second - bucket.first);
+    for (int64_t j = bucket.first; j < bucket.second; j++) {
+      keyed[j - bucket.first] = KeyedSuffix(Key(SA_[j]), SA_[j]);
+    }
+    std::sort(keyed.begin(), keyed.end());
+    WriteBack(bucket.first, keyed, 0, keyed.size());
+  }
+
+  // Sort bucket on num_threads threads: each sorts a slice, the slices are
+  // merged pairwise in parallel, and each thread writes back a slice
+  void SortBucket(const Bucket &bucket, uint32_t num_threads) {
+    std::vector<KeyedSuffix> keyed(bucket.second - bucket.first);
+    std::vector<size_t> bounds(num_threads + 1);
+    for (uint32_t t = 0; t <= num_threads; t++) {
+      bounds[t] = keyed.size() * t / num_threads;
+    }
+
+    RunThreads(num_threads, [&](uint32_t t) {
+      for (size_t k = bounds[t]; k < bounds[t + 1]; k++) {
+        int64_t i = SA_[bucket.first + k];
+        keyed[k] = KeyedSuffix(Key(i), i);
+      }
+      std::sort(keyed.begin() + bounds[t], keyed.begin() + bounds[t + 1]);
+    });
+    for (uint32_t width = 1; width < num_threads; width *= 2) {
+      uint32_t num_merges = (num_threads + 2 * width - 1) / (2 * width);
+      RunThreads(num_merges, [&](uint32_t m) {
+        uint32_t left = 2 * width * m;
+        uint32_t mid = std::min(left + width, num_threads);
+        uint32_t right = std::min(left + 2 * width, num_threads);
+        std::inplace_merge(keyed.begin() + bounds[left],
+                           keyed.begin() + bounds[mid],
+                           keyed.begin() + bounds[right]);
+      });
+    }
+    RunThreads(num_threads, [&](uint32_t t) {
+      WriteBack(bucket.first, keyed, bounds[t], bounds[t + 1]);
+    });
+  }
+
+  // Write the suffixes of keyed[begin, end) to SA from first + begin,
+  // marking the ones whose key changes
+  void WriteBack(int64_t first, const std::vector<KeyedSuffix> &keyed,
+                 size_t begin, size_t end) {
+    for (size_t k = begin; k < end; k++) {
+      int64_t suffix = keyed[k].second;
+      if (k == 0 || keyed[k].first != keyed[k - 1].first)
+        suffix |= kKeyChange;
+      SA_[first + k] = suffix;
+    }
+  }
+
+  const uint8_t *text_;
+  int64_t n_;
+  int64_t *SA_;
+  uint32_t num_threads_;
+  int64_t h_;
+
+  // The rank of a suffix is the first position of its bucket in SA
+  std::vector<Rank> rank_;
+  std::vector<std::vector<KeyedSuffix>> keyed_;     // Scratch per thread
+};
+
+template<typename Rank>
+const int64_t SuffixSorter<Rank>::kKeyChange;
+
+// Sorts the suffixes of text[0..n) into SA[0..n), using num_threads threads
+inline void constructSA(const uint8_t *text, int64_t n, int64_t *SA,
+                        uint32_t num_threads) {
+  if (n <= 0)
+    return;
+  num_threads = std::max<uint32_t>(num_threads, 1);
+
+  // Keys run up to n
+  if (n <= (int64_t) UINT32_MAX) {
+    SuffixSorter<uint32_t>(text, n, SA, num_threads).Sort();
+  } else {
+    SuffixSorter<int64_t>(text, n, SA, num_threads).Sort();
+  }
+}
+
+}  // namespace parallelsa
+
+#endif /* PARALLEL_SUFFIX_SORT_H */
@@ -0,0 +1,126 @@
+#ifndef REPLY_GATHER_H
+#define REPLY_GATHER_H
+
+#include <poll.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <vector>
+
+/*
+ * Collects the replies to requests sent out over a set of sockets, in the
+ * order they arrive rather than the order the requests went out. All sockets
+ * are polled together, and each one is handed to a callback that reads its
+ * reply as soon as the reply becomes readable, until every reply is in or a
+ * deadline passes.
+ */
+class ReplyGather {
+ public:
+  typedef std::chrono::steady_clock Clock;
+
+  // Deadline of a wait that never times out
+  static Clock::time_point NoDeadline() {
+    return Clock::time_point::max();
+  }
+
+  // Deadline timeout_ms milliseconds from now; none if timeout_ms <= 0
+  static Clock::time_point DeadlineIn(int64_t timeout_ms) {
+    if (timeout_ms <= 0)
+      return NoDeadline();
+    return Clock::now() + std::chrono::milliseconds(timeout_ms);
+  }
+
+  // Socket receive timeout that ends a read at the deadline, in whole
+  // milliseconds: 0, for reads that never time out, if there is no
+  // deadline, and at least 1 once the deadline has passed
+  static int RecvTimeoutMs(Clock::time_point deadline) {
+    if (deadline == NoDeadline())
+      return 0;
+    return std::max(TimeoutMs(deadline), 1);
+  }
+
+  // Whether nothing can be read from the socket fd right now. A socket
+  // with no request outstanding on it becomes readable only if its peer
+  // closed it, or sent data out of turn; either way it cannot be reused.
+  static bool IsQuiet(int fd) {
+    struct pollfd p;
+    p.fd = fd;
+    p.events = POLLIN;
+    p.revents = 0;
+    int ready;
+    do {
+      ready = poll(&p, 1, 0);
+    } while (ready < 0 && errno == EINTR);
+    return ready == 0;
+  }
+
+  // Wait for a reply on each socket in fds, and call on_reply(i) when the
+  // reply on fds[i] is readable; negative fds are skipped. Returns, in
+  // order, the indexes of the sockets whose reply missed the deadline or
+  // whose on_reply threw.
+  template<typename OnReply>
+  static std::vector<size_t> Wait(const std::vector<int> &fds,
+                                  Clock::time_point deadline,
+                                  OnReply on_reply) {
+    std::vector<struct pollfd> polled;
+    std::vector<size_t> index;
+    for (size_t i = 0; i < fds.size(); i++) {
+      if (fds[i] < 0)
+        continue;
+      struct pollfd p;
+      p.fd = fds[i];
+      p.events = POLLIN;
+      p.revents = 0;
+      polled.push_back(p);
+      index.push_back(i);
+    }
+
+    std::vector<size_t> missed;
+    while (!polled.empty()) {
+      int ready = poll(&polled[0], polled.size(), TimeoutMs(deadline));
+      if (ready < 0 && errno == EINTR)
+        continue;
+      if (ready <= 0)
+        break;
+
+      // Read the replies that are in, and keep polling for the rest
+      size_t k = 0;
+      for (size_t p = 0; p < polled.size(); p++) {
+        if (polled[p].revents == 0) {
+          polled[k] = polled[p];
+          index[k] = index[p];
+          k++;
+          continue;
+        }
+        try {
+          on_reply(index[p]);
+        } catch (std::exception &e) {
+          missed.push_back(index[p]);
+        }
+      }
+      polled.resize(k);
+      index.resize(k);
+    }
+
+    missed.insert(missed.end(), index.begin(), index.end());
+    std::sort(missed.begin(), missed.end());
+    return missed;
+  }
+
+ private:
+  // Poll timeout until the deadline, rounded up to whole milliseconds
+  static int TimeoutMs(Clock::time_point deadline) {
+    if (deadline == NoDeadline())
+      return -1;
+    int64_t left_us = std::chrono::duration_cast<std::chrono::microseconds>(
+        deadline - Clock::now()).count();
+    if (left_us <= 0)
+      return 0;
+    return (int) std::min<int64_t>((left_us + 999) / 1000, INT32_MAX);
+  }
+};
+
+#endif /* REPLY_GATHER_H */
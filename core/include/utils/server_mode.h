@@ -0,0 +1,85 @@
+#ifndef SERVER_MODE_H
+#define SERVER_MODE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+
+#include <thrift/TProcessor.h>
+#include <thrift/concurrency/PosixThreadFactory.h>
+#include <thrift/concurrency/ThreadManager.h>
+#include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/server/TNonblockingServer.h>
+#include <thrift/server/TThreadedServer.h>
+#include <thrift/transport/TBufferTransports.h>
+#include <thrift/transport/TNonblockingServerSocket.h>
+#include <thrift/transport/TServerSocket.h>
+
+/*
+ * How a server handles its connections. A threaded server runs a thread per
+ * connection. A pooled server watches every connection from one non-blocking
+ * I/O thread and hands each request to a fixed pool of workers, so that idle
+ * connections cost no thread; once max_pending requests wait for a worker,
+ * it turns away new connections until the backlog drains. Both use the
+ * framed transport, so clients need not know the mode.
+ *
+ * Shared by the query servers and aggregators of sharded and sharded-kv;
+ * unlike the rest of core, it needs the Thrift headers.
+ */
+enum ServerMode {
+  THREADED_SERVER = 0,
+  POOLED_SERVER = 1
+};
+
+struct ServerOptions {
+  ServerMode mode;
+  uint32_t num_workers;   // Workers of a pooled server
+  uint32_t max_pending;   // Requests waiting for a worker; 0 for no limit
+
+  ServerOptions() {
+    mode = THREADED_SERVER;
+    num_workers = std::max(std::thread::hardware_concurrency(), 1U);
+    max_pending = 0;
+  }
+};
+
+// Serve requests on port, with a processor from factory per connection
+inline void Serve(
+    const std::shared_ptr<apache::thrift::TProcessorFactory>& factory,
+    int port, const ServerOptions& options) {
+  using namespace ::apache::thrift::concurrency;
+  using namespace ::apache::thrift::protocol;
+  using namespace ::apache::thrift::server;
+  using namespace ::apache::thrift::transport;
+
+  std::shared_ptr<TProtocolFactory> protocol_factory(
+      new TBinaryProtocolFactory());
+  if (options.mode == THREADED_SERVER) {
+    std::shared_ptr<TServerSocket> server_transport(new TServerSocket(port));
+    std::shared_ptr<TFramedTransportFactory> transport_factory(
+        new TFramedTransportFactory());
+    TThreadedServer server(factory, server_transport, transport_factory,
+                           protocol_factory);
+    server.serve();
+    return;
+  }
+
+  std::shared_ptr<ThreadManager> workers =
+      ThreadManager::newSimpleThreadManager(options.num_workers,
+                                            options.max_pending);
+  workers->threadFactory(
+      std::shared_ptr<PosixThreadFactory>(new PosixThreadFactory()));
+  workers->start();
+
+  std::shared_ptr<TNonblockingServerSocket> server_transport(
+      new TNonblockingServerSocket(port));
+  TNonblockingServer server(factory, protocol_factory, server_transport,
+                            workers);
+  if (options.max_pending > 0) {
+    server.setMaxActiveProcessors(options.num_workers + options.max_pending);
+    server.setOverloadAction(T_OVERLOAD_CLOSE_ON_ACCEPT);
+  }
+  server.serve();
+}
+
+#endif
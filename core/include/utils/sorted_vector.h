@@ -0,0 +1,145 @@
+#ifndef SORTED_VECTOR_H
+#define SORTED_VECTOR_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <queue>
+#include <utility>
+#include <vector>
+
+/*
+ * Operations on result sets held as sorted vectors without duplicates,
+ * which replace node-based std::sets on the query paths: results are
+ * appended unsorted, sorted once, and combined with linear merges.
+ */
+class SortedVector {
+ public:
+  // Sort non-negative values with an LSD radix sort on 16-bit digits;
+  // digits above the largest value are skipped
+  static void RadixSort(std::vector<int64_t> &values) {
+    if (values.size() < kRadixSortThreshold) {
+      std::sort(values.begin(), values.end());
+      return;
+    }
+
+    int64_t max = *std::max_element(values.begin(), values.end());
+    std::vector<int64_t> buf(values.size());
+    std::vector<size_t> counts(kRadix + 1);
+    for (uint32_t shift = 0; shift < 64 && (max >> shift) != 0; shift += 16) {
+      std::fill(counts.begin(), counts.end(), 0);
+      for (int64_t value : values) {
+        counts[((value >> shift) & (kRadix - 1)) + 1]++;
+      }
+      for (size_t d = 0; d < kRadix; d++) {
+        counts[d + 1] += counts[d];
+      }
+      for (int64_t value : values) {
+        buf[counts[(value >> shift) & (kRadix - 1)]++] = value;
+      }
+      values.swap(buf);
+    }
+  }
+
+  // Sort values and drop duplicates
+  template<typename T, typename Compare = std::less<T>>
+  static void SortUnique(std::vector<T> &values, Compare comp = Compare()) {
+    std::sort(values.begin(), values.end(), comp);
+    Unique(values, comp);
+  }
+
+  // Sort non-negative values and drop duplicates
+  static void SortUnique(std::vector<int64_t> &values) {
+    RadixSort(values);
+    Unique(values, std::less<int64_t>());
+  }
+
+  // Drop duplicates from sorted values
+  template<typename T, typename Compare = std::less<T>>
+  static void Unique(std::vector<T> &values, Compare comp = Compare()) {
+    values.erase(std::unique(values.begin(), values.end(),
+                             [&comp](const T &a, const T &b) {
+                               return !comp(a, b) && !comp(b, a);
+                             }),
+                 values.end());
+  }
+
+  // Append the union of sorted vectors a and b to out; out may not alias
+  // either input
+  template<typename T, typename Compare = std::less<T>>
+  static void Union(std::vector<T> &out, const std::vector<T> &a,
+                    const std::vector<T> &b, Compare comp = Compare()) {
+    out.reserve(out.size() + a.size() + b.size());
+    std::set_union(a.begin(), a.end(), b.begin(), b.end(),
+                   std::back_inserter(out), comp);
+  }
+
+  // Merge sorted vector b into sorted vector a
+  template<typename T, typename Compare = std::less<T>>
+  static void UnionInto(std::vector<T> &a, const std::vector<T> &b,
+                        Compare comp = Compare()) {
+    if (b.empty())
+      return;
+    if (a.empty()) {
+      a = b;
+      return;
+    }
+    std::vector<T> out;
+    Union(out, a, b, comp);
+    a.swap(out);
+  }
+
+  // Append values [offset, offset + limit) to out; a negative limit runs to
+  // the end
+  template<typename T>
+  static void Page(std::vector<T> &out, const std::vector<T> &values,
+                   int64_t offset, int64_t limit) {
+    size_t begin = std::min<size_t>(std::max<int64_t>(offset, 0),
+                                    values.size());
+    size_t end = values.size();
+    if (limit >= 0)
+      end = std::min<size_t>(end, begin + limit);
+    out.insert(out.end(), values.begin() + begin, values.begin() + end);
+  }
+
+  // Append the union of the sorted vectors in inputs to out, with a k-way
+  // merge; out may not alias any of the inputs
+  template<typename T, typename Compare = std::less<T>>
+  static void MultiwayUnion(std::vector<T> &out,
+                            const std::vector<std::vector<T>> &inputs,
+                            Compare comp = Compare()) {
+    // Heap of (input, position) cursors, smallest value on top
+    typedef std::pair<size_t, size_t> Cursor;
+    auto greater = [&](const Cursor &a, const Cursor &b) {
+      return comp(inputs[b.first][b.second], inputs[a.first][a.second]);
+    };
+    std::priority_queue<Cursor, std::vector<Cursor>, decltype(greater)> heap(
+        greater);
+
+    size_t total = 0;
+    for (size_t k = 0; k < inputs.size(); k++) {
+      total += inputs[k].size();
+      if (!inputs[k].empty())
+        heap.push(Cursor(k, 0));
+    }
+    out.reserve(out.size() + total);
+
+    size_t begin = out.size();
+    while (!heap.empty()) {
+      Cursor c = heap.top();
+      heap.pop();
+      const T &value = inputs[c.first][c.second];
+      if (out.size() == begin || comp(out.back(), value))
+        out.push_back(value);
+      if (++c.second < inputs[c.first].size())
+        heap.push(c);
+    }
+  }
+
+ private:
+  static const size_t kRadix = 1 << 16;
+  static const size_t kRadixSortThreshold = 1 << 12;
+};
+
+#endif /* SORTED_VECTOR_H */
@@ -7,11 +7,17 @@
 
 class SuccinctAllocator {
  public:
+  /*
+   * Constructor; uses huge pages if they are enabled by default.
+   *
+   */
+  SuccinctAllocator();
+
   /*
    * Constructor
    *
    */
-  SuccinctAllocator(bool s_use_hugepages = false);
+  explicit SuccinctAllocator(bool s_use_hugepages);
 
   /*
    * Enable the use of huge pages.
@@ -19,9 +25,19 @@ class SuccinctAllocator {
    */
   bool UseHugePages();
 
+  /*
+   * Enable or disable the use of huge pages by allocators created without an
+   * explicit choice, including those used for deserialized structures.
+   *
+   */
+  static void UseHugePagesByDefault(bool use_hugepages);
+
   /*
    * Allocates a block of size bytes of memory, returning a pointer to the
-   * beginning of the block.
+   * beginning of the block. With huge pages enabled, blocks of at least
+   * kHugePageSize bytes are mapped on explicit huge pages (MAP_HUGETLB) if
+   * the system has them reserved, and on 2MB-aligned pages advised for
+   * transparent huge pages otherwise; the heap is the last resort.
    *
    */
   void* s_malloc(size_t size);
@@ -54,9 +70,38 @@ class SuccinctAllocator {
    */
   void *s_memset(void* ptr, int value, size_t num);
 
+  /*
+   * Bytes currently mapped on explicit (MAP_HUGETLB) huge pages.
+   *
+   */
+  static size_t HugeTLBBytes();
+
+  /*
+   * Bytes currently mapped on pages advised for transparent huge pages.
+   *
+   */
+  static size_t TransparentHugePageBytes();
+
+  /*
+   * Number of huge page allocations that fell back to the heap.
+   *
+   */
+  static size_t NumFallbacks();
+
+  /*
+   * Whether ptr is the start of a block mapped on huge pages, rather than
+   * taken from the heap; such blocks are page-aligned, and share no pages
+   * with other allocations.
+   *
+   */
+  static bool IsMapped(const void* ptr);
+
+  static const size_t kHugePageSize = 2 * 1024 * 1024;
+
  private:
+  void* HugePageAlloc(size_t size);
+
   bool use_hugepages_;
 
 };
 #endif
-
@@ -0,0 +1,163 @@
+#ifndef SUCCINCT_CONTAINER_H
+#define SUCCINCT_CONTAINER_H
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include "succinct_allocator.h"
+
+/*
+ * Single-file container for serialized data structures. The file starts
+ * with a header holding a magic string, the format version and the number
+ * of sections, followed by a table with the name, offset, size and checksum
+ * of each section. Every section starts on a kAlignment-byte boundary, so
+ * that the whole file can be memory mapped at once with each section
+ * aligned, or sections can be read into memory one at a time.
+ */
+class SuccinctContainer {
+ public:
+  static const uint32_t kVersion = 1;
+  static const uint32_t kMaxSections = 15;
+  static const uint64_t kAlignment = 64;
+
+  struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t num_sections;
+    uint64_t file_size;
+    uint8_t reserved[40];
+  };
+
+  struct SectionEntry {
+    char name[32];
+    uint64_t offset;
+    uint64_t size;
+    uint64_t checksum;
+    uint64_t reserved;
+  };
+
+  /*
+   * Writes a container, one section after the other. Each section is
+   * written to the stream returned by BeginSection, and its checksum is
+   * computed as it is written.
+   */
+  class Writer {
+   public:
+    explicit Writer(const std::string& path);
+    ~Writer();
+
+    // False if the file could not be created
+    bool IsOpen();
+
+    // Start a section called name, and return the stream to write it to
+    std::ostream& BeginSection(const std::string& name);
+
+    // Finish the current section
+    void EndSection();
+
+    // Write the header and the section table, and close the file; false if
+    // any of the writes failed
+    bool Close();
+
+   private:
+    // Stream buffer that checksums what is written through it
+    class ChecksumBuf : public std::streambuf {
+     public:
+      explicit ChecksumBuf(std::ofstream& out);
+      void Reset();
+      uint64_t Finish();
+      uint64_t Size();
+
+     protected:
+      int overflow(int c);
+      std::streamsize xsputn(const char *s, std::streamsize n);
+
+     private:
+      void Flush();
+
+      std::ofstream& out_;
+      std::vector<char> buf_;
+      uint64_t checksum_;
+      uint64_t size_;
+    };
+
+    std::ofstream out_;
+    ChecksumBuf checksum_buf_;
+    std::ostream section_out_;
+    std::vector<SectionEntry> sections_;
+    uint64_t offset_;
+  };
+
+  // Open the container at path, and read its section table
+  explicit SuccinctContainer(const std::string& path);
+  ~SuccinctContainer();
+
+  // False if the file could not be read, or is not a container of this
+  // version with a consistent section table
+  bool IsOpen() {
+    return is_open_;
+  }
+
+  // Whether the file at path is a container
+  static bool IsContainer(const std::string& path);
+
+  // Copy the files of a serialized directory into a container at path, one
+  // section per file
+  static bool ConvertDirectory(const std::string& dir, const std::string& path);
+
+  const std::string& GetPath() {
+    return path_;
+  }
+
+  uint32_t GetVersion() {
+    return header_.version;
+  }
+
+  bool HasSection(const std::string& name);
+
+  // Size of a section; 0 if there is no such section
+  size_t SectionSize(const std::string& name);
+
+  // Pointer to a section within a read-only mapping of the whole file; the
+  // file is mapped on first use, and unmapped with the container. Pages are
+  // faulted in on first access, with the default read-ahead unless the
+  // caller advises otherwise for the section. NULL if there is no such
+  // section or the file could not be mapped.
+  uint8_t *MapSection(const std::string& name);
+
+  // Read a section into an arena from s_allocator, and verify its checksum;
+  // NULL if there is no such section, or it could not be read or is corrupt
+  uint8_t *ReadSection(const std::string& name, SuccinctAllocator& s_allocator);
+
+  // Whether the section exists and its contents match its checksum
+  bool VerifySection(const std::string& name);
+
+  // Checksum of size bytes at data, taken a word at a time
+  static uint64_t Checksum(const uint8_t *data, size_t size);
+
+ private:
+  static uint64_t ChecksumUpdate(uint64_t checksum, const uint8_t *data,
+                                 size_t size);
+  static uint64_t ChecksumFinish(uint64_t checksum, uint64_t size);
+
+  // Entry of the section called name; NULL if there is none
+  const SectionEntry *FindSection(const std::string& name);
+
+  std::string path_;
+  bool is_open_;
+  Header header_;
+  std::map<std::string, SectionEntry> sections_;
+  uint8_t *mapping_;
+
+  static const char kMagic[8];
+  static const uint64_t kChecksumSeed = 0xcbf29ce484222325ULL;
+  static const uint64_t kChecksumPrime = 0x100000001b3ULL;
+  static const size_t kBufferSize = 1 << 20;
+};
+
+#endif /* SUCCINCT_CONTAINER_H */
@@ -1,7 +1,10 @@
 #ifndef SUCCINCT_UTILS_H
 #define SUCCINCT_UTILS_H
 
+#include <cerrno>
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <string>
 #include <sys/mman.h>
 #include <sys/types.h>
@@ -10,9 +13,13 @@
 #include <sys/stat.h>
 #include <iostream>
 #include <fstream>
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
 
 #include "assertions.h"
 #include "definitions.h"
+#include "succinct_allocator.h"
 
 #ifndef MAP_HUGETLB
 #define MAP_HUGETLB 0
@@ -26,11 +33,57 @@ class SuccinctUtils {
  public:
   // Returns the number of set bits in a 64 bit integer
   static uint64_t PopCount(uint64_t n) {
-    // TODO: Add support for hardware instruction
+#ifdef __GNUC__
+    return __builtin_popcountll(n);
+#else
     n -= (n >> 1) & m1;
     n = (n & m2) + ((n >> 2) & m2);
     n = (n + (n >> 4)) & m4;
     return (n * h01) >> 56;
+#endif
+  }
+
+  // Returns the position (from the most significant bit) of the r-th set bit
+  // in a 64 bit integer; r must be less than PopCount(n)
+  static uint32_t SelectInWord(uint64_t n, uint64_t r) {
+    // The r-th set bit from the most significant bit is the k-th from the
+    // least significant bit
+    uint64_t k = PopCount(n) - 1 - r;
+#if defined(__BMI2__) && defined(__GNUC__)
+    return 63 - __builtin_ctzll(_pdep_u64(1ULL << k, n));
+#else
+    // Broadword select: byte i of sums holds the number of set bits in
+    // bytes 0..i, so the bytes with at most k set bits before and in them
+    // precede the byte holding the k-th set bit
+    uint64_t sums = n - ((n >> 1) & m1);
+    sums = (sums & m2) + ((sums >> 2) & m2);
+    sums = ((sums + (sums >> 4)) & m4) * h01;
+    uint64_t leq = ((k * h01) | h80) - sums;
+    uint32_t pos = PopCount(leq & h80) * 8;
+
+    // At most seven set bits are cleared within the byte
+    uint64_t byte = (n >> pos) & 0xFF;
+    if (pos != 0)
+      k -= (sums >> (pos - 8)) & 0xFF;
+    while (k-- > 0)
+      byte &= byte - 1;
+    return 63 - (pos + CountTrailingZeros(byte));
+#endif
+  }
+
+  // Returns the number of unset bits below the least significant set bit of
+  // a non-zero 64 bit integer
+  static uint32_t CountTrailingZeros(uint64_t n) {
+#ifdef __GNUC__
+    return __builtin_ctzll(n);
+#else
+    uint32_t count = 0;
+    while ((n & 1) == 0) {
+      n >>= 1;
+      count++;
+    }
+    return count;
+#endif
   }
 
   // Returns integer logarithm to the base 2
@@ -64,33 +117,104 @@ class SuccinctUtils {
     return (first < second) ? first : second;
   }
 
-  // Memory maps a file and returns a pointer to it
-  static void* MemoryMap(std::string filename) {
+  // Memory maps a file and returns a pointer to it. If populate is set, the
+  // whole file is faulted in before returning; otherwise pages are faulted
+  // in on first access. The size of the file is stored in size, if given.
+  static void* MemoryMap(std::string filename, bool populate = true,
+                         size_t *size = NULL) {
     struct stat st;
     stat(filename.c_str(), &st);
 
     int fd = open(filename.c_str(), O_RDONLY, 0);
     assert(fd != -1);
 
+    int flags = MAP_PRIVATE | (populate ? MAP_POPULATE : 0);
+
     // Try mapping with huge-pages support
-    void *data = mmap(NULL, st.st_size, PROT_READ,
-    MAP_PRIVATE | MAP_HUGETLB | MAP_POPULATE,
-                      fd, 0);
+    void *data = mmap(NULL, st.st_size, PROT_READ, flags | MAP_HUGETLB, fd, 0);
 
     // Revert to mapping with huge page support in case mapping fails
     if (data == (void *) -1) {
       fprintf(
           stderr,
           "mmap with MAP_HUGETLB option failed; trying without MAP_HUGETLB flag...\n");
-      data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd,
-                  0);
+      data = mmap(NULL, st.st_size, PROT_READ, flags, fd, 0);
     }
     madvise(data, st.st_size, POSIX_MADV_RANDOM);
     assert(data != (void * )-1);
+    close(fd);
 
+    if (size != NULL) {
+      *size = st.st_size;
+    }
     return data;
   }
 
+  // Reads a file into an arena from s_allocator with large sequential reads,
+  // and returns a pointer to it; the arena holds the whole file, and is
+  // writable. The size of the file is stored in size, if given. Returns NULL
+  // if the file could not be read.
+  static void* ReadFile(std::string filename, SuccinctAllocator& s_allocator,
+                        size_t *size = NULL) {
+    int fd = open(filename.c_str(), O_RDONLY, 0);
+    struct stat st;
+    if (fd == -1 || fstat(fd, &st) != 0) {
+      fprintf(stderr, "Could not open %s: %s\n", filename.c_str(),
+              strerror(errno));
+      if (fd != -1)
+        close(fd);
+      return NULL;
+    }
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(fd, 0, st.st_size, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    uint8_t *data = (uint8_t *) s_allocator.s_malloc(st.st_size);
+    size_t done = 0;
+    while (data != NULL && done < (size_t) st.st_size) {
+      size_t chunk = MIN(kReadChunkSize, st.st_size - done);
+      ssize_t n = read(fd, data + done, chunk);
+      if (n < 0 && errno == EINTR)
+        continue;
+      if (n <= 0) {
+        fprintf(stderr, "Could not read %s past %zu bytes\n", filename.c_str(),
+                done);
+        s_allocator.s_free(data);
+        data = NULL;
+        break;
+      }
+      done += n;
+    }
+    close(fd);
+
+    if (size != NULL) {
+      *size = st.st_size;
+    }
+    return data;
+  }
+
+  // Creates filename with the given size (truncating any existing file), and
+  // maps it for reading and writing. Pages are backed by the file rather than
+  // by anonymous memory, so the kernel can write them back and evict them
+  // under memory pressure.
+  static void* MemoryMapWritable(std::string filename, size_t size) {
+    int fd = open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    assert(fd != -1);
+    int ret = ftruncate(fd, size);
+    assert(ret == 0);
+
+    void *data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    assert(data != (void * )-1);
+    close(fd);
+
+    return data;
+  }
+
+  // Unmaps a mapping created by MemoryMapWritable
+  static void MemoryUnmap(void *data, size_t size) {
+    munmap(data, size);
+  }
+
   // Writes an integer array to file
   template<typename T>
   static void WriteToFile(T* data, size_t size, std::string outfile) {
@@ -98,6 +222,9 @@ class SuccinctUtils {
     out.write(reinterpret_cast<const char *>(data), size * sizeof(T));
     out.close();
   }
+
+ private:
+  static const size_t kReadChunkSize = 64 * 1024 * 1024;
 };
 
 #endif
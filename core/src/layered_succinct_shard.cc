@@ -57,10 +57,8 @@ void LayeredSuccinctShard::get(std::string& result, int64_t key) {
     int64_t pos = GetValueOffsetPos(key);
     if (pos < 0)
       return;
-    int64_t start = value_offsets_[pos];
-    int64_t end =
-        ((size_t) (pos + 1) < value_offsets_.size()) ?
-            value_offsets_[pos + 1] : input_size_;
+    int64_t start = GetValueOffset(pos);
+    int64_t end = GetValueOffset(pos + 1);
     int64_t len = end - start - 1;
     result.resize(len);
     uint64_t idx = LookupISA(start);
@@ -82,10 +80,8 @@ void LayeredSuccinctShard::get(std::string& result, int64_t key) {
   int64_t pos = GetValueOffsetPos(key);
   if (pos < 0)
     return;
-  int64_t start = value_offsets_[pos];
-  int64_t end =
-      ((size_t) (pos + 1) < value_offsets_.size()) ?
-          value_offsets_[pos + 1] : input_size_;
+  int64_t start = GetValueOffset(pos);
+  int64_t end = GetValueOffset(pos + 1);
   int64_t len = end - start - 1;
   result.resize(len);
   uint64_t idx = LookupISA(start);
@@ -117,7 +113,7 @@ void LayeredSuccinctShard::access(std::string& result, int64_t key,
     int64_t pos = GetValueOffsetPos(key);
     if (pos < 0)
       return;
-    int64_t start = value_offsets_[pos] + offset;
+    int64_t start = GetValueOffset(pos) + offset;
     result.resize(len);
     uint64_t idx = LookupISA(start);
     for (int64_t i = 0; i < len; i++) {
@@ -137,7 +133,7 @@ void LayeredSuccinctShard::access(std::string& result, int64_t key,
   int64_t pos = GetValueOffsetPos(key);
   if (pos < 0)
     return;
-  int64_t start = value_offsets_[pos] + offset;
+  int64_t start = GetValueOffset(pos) + offset;
   result.resize(len);
   uint64_t idx = LookupISA(start);
   ISA_opp->Store(start, idx);
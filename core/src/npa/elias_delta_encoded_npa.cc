@@ -14,9 +14,9 @@ EliasDeltaEncodedNPA::EliasDeltaEncodedNPA(uint64_t npa_size,
 }
 
 EliasDeltaEncodedNPA::EliasDeltaEncodedNPA(uint32_t context_len,
-                                           uint32_t sampling_rates,
+                                           uint32_t sampling_rate,
                                            SuccinctAllocator &s_allocator)
-    : DeltaEncodedNPA(0, 0, context_len, sampling_rate_,
+    : DeltaEncodedNPA(0, 0, context_len, sampling_rate,
                       NPAEncodingScheme::ELIAS_DELTA_ENCODED, s_allocator) {
 }
 
@@ -46,7 +46,7 @@ void EliasDeltaEncodedNPA::EliasDeltaEncode(SuccinctBase::Bitmap **B,
     uint32_t N_bits = EliasGammaEncodedNPA::EliasGammaEncodingSize(N);
     SuccinctBase::SetBitmapAtPos(B, pos, N, N_bits);
     pos += N_bits;
-    uint64_t val = deltas[i] - (1 << N_prime);
+    uint64_t val = deltas[i] - (1ULL << N_prime);
     SuccinctBase::SetBitmapAtPos(B, pos, val, N_prime);
     pos += N_prime;
   }
@@ -66,34 +66,39 @@ uint64_t EliasDeltaEncodedNPA::EliasDeltaDecode(SuccinctBase::Bitmap *B,
   *offset += (L + 1);
   uint64_t val = SuccinctBase::LookupBitmapAtPos(B, *offset, N - 1);
   *offset += (N - 1);
-  val |= (1 << (N - 1));
+  val |= (1ULL << (N - 1));
   return val;
 }
 
 // Compute the prefix sum for the elias delta encoded deltas
 uint64_t EliasDeltaEncodedNPA::EliasDeltaPrefixSum(SuccinctBase::Bitmap *B,
-                                                   uint64_t offset,
+                                                   uint64_t *offset,
                                                    uint64_t i) {
   uint64_t sum = 0;
 
   for (uint64_t j = 0; j < i; j++) {
     uint32_t L = 0;
-    while (!ACCESSBIT(B, offset)) {
+    while (!ACCESSBIT(B, (*offset))) {
       L++;
-      offset++;
+      (*offset)++;
     }
-    uint32_t N = SuccinctBase::LookupBitmapAtPos(B, offset, L + 1);
+    uint32_t N = SuccinctBase::LookupBitmapAtPos(B, *offset, L + 1);
     assert(N > 0);
-    offset += (L + 1);
-    uint64_t val = SuccinctBase::LookupBitmapAtPos(B, offset, N - 1);
-    offset += (N - 1);
-    val |= (1 << (N - 1));
+    *offset += (L + 1);
+    uint64_t val = SuccinctBase::LookupBitmapAtPos(B, *offset, N - 1);
+    *offset += (N - 1);
+    val |= (1ULL << (N - 1));
     sum += val;
   }
 
   return sum;
 }
 
+uint64_t EliasDeltaEncodedNPA::SumDeltas(SuccinctBase::Bitmap *B,
+                                         uint64_t *offset, uint64_t i) {
+  return EliasDeltaPrefixSum(B, offset, i);
+}
+
 // Create delta encoded vector
 void EliasDeltaEncodedNPA::CreateDeltaEncodedVector(
     DeltaEncodedVector *dv, std::vector<uint64_t> &data) {
@@ -169,6 +174,7 @@ void EliasDeltaEncodedNPA::CreateDeltaEncodedVector(
       &(dv->delta_offsets),
       (_delta_offsets.size() == 0) ? NULL : &_delta_offsets[0],
       _delta_offsets.size(), dv->delta_offset_bits, s_allocator_);
+  InitDeltaEncodedVectorReaders(dv);
 }
 
 // Lookup delta encoded vector at index i
@@ -176,12 +182,10 @@ uint64_t EliasDeltaEncodedNPA::LookupDeltaEncodedVector(DeltaEncodedVector *dv,
                                                         uint64_t i) {
   uint64_t sample_offset = i / sampling_rate_;
   uint64_t delta_offset_idx = i % sampling_rate_;
-  uint64_t val = SuccinctBase::LookupBitmapArray(dv->samples, sample_offset,
-                                                 dv->sample_bits);
+  uint64_t val = dv->sample_reader[sample_offset];
   if (delta_offset_idx == 0)
     return val;
-  uint64_t delta_offset = SuccinctBase::LookupBitmapArray(
-      dv->delta_offsets, sample_offset, dv->delta_offset_bits);
-  val += EliasDeltaPrefixSum(dv->deltas, delta_offset, delta_offset_idx);
+  uint64_t delta_offset = dv->delta_offset_reader[sample_offset];
+  val += EliasDeltaPrefixSum(dv->deltas, &delta_offset, delta_offset_idx);
   return val;
 }
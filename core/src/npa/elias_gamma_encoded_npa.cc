@@ -10,7 +10,6 @@ EliasGammaEncodedNPA::EliasGammaEncodedNPA(uint64_t npa_size,
                                            SuccinctAllocator &s_allocator)
     : DeltaEncodedNPA(npa_size, sigma_size, context_len, sampling_rate,
                       NPAEncodingScheme::ELIAS_GAMMA_ENCODED, s_allocator) {
-  InitPrefixSum();
   Encode(isa_file, col_offsets, npa_file);
 }
 
@@ -19,7 +18,6 @@ EliasGammaEncodedNPA::EliasGammaEncodedNPA(uint32_t context_len,
                                            SuccinctAllocator &s_allocator)
     : DeltaEncodedNPA(0, 0, context_len, sampling_rate,
                       NPAEncodingScheme::ELIAS_GAMMA_ENCODED, s_allocator) {
-  InitPrefixSum();
 }
 
 uint16_t EliasGammaEncodedNPA::AccessDataPos16(uint16_t data, uint32_t pos,
@@ -32,26 +30,85 @@ uint16_t EliasGammaEncodedNPA::AccessDataPos16(uint16_t data, uint32_t pos,
 
 }
 
-void EliasGammaEncodedNPA::InitPrefixSum() {
-  for (uint64_t i = 0; i < 65536; i++) {
-    uint16_t val = (uint16_t) i;
-    uint16_t count = 0, offset = 0, sum = 0;
-    while (val && offset <= 16) {
-      int N = 0;
-      while (!GETBIT16(val, offset)) {
-        N++;
-        offset++;
+const uint32_t *EliasGammaEncodedNPA::PrefixSumTable() {
+  struct Table {
+    Table() {
+      for (uint64_t i = 0; i < 65536; i++) {
+        prefixsum[i] = Entry((uint16_t) i);
       }
-      if (offset + (N + 1) <= 16) {
-        sum += AccessDataPos16(val, offset, N + 1);
-        offset += (N + 1);
-        count++;
-      } else {
-        offset -= N;
-        break;
+    }
+
+    static uint32_t Entry(uint16_t block) {
+      uint16_t val = block;
+      uint16_t count = 0, offset = 0, sum = 0;
+      while (val && offset <= 16) {
+        int N = 0;
+        while (!GETBIT16(val, offset)) {
+          N++;
+          offset++;
+        }
+        if (offset + (N + 1) <= 16) {
+          sum += AccessDataPos16(val, offset, N + 1);
+          offset += (N + 1);
+          count++;
+        } else {
+          offset -= N;
+          break;
+        }
       }
+      return (offset << 24) | (count << 16) | sum;
+    }
+
+    uint32_t prefixsum[65536];
+  };
+
+  static const Table table;
+  return table.prefixsum;
+}
+
+// Get the 64 bits of B starting at bit pos; bits past the end of B are 0
+static inline uint64_t LookupWindow(const SuccinctBase::Bitmap *B,
+                                    uint64_t pos) {
+  if (B == NULL || pos >= B->size)
+    return 0;
+  uint64_t w = pos / 64, s = pos % 64;
+  uint64_t val = B->bitmap[w] << s;
+  if (s != 0 && (w + 1) * 64 < B->size)
+    val |= B->bitmap[w + 1] >> (64 - s);
+  return val;
+}
+
+// Decode the next elias-gamma code from the window over B starting at bit
+// offset, of which the first used bits have already been consumed. The
+// window is re-read only when the next code runs past its end; codes longer
+// than 64 bits are read directly from B.
+static inline uint64_t DecodeNext(const SuccinctBase::Bitmap *B,
+                                  uint64_t &offset, uint64_t &window,
+                                  uint32_t &used) {
+  while (true) {
+    // A code with N leading zeros is 2N + 1 bits long, and its value is
+    // held in the last N + 1 of them
+    uint32_t N = __builtin_clzll(window | 1);
+    uint32_t len = 2 * N + 1;
+    if (used + len <= 64) {
+      uint64_t val = window >> (64 - len);
+      window <<= len;
+      used += len;
+      return val;
     }
-    prefixsum_[i] = (offset << 24) | (count << 16) | sum;
+
+    if (used != 0) {
+      offset += used;
+      window = LookupWindow(B, offset);
+      used = 0;
+      continue;
+    }
+
+    uint64_t val = SuccinctBase::LookupBitmapAtPos(
+        const_cast<SuccinctBase::Bitmap *>(B), offset + N, N + 1);
+    offset += len;
+    window = LookupWindow(B, offset);
+    return val;
   }
 }
 
@@ -165,19 +222,17 @@ void EliasGammaEncodedNPA::CreateDeltaEncodedVector(
       &(dv->delta_offsets),
       (_delta_offsets.size() == 0) ? NULL : &_delta_offsets[0],
       _delta_offsets.size(), dv->delta_offset_bits, s_allocator_);
-
+  InitDeltaEncodedVectorReaders(dv);
 }
 
 uint64_t EliasGammaEncodedNPA::LookupDeltaEncodedVector(DeltaEncodedVector *dv,
                                                         uint64_t i) {
   uint64_t sample_offset = i / sampling_rate_;
   uint64_t delta_offset_idx = i % sampling_rate_;
-  uint64_t val = SuccinctBase::LookupBitmapArray(dv->samples, sample_offset,
-                                                 dv->sample_bits);
+  uint64_t val = dv->sample_reader[sample_offset];
   if (delta_offset_idx == 0)
     return val;
-  uint64_t delta_offset = SuccinctBase::LookupBitmapArray(
-      dv->delta_offsets, sample_offset, dv->delta_offset_bits);
+  uint64_t delta_offset = dv->delta_offset_reader[sample_offset];
   val += EliasGammaPrefixSum(dv->deltas, delta_offset, delta_offset_idx);
   return val;
 }
@@ -192,7 +247,7 @@ int64_t EliasGammaEncodedNPA::BinarySearchSamples(DeltaEncodedVector *dv,
   while (sp <= ep) {
     m = (sp + ep) / 2;
 
-    dv_val = SuccinctBase::LookupBitmapArray(dv->samples, m, dv->sample_bits);
+    dv_val = dv->sample_reader[m];
     if (dv_val == val) {
       sp = ep = m;
       break;
@@ -206,10 +261,55 @@ int64_t EliasGammaEncodedNPA::BinarySearchSamples(DeltaEncodedVector *dv,
   return ep;
 }
 
+// Sum the i elias-gamma encoded deltas at offset in B, advancing offset
+static inline uint64_t SumCodes(const SuccinctBase::Bitmap *delta_values,
+                                uint64_t &offset, uint64_t i) {
+  uint64_t delta_sum = 0;
+  uint64_t delta_idx = 0;
+  while (delta_idx < i) {
+    // Decode all the codes that fit in the next 64 bits
+    uint64_t window = LookupWindow(delta_values, offset);
+    uint32_t used = 0;
+    while (delta_idx < i) {
+      uint32_t N = __builtin_clzll(window | 1);
+      uint32_t len = 2 * N + 1;
+      if (used + len > 64)
+        break;
+      delta_sum += window >> (64 - len);
+      window <<= len;
+      used += len;
+      delta_idx++;
+    }
+
+    if (used == 0) {
+      // The code is longer than 64 bits
+      delta_sum += DecodeNext(delta_values, offset, window, used);
+      delta_idx++;
+    } else {
+      offset += used;
+    }
+  }
+  return delta_sum;
+}
+
 // Compute the prefix sum of the elias-gamma encoded deltas
-uint64_t EliasGammaEncodedNPA::EliasGammaPrefixSum(Bitmap *delta_values,
+uint64_t EliasGammaEncodedNPA::EliasGammaPrefixSum(const Bitmap *delta_values,
                                                    uint64_t offset,
                                                    uint64_t i) {
+  return SumCodes(delta_values, offset, i);
+}
+
+uint64_t EliasGammaEncodedNPA::SumDeltas(Bitmap *B, uint64_t *offset,
+                                         uint64_t i) {
+  return SumCodes(B, *offset, i);
+}
+
+// Compute the prefix sum of the elias-gamma encoded deltas using the
+// pre-computed prefix sums for 16-bit blocks
+uint64_t EliasGammaEncodedNPA::EliasGammaPrefixSumTable(Bitmap *delta_values,
+                                                        uint64_t offset,
+                                                        uint64_t i) {
+  const uint32_t *prefixsum = PrefixSumTable();
   uint64_t delta_sum = 0;
 
   uint64_t delta_idx = 0;
@@ -217,7 +317,7 @@ uint64_t EliasGammaEncodedNPA::EliasGammaPrefixSum(Bitmap *delta_values,
   while (delta_idx != i) {
     uint16_t block = (uint16_t) SuccinctBase::LookupBitmapAtPos(delta_values,
                                                                 delta_off, 16);
-    uint16_t cnt = PREFIX_CNT(block);
+    uint16_t cnt = PREFIX_CNT(prefixsum, block);
     if (cnt == 0) {
       // If the prefixsum table for the block returns count == 0
       // this must mean the value spans more than 16 bits
@@ -233,8 +333,8 @@ uint64_t EliasGammaEncodedNPA::EliasGammaPrefixSum(Bitmap *delta_values,
       delta_idx += 1;
     } else if (delta_idx + cnt <= i) {
       // If sum can be computed from the prefixsum table
-      delta_sum += PREFIX_SUM(block);
-      delta_off += PREFIX_OFF(block);
+      delta_sum += PREFIX_SUM(prefixsum, block);
+      delta_off += PREFIX_OFF(prefixsum, block);
       delta_idx += cnt;
     } else {
       // Last few values, decode them without looking up table
@@ -261,7 +361,7 @@ int64_t EliasGammaEncodedNPA::BinarySearch(int64_t val, uint64_t start_idx,
     return end_idx;
 
   // Get column-id
-  uint64_t col_id = SuccinctBase::GetRank1(&col_offsets_, start_idx) - 1;
+  uint64_t col_id = GetColumnId(start_idx);
 
   // Adjust start and end indexes for binary search
   start_idx -= col_offsets_[col_id];
@@ -280,12 +380,9 @@ int64_t EliasGammaEncodedNPA::BinarySearch(int64_t val, uint64_t start_idx,
       end_idx - (sample_offset * sampling_rate_), sampling_rate_);
 
   // Get offset into delta bitmap where decoding should start
-  uint64_t delta_off = SuccinctBase::LookupBitmapArray(dv->delta_offsets,
-                                                       sample_offset,
-                                                       dv->delta_offset_bits);
+  uint64_t delta_off = dv->delta_offset_reader[sample_offset];
   // Adjust the value being searched for
-  val -= SuccinctBase::LookupBitmapArray(dv->samples, sample_offset,
-                                         dv->sample_bits);
+  val -= dv->sample_reader[sample_offset];
   // Initialize the delta index and sum accumulated
   int64_t delta_idx = 0, delta_sum = 0;
 
@@ -295,61 +392,19 @@ int64_t EliasGammaEncodedNPA::BinarySearch(int64_t val, uint64_t start_idx,
   // Keep decoding delta values until either:
   // (a) the accumulated sum exceeds the value itself, or,
   // (b) the delta index exceeds the limit on number of delta values to decode
+  uint64_t window = LookupWindow(delta_values, delta_off);
+  uint32_t used = 0;
+  uint64_t last_decoded_value = 0;
   while (delta_sum < val && delta_idx < delta_limit) {
-    uint16_t block = (uint16_t) SuccinctBase::LookupBitmapAtPos(delta_values,
-                                                                delta_off, 16);
-    uint16_t block_cnt = PREFIX_CNT(block);
-    uint16_t block_sum = PREFIX_SUM(block);
-
-    if (block_cnt == 0) {
-      // If the prefixsum table for the block returns count == 0
-      // this must mean the value spans more than 16 bits
-      // read this manually
-      int N = 0;
-      while (!ACCESSBIT(delta_values, delta_off)) {
-        N++;
-        delta_off++;
-      }
-      uint64_t decoded_value = SuccinctBase::LookupBitmapAtPos(delta_values,
-                                                           delta_off, N + 1);
-      delta_sum += decoded_value;
-      delta_off += (N + 1);
-      delta_idx += 1;
-      // Roll back
-      if (delta_idx == sampling_rate_) {
-        delta_idx--;
-        delta_sum -= decoded_value;
-        break;
-      }
-    } else if (delta_sum + block_sum < val
-        && delta_idx + block_cnt < delta_limit) {
-      // If sum can be computed from the prefixsum table
-      delta_sum += block_sum;
-      delta_off += PREFIX_OFF(block);
-      delta_idx += block_cnt;
-    } else {
-      // Last few values, decode them without looking up table
-      uint64_t last_decoded_value = 0;
-      while (delta_sum < val && delta_idx < delta_limit) {
-        int N = 0;
-        while (!ACCESSBIT(delta_values, delta_off)) {
-          N++;
-          delta_off++;
-        }
-        last_decoded_value = SuccinctBase::LookupBitmapAtPos(delta_values,
-                                                             delta_off, N + 1);
-        delta_sum += last_decoded_value;
-        delta_off += (N + 1);
-        delta_idx += 1;
-      }
+    last_decoded_value = DecodeNext(delta_values, delta_off, window, used);
+    delta_sum += last_decoded_value;
+    delta_idx += 1;
+  }
 
-      // Roll back
-      if (delta_idx == sampling_rate_) {
-        delta_idx--;
-        delta_sum -= last_decoded_value;
-        break;
-      }
-    }
+  // Roll back
+  if (delta_idx == sampling_rate_) {
+    delta_idx--;
+    delta_sum -= last_decoded_value;
   }
 
   // Obtain the required index for the binary search
@@ -367,3 +422,64 @@ int64_t EliasGammaEncodedNPA::BinarySearch(int64_t val, uint64_t start_idx,
     return (delta_sum > val) ? res : res + 1;
   }
 }
+
+std::pair<int64_t, int64_t> EliasGammaEncodedNPA::BinarySearchRange(
+    std::pair<int64_t, int64_t> range, uint64_t start_idx, uint64_t end_idx) {
+
+  if (end_idx < start_idx)
+    return std::pair<int64_t, int64_t>(start_idx, end_idx);
+
+  // Get column-id, and adjust start and end indexes to the column
+  uint64_t col_id = GetColumnId(start_idx);
+  uint64_t col_off = col_offsets_[col_id];
+  start_idx -= col_off;
+  end_idx -= col_off;
+
+  // Fetch relevant delta encoded vector
+  DeltaEncodedVector *dv = &del_npa_[col_id];
+  Bitmap *delta_values = dv->deltas;
+  uint64_t end_sample = end_idx / sampling_rate_;
+
+  // Decoding cursor: the value at index idx, and the decoder state for the
+  // deltas that follow it
+  uint64_t idx, val, delta_off, window;
+  uint32_t used;
+  auto seek = [&](uint64_t sample_offset) {
+    idx = sample_offset * sampling_rate_;
+    val = dv->sample_reader[sample_offset];
+    delta_off = dv->delta_offset_reader[sample_offset];
+    window = LookupWindow(delta_values, delta_off);
+    used = 0;
+  };
+  auto advance = [&]() {
+    idx++;
+    if (idx % sampling_rate_ == 0)
+      seek(idx / sampling_rate_);
+    else
+      val += DecodeNext(delta_values, delta_off, window, used);
+  };
+
+  // Left bound: the first index in [start_idx, end_idx] with a value >=
+  // range.first. Values are strictly increasing within a column, so any
+  // index skipped by the sample search holds a smaller value.
+  seek(BinarySearchSamples(dv, range.first, start_idx / sampling_rate_,
+                           end_sample));
+  while (idx < start_idx || (val < (uint64_t) range.first && idx < end_idx))
+    advance();
+  if (val < (uint64_t) range.first)
+    return std::pair<int64_t, int64_t>(col_off + end_idx + 1,
+                                       col_off + end_idx);
+  int64_t left = col_off + idx;
+
+  // Right bound: the last index in [left, end_idx] with a value <=
+  // range.second. Skip ahead to a later sample only if it is in range.
+  uint64_t sample_offset = idx / sampling_rate_;
+  if (sample_offset < end_sample
+      && dv->sample_reader[sample_offset + 1] <= (uint64_t) range.second)
+    seek(BinarySearchSamples(dv, range.second, sample_offset + 1, end_sample));
+  while (val <= (uint64_t) range.second && idx < end_idx)
+    advance();
+  int64_t right = col_off + idx - (val > (uint64_t) range.second);
+
+  return std::pair<int64_t, int64_t>(left, right);
+}
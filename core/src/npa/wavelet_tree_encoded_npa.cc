@@ -50,7 +50,8 @@ void WaveletTreeEncodedNPA::CreateWaveletTree(
     }
   }
 
-  SuccinctBase::CreateDictionary(B, &((*root)->D), s_allocator_);
+  SuccinctBase::CreateDictionary(B, &((*root)->D), s_allocator_,
+                                 SuccinctBase::DictionaryType::RANK9);
   SuccinctBase::DestroyBitmap(&B, s_allocator_);
 
   for (uint64_t i = 0; i < values.size(); i++) {
@@ -246,6 +247,8 @@ void WaveletTreeEncodedNPA::Encode(Bitmap *data_bitmap, Bitmap *compact_sa,
     context.clear();
   }
 
+  InitColumnLookup();
+
   // Clean up
   for (uint64_t i = 0; i < k; i++) {
     for (uint64_t j = 0; j < sigma_size_; j++) {
@@ -258,8 +261,7 @@ void WaveletTreeEncodedNPA::Encode(Bitmap *data_bitmap, Bitmap *compact_sa,
   delete[] table;
   delete[] starts;
   delete[] sizes;
-  delete[] E->bitmap;
-  delete E;
+  SuccinctBase::DestroyBitmap(&E, s_allocator_);
 
   context_size.clear();
 }
@@ -267,7 +269,7 @@ void WaveletTreeEncodedNPA::Encode(Bitmap *data_bitmap, Bitmap *compact_sa,
 uint64_t WaveletTreeEncodedNPA::operator[](uint64_t i) {
 
   // Get column id
-  uint64_t column_id = SuccinctBase::GetRank1(&(col_offsets_), i) - 1;
+  uint64_t column_id = GetColumnId(i);
 
   // Get column offset
   uint64_t column_off = col_offsets_[column_id];
@@ -476,6 +478,7 @@ size_t WaveletTreeEncodedNPA::Deserialize(std::istream& in) {
 
   // Read coloffsets
   in_size += SuccinctBase::DeserializeVector(col_offsets_, in);
+  InitColumnLookup();
 
   // Read neccol
   col_nec_ = new std::vector<uint64_t>[sigma_size_];
@@ -509,9 +512,9 @@ size_t WaveletTreeEncodedNPA::Deserialize(std::istream& in) {
   return in_size;
 }
 
-size_t WaveletTreeEncodedNPA::MemoryMap(std::string filename) {
+size_t WaveletTreeEncodedNPA::MapBuffer(uint8_t *buf) {
   uint8_t *data, *data_beg;
-  data = data_beg = (uint8_t *) SuccinctUtils::MemoryMap(filename);
+  data = data_beg = buf;
 
   encoding_scheme_ = (NPAEncodingScheme) (*((uint64_t *) data));
   data += sizeof(uint64_t);
@@ -540,6 +543,7 @@ size_t WaveletTreeEncodedNPA::MemoryMap(std::string filename) {
 
   // Read coloffsets
   data += SuccinctBase::MemoryMapVector(col_offsets_, data);
+  InitColumnLookup();
 
   // Read neccol
   col_nec_ = new std::vector<uint64_t>[sigma_size_];
@@ -39,14 +39,14 @@ void SampledByIndexISA::Sample(ArrayStream& sa_stream, uint64_t n) {
                                    data_bits_);
     }
   }
+  InitDataReader();
 }
 
 uint64_t SampledByIndexISA::operator [](uint64_t i) {
 
   assert(i < original_size_);
   uint64_t sample_idx = i / sampling_rate_;
-  uint64_t sample = SuccinctBase::LookupBitmapArray(data_, sample_idx,
-                                                    data_bits_);
+  uint64_t sample = data_reader_[sample_idx];
   uint64_t pos = sample;
   i -= (sample_idx * sampling_rate_);
   while (i--) {
@@ -55,3 +55,45 @@ uint64_t SampledByIndexISA::operator [](uint64_t i) {
   return pos;
 
 }
+
+void SampledByIndexISA::LookupBatch(const uint64_t *idx, uint64_t *out,
+                                    size_t n) {
+  const uint64_t batch_size = SuccinctBase::kLookupBatchSize;
+  uint64_t cur[batch_size], remaining[batch_size];
+  uint64_t pending_idx[batch_size], pending_lane[batch_size];
+
+  for (size_t s = 0; s < n; s += batch_size) {
+    size_t m = SuccinctUtils::Min(n - s, batch_size);
+    for (size_t k = 0; k < m; k++) {
+      assert(idx[s + k] < original_size_);
+      pending_idx[k] = idx[s + k] / sampling_rate_;
+      remaining[k] = idx[s + k] % sampling_rate_;
+      data_reader_.Prefetch(pending_idx[k]);
+    }
+
+    data_reader_.LookupBatch(pending_idx, cur, m);
+
+    // Walk the NPA forward from the samples for all indexes together
+    while (true) {
+      size_t num_pending = 0;
+      for (size_t k = 0; k < m; k++) {
+        if (remaining[k] != 0) {
+          pending_lane[num_pending] = k;
+          pending_idx[num_pending++] = cur[k];
+        }
+      }
+      if (num_pending == 0)
+        break;
+
+      npa_->LookupBatch(pending_idx, pending_idx, num_pending);
+      for (size_t p = 0; p < num_pending; p++) {
+        cur[pending_lane[p]] = pending_idx[p];
+        remaining[pending_lane[p]]--;
+      }
+    }
+
+    for (size_t k = 0; k < m; k++) {
+      out[s + k] = cur[k];
+    }
+  }
+}
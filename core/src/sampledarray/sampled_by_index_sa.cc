@@ -39,6 +39,7 @@ void SampledByIndexSA::Sample(ArrayStream& sa_stream, uint64_t n) {
                                    data_bits_);
     }
   }
+  InitDataReader();
 }
 
 uint64_t SampledByIndexSA::operator [](uint64_t i) {
@@ -50,10 +51,58 @@ uint64_t SampledByIndexSA::operator [](uint64_t i) {
     i = (*npa_)[i];
     j++;
   }
-  uint64_t sa_val = SuccinctBase::LookupBitmapArray(data_, i / sampling_rate_,
-                                                    data_bits_);
+  uint64_t sa_val = data_reader_[i / sampling_rate_];
   if (sa_val < j)
     return original_size_ - (j - sa_val);
   else
     return sa_val - j;
 }
+
+void SampledByIndexSA::LookupBatch(const uint64_t *idx, uint64_t *out,
+                                   size_t n) {
+  const uint64_t batch_size = SuccinctBase::kLookupBatchSize;
+  uint64_t cur[batch_size], steps[batch_size], sa_vals[batch_size];
+  uint64_t pending_idx[batch_size], pending_lane[batch_size];
+
+  for (size_t s = 0; s < n; s += batch_size) {
+    size_t m = SuccinctUtils::Min(n - s, batch_size);
+    for (size_t k = 0; k < m; k++) {
+      assert(idx[s + k] < original_size_);
+      cur[k] = idx[s + k];
+      steps[k] = 0;
+    }
+
+    // Walk the NPA for all unsampled indexes together until each of them
+    // reaches a sampled index
+    while (true) {
+      size_t num_pending = 0;
+      for (size_t k = 0; k < m; k++) {
+        if (cur[k] % sampling_rate_ != 0) {
+          pending_lane[num_pending] = k;
+          pending_idx[num_pending++] = cur[k];
+        }
+      }
+      if (num_pending == 0)
+        break;
+
+      npa_->LookupBatch(pending_idx, pending_idx, num_pending);
+      for (size_t p = 0; p < num_pending; p++) {
+        cur[pending_lane[p]] = pending_idx[p];
+        steps[pending_lane[p]]++;
+      }
+    }
+
+    for (size_t k = 0; k < m; k++) {
+      cur[k] /= sampling_rate_;
+      data_reader_.Prefetch(cur[k]);
+    }
+
+    data_reader_.LookupBatch(cur, sa_vals, m);
+    for (size_t k = 0; k < m; k++) {
+      if (sa_vals[k] < steps[k])
+        out[s + k] = original_size_ - (steps[k] - sa_vals[k]);
+      else
+        out[s + k] = sa_vals[k] - steps[k];
+    }
+  }
+}
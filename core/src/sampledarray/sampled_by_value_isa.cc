@@ -46,6 +46,7 @@ void SampledByValueISA::Sample(ArrayStream& sa_stream, uint64_t n) {
                                    data_bits_);
     }
   }
+  InitDataReader();
 
 }
 
@@ -53,7 +54,7 @@ uint64_t SampledByValueISA::operator [](uint64_t i) {
   uint64_t a, pos;
   uint64_t v = i % sampling_rate_;
 
-  a = SuccinctBase::LookupBitmapArray(data_, i / sampling_rate_, data_bits_);
+  a = data_reader_[i / sampling_rate_];
   pos = SuccinctBase::GetSelect1(sampled_positions_, a);
 
   while (v) {
@@ -50,8 +50,11 @@ void SampledByValueSA::Sample(ArrayStream& sa_stream, uint64_t n) {
     }
   }
 
+  InitDataReader();
+
   sampled_positions_ = new Dictionary;
-  SuccinctBase::CreateDictionary(BPos, sampled_positions_, succinct_allocator_);
+  SuccinctBase::CreateDictionary(BPos, sampled_positions_, succinct_allocator_,
+                                 SuccinctBase::DictionaryType::RANK9);
   SuccinctBase::DestroyBitmap(&BPos, succinct_allocator_);
 }
 
@@ -72,7 +75,7 @@ uint64_t SampledByValueSA::operator [](uint64_t i) {
 
   r = SuccinctUtils::Modulo(
       (int64_t) SuccinctBase::GetRank1(sampled_positions_, i) - 1, data_size_);
-  a = SuccinctBase::LookupBitmapArray(data_, r, data_bits_);
+  a = data_reader_[r];
   return SuccinctUtils::Modulo((sampling_rate_ * a) - v, original_size_);
 }
 
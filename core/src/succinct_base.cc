@@ -1,5 +1,8 @@
 #include "succinct_base.h"
 
+#include <algorithm>
+#include <cstring>
+
 /* TODO: Replace all new[] calls with SuccinctAllocator calls */
 
 uint16_t *SuccinctBase::decode_table[17];
@@ -210,9 +213,20 @@ uint64_t SuccinctBase::LookupBitmapArray(SuccinctBase::Bitmap *B, uint64_t i,
   return val;
 }
 
+// Prefetch the word holding a value in the bitmap, treating it as an array
+// of fixed length
+void SuccinctBase::PrefetchBitmapArray(SuccinctBase::Bitmap *B, uint64_t i,
+                                       uint32_t b) {
+  if (B == nullptr || b == 0)
+    return;
+  PREFETCH(&B->bitmap[(i * b) / 64]);
+}
+
 // Set a value in the bitmap at a specified offset
 void SuccinctBase::SetBitmapAtPos(SuccinctBase::Bitmap **B, uint64_t pos,
                                   uint64_t val, uint32_t b) {
+  if (b == 0)
+    return;
   uint64_t s = pos, e = pos + (b - 1);
   if ((s / 64) == (e / 64)) {
     (*B)->bitmap[s / 64] |= (val << (63 - e % 64));
@@ -274,11 +288,11 @@ size_t SuccinctBase::DeserializeBitmap(SuccinctBase::Bitmap **B,
     in_size += sizeof(uint64_t);
     (*B) = new Bitmap;
     (*B)->size = bitmap_size;
-    (*B)->bitmap = new uint64_t[BITS2BLOCKS(bitmap_size)];
-    for (uint64_t i = 0; i < BITS2BLOCKS(bitmap_size); i++) {
-      in.read(reinterpret_cast<char *>(&(*B)->bitmap[i]), sizeof(uint64_t));
-      in_size += sizeof(uint64_t);
-    }
+    (*B)->bitmap = (uint64_t *) SuccinctAllocator().s_malloc(
+        BITS2BLOCKS(bitmap_size) * sizeof(uint64_t));
+    in.read(reinterpret_cast<char *>((*B)->bitmap),
+            BITS2BLOCKS(bitmap_size) * sizeof(uint64_t));
+    in_size += BITS2BLOCKS(bitmap_size) * sizeof(uint64_t);
   }
 
   return in_size;
@@ -305,12 +319,17 @@ size_t SuccinctBase::MemoryMapBitmap(SuccinctBase::Bitmap **B, uint8_t* buf) {
 // Create dictionary from a bitmap; returns the size of the dictionary in bits
 uint64_t SuccinctBase::CreateDictionary(SuccinctBase::Bitmap *B,
                                         SuccinctBase::Dictionary *D,
-                                        SuccinctAllocator& s_allocator) {
+                                        SuccinctAllocator& s_allocator,
+                                        DictionaryType type) {
+  if (type == DictionaryType::RANK9)
+    return CreateRank9Dictionary(B, D, s_allocator);
+
   uint64_t l3_size = (B->size / kTwo32) + 1;
   uint64_t l2_size = (B->size / 2048) + 1;
   uint64_t l1_size = (B->size / 512) + 1;
   uint64_t count = 0;
 
+  D->type = DictionaryType::CLASS_OFFSET_ENCODED;
   D->size = B->size;
   D->B = new Bitmap;
   D->rank_l3 = new uint64_t[l3_size];
@@ -413,6 +432,9 @@ uint64_t SuccinctBase::GetRank1(SuccinctBase::Dictionary *D, uint64_t i) {
 
   assert(i < D->size);
 
+  if (D->type == DictionaryType::RANK9)
+    return GetRank1Rank9(D, i);
+
   uint64_t l3_idx = i / kTwo32;
   uint64_t l2_idx = i / 2048;
   uint16_t l1_idx = i % 512;
@@ -473,6 +495,9 @@ uint64_t SuccinctBase::GetRank0(SuccinctBase::Dictionary *D, uint64_t i) {
 
 // Get the 1-select of the dictionary at the specified index
 uint64_t SuccinctBase::GetSelect1(SuccinctBase::Dictionary *D, uint64_t i) {
+  if (D->type == DictionaryType::RANK9)
+    return GetSelect1Rank9(D, i);
+
   uint64_t val = i + 1;
   int64_t sp = 0;
   int64_t ep = D->size / kTwo32;
@@ -578,6 +603,9 @@ uint64_t SuccinctBase::GetSelect1(SuccinctBase::Dictionary *D, uint64_t i) {
 
 // Get the 0-select of the dictionary at the specified index
 uint64_t SuccinctBase::GetSelect0(SuccinctBase::Dictionary *D, uint64_t i) {
+  if (D->type == DictionaryType::RANK9)
+    return GetSelect0Rank9(D, i);
+
   uint64_t val = i + 1;
   int64_t sp = 0;
   int64_t ep = D->size / kTwo32;
@@ -689,6 +717,9 @@ size_t SuccinctBase::SerializeDictionary(Dictionary *D, std::ostream& out) {
     return out_size;
   }
 
+  if (D->type == DictionaryType::RANK9)
+    return SerializeRank9Dictionary(D, out);
+
   out.write(reinterpret_cast<const char *>(&D->size), sizeof(uint64_t));
   out_size += sizeof(uint64_t);
 
@@ -724,14 +755,21 @@ size_t SuccinctBase::DeserializeDictionary(Dictionary *D, std::istream& in) {
   uint64_t dictionary_size;
 
   in.read(reinterpret_cast<char *>(&dictionary_size), sizeof(uint64_t));
-  if (dictionary_size) {
+  if (dictionary_size == kRank9Marker) {
     in_size += sizeof(uint64_t);
+    in_size += DeserializeRank9Dictionary(D, in);
+  } else if (dictionary_size) {
+    in_size += sizeof(uint64_t);
+    D->type = DictionaryType::CLASS_OFFSET_ENCODED;
     D->size = dictionary_size;
 
-    D->rank_l3 = new uint64_t[(D->size / L3BLKSIZE) + 1];
-    D->rank_l12 = new uint64_t[(D->size / L2BLKSIZE) + 1];
-    D->pos_l3 = new uint64_t[(D->size / L3BLKSIZE) + 1];
-    D->pos_l12 = new uint64_t[(D->size / L2BLKSIZE) + 1];
+    SuccinctAllocator s_allocator;
+    size_t l3_bytes = ((D->size / L3BLKSIZE) + 1) * sizeof(uint64_t);
+    size_t l12_bytes = ((D->size / L2BLKSIZE) + 1) * sizeof(uint64_t);
+    D->rank_l3 = (uint64_t *) s_allocator.s_malloc(l3_bytes);
+    D->rank_l12 = (uint64_t *) s_allocator.s_malloc(l12_bytes);
+    D->pos_l3 = (uint64_t *) s_allocator.s_malloc(l3_bytes);
+    D->pos_l12 = (uint64_t *) s_allocator.s_malloc(l12_bytes);
 
     for (uint64_t i = 0; i < (D->size / L3BLKSIZE) + 1; i++) {
       in.read(reinterpret_cast<char *>(&D->rank_l3[i]), sizeof(uint64_t));
@@ -765,8 +803,12 @@ size_t SuccinctBase::MemoryMapDictionary(Dictionary **D, uint8_t *buf) {
 
   uint64_t dictionary_size = *((uint64_t *) data);
   data += sizeof(uint64_t);
-  if (dictionary_size) {
+  if (dictionary_size == kRank9Marker) {
+    (*D) = new Dictionary;
+    data += MemoryMapRank9Dictionary(*D, data);
+  } else if (dictionary_size) {
     (*D) = new Dictionary;
+    (*D)->type = DictionaryType::CLASS_OFFSET_ENCODED;
     (*D)->size = dictionary_size;
 
     (*D)->rank_l3 = ((uint64_t *) data);
@@ -784,6 +826,418 @@ size_t SuccinctBase::MemoryMapDictionary(Dictionary **D, uint8_t *buf) {
   return data - data_beg;
 }
 
+/* RANK9 dictionary functions */
+// Create RANK9 dictionary from a bitmap; the bitmap is copied as is, and each
+// 512-bit block gets a pair of counters: the 1-rank before the block, and
+// seven 9-bit 1-ranks within the block before each of its words 1..7.
+// Returns the size of the dictionary in bits.
+uint64_t SuccinctBase::CreateRank9Dictionary(SuccinctBase::Bitmap *B,
+                                             SuccinctBase::Dictionary *D,
+                                             SuccinctAllocator& s_allocator) {
+  uint64_t num_words = BITS2BLOCKS(B->size);
+  uint64_t num_blocks = (B->size / 512) + 1;
+
+  D->type = DictionaryType::RANK9;
+  D->size = B->size;
+  D->B = new Bitmap;
+  D->B->size = B->size;
+  D->B->bitmap = (uint64_t *) s_allocator.s_malloc(
+      num_words * sizeof(uint64_t));
+  memcpy(D->B->bitmap, B->bitmap, num_words * sizeof(uint64_t));
+  D->rank_l12 = D->rank_l3 = D->pos_l12 = D->pos_l3 = NULL;
+
+  D->rank_blocks = (uint64_t *) s_allocator.s_malloc(
+      2 * num_blocks * sizeof(uint64_t));
+  std::vector<uint64_t> select1_hints, select0_hints;
+  uint64_t ones = 0, zeros = 0;
+  for (uint64_t b = 0; b < num_blocks; b++) {
+    D->rank_blocks[2 * b] = ones;
+    uint64_t block_ones = 0, block_counts = 0;
+    for (uint64_t w = 0; w < 8; w++) {
+      uint64_t word_idx = b * 8 + w;
+      uint64_t word_bits = 0, word_ones = 0;
+      if (word_idx < num_words) {
+        word_bits = MIN(64, D->size - word_idx * 64);
+        word_ones = SuccinctUtils::PopCount(
+            D->B->bitmap[word_idx] >> (64 - word_bits));
+      }
+
+      // Record the block holding every kSelectHintRate-th 1 and 0
+      while (select1_hints.size() * kSelectHintRate < ones + word_ones)
+        select1_hints.push_back(b);
+      while (select0_hints.size() * kSelectHintRate
+          < zeros + word_bits - word_ones)
+        select0_hints.push_back(b);
+
+      ones += word_ones;
+      zeros += word_bits - word_ones;
+      block_ones += word_ones;
+      if (w < 7)
+        block_counts |= block_ones << (9 * w);
+    }
+    D->rank_blocks[2 * b + 1] = block_counts;
+  }
+
+  D->num_select1_hints = select1_hints.size();
+  D->select1_hints = (uint64_t *) s_allocator.s_malloc(
+      D->num_select1_hints * sizeof(uint64_t));
+  std::copy(select1_hints.begin(), select1_hints.end(), D->select1_hints);
+  D->num_select0_hints = select0_hints.size();
+  D->select0_hints = (uint64_t *) s_allocator.s_malloc(
+      D->num_select0_hints * sizeof(uint64_t));
+  std::copy(select0_hints.begin(), select0_hints.end(), D->select0_hints);
+
+  return (2 * num_blocks + D->num_select1_hints + D->num_select0_hints) * 64
+      + num_words * 64;
+}
+
+// Get the 1-rank of the RANK9 dictionary at the specified index
+uint64_t SuccinctBase::GetRank1Rank9(SuccinctBase::Dictionary *D, uint64_t i) {
+  uint64_t block = i / 512;
+  uint64_t word = (i % 512) / 64;
+  uint64_t res = D->rank_blocks[2 * block];
+  if (word != 0)
+    res += (D->rank_blocks[2 * block + 1] >> (9 * (word - 1))) & 0x1FF;
+  return res + SuccinctUtils::PopCount(D->B->bitmap[i / 64] >> (63 - i % 64));
+}
+
+// Get the 1-select of the RANK9 dictionary at the specified index
+uint64_t SuccinctBase::GetSelect1Rank9(SuccinctBase::Dictionary *D,
+                                       uint64_t i) {
+  // The hints bound the range of blocks that can hold the answer
+  uint64_t h = i / kSelectHintRate;
+  uint64_t sp = D->select1_hints[h];
+  uint64_t ep = (h + 1 < D->num_select1_hints) ?
+      D->select1_hints[h + 1] : D->size / 512;
+  while (sp < ep) {
+    uint64_t m = (sp + ep + 1) / 2;
+    if (D->rank_blocks[2 * m] <= i)
+      sp = m;
+    else
+      ep = m - 1;
+  }
+
+  uint64_t r = i - D->rank_blocks[2 * sp];
+  uint64_t block_counts = D->rank_blocks[2 * sp + 1];
+  uint64_t word = 0, before = 0;
+  while (word < 7) {
+    uint64_t count = (block_counts >> (9 * word)) & 0x1FF;
+    if (count > r)
+      break;
+    before = count;
+    word++;
+  }
+
+  uint64_t word_idx = sp * 8 + word;
+  return word_idx * 64
+      + SuccinctUtils::SelectInWord(D->B->bitmap[word_idx], r - before);
+}
+
+// Get the 0-select of the RANK9 dictionary at the specified index
+uint64_t SuccinctBase::GetSelect0Rank9(SuccinctBase::Dictionary *D,
+                                       uint64_t i) {
+  uint64_t h = i / kSelectHintRate;
+  uint64_t sp = D->select0_hints[h];
+  uint64_t ep = (h + 1 < D->num_select0_hints) ?
+      D->select0_hints[h + 1] : D->size / 512;
+  while (sp < ep) {
+    uint64_t m = (sp + ep + 1) / 2;
+    if (m * 512 - D->rank_blocks[2 * m] <= i)
+      sp = m;
+    else
+      ep = m - 1;
+  }
+
+  uint64_t r = i - (sp * 512 - D->rank_blocks[2 * sp]);
+  uint64_t block_counts = D->rank_blocks[2 * sp + 1];
+  uint64_t word = 0, before = 0;
+  while (word < 7) {
+    uint64_t count = 64 * (word + 1) - ((block_counts >> (9 * word)) & 0x1FF);
+    if (count > r)
+      break;
+    before = count;
+    word++;
+  }
+
+  uint64_t word_idx = sp * 8 + word;
+  return word_idx * 64
+      + SuccinctUtils::SelectInWord(~D->B->bitmap[word_idx], r - before);
+}
+
+size_t SuccinctBase::SerializeRank9Dictionary(Dictionary *D,
+                                              std::ostream& out) {
+  size_t out_size = 0;
+
+  uint64_t marker = kRank9Marker;
+  out.write(reinterpret_cast<const char *>(&marker), sizeof(uint64_t));
+  out_size += sizeof(uint64_t);
+
+  out.write(reinterpret_cast<const char *>(&D->size), sizeof(uint64_t));
+  out_size += sizeof(uint64_t);
+
+  uint64_t num_blocks = (D->size / 512) + 1;
+  out.write(reinterpret_cast<const char *>(D->rank_blocks),
+            2 * num_blocks * sizeof(uint64_t));
+  out_size += 2 * num_blocks * sizeof(uint64_t);
+
+  out.write(reinterpret_cast<const char *>(&D->num_select1_hints),
+            sizeof(uint64_t));
+  out_size += sizeof(uint64_t);
+  out.write(reinterpret_cast<const char *>(D->select1_hints),
+            D->num_select1_hints * sizeof(uint64_t));
+  out_size += D->num_select1_hints * sizeof(uint64_t);
+
+  out.write(reinterpret_cast<const char *>(&D->num_select0_hints),
+            sizeof(uint64_t));
+  out_size += sizeof(uint64_t);
+  out.write(reinterpret_cast<const char *>(D->select0_hints),
+            D->num_select0_hints * sizeof(uint64_t));
+  out_size += D->num_select0_hints * sizeof(uint64_t);
+
+  out_size += SerializeBitmap(D->B, out);
+
+  return out_size;
+}
+
+// Deserialize RANK9 dictionary following its marker
+size_t SuccinctBase::DeserializeRank9Dictionary(Dictionary *D,
+                                                std::istream& in) {
+  size_t in_size = 0;
+
+  D->type = DictionaryType::RANK9;
+  D->rank_l12 = D->rank_l3 = D->pos_l12 = D->pos_l3 = NULL;
+
+  in.read(reinterpret_cast<char *>(&D->size), sizeof(uint64_t));
+  in_size += sizeof(uint64_t);
+
+  uint64_t num_blocks = (D->size / 512) + 1;
+  D->rank_blocks = (uint64_t *) SuccinctAllocator().s_malloc(
+      2 * num_blocks * sizeof(uint64_t));
+  in.read(reinterpret_cast<char *>(D->rank_blocks),
+          2 * num_blocks * sizeof(uint64_t));
+  in_size += 2 * num_blocks * sizeof(uint64_t);
+
+  in.read(reinterpret_cast<char *>(&D->num_select1_hints), sizeof(uint64_t));
+  in_size += sizeof(uint64_t);
+  D->select1_hints = (uint64_t *) SuccinctAllocator().s_malloc(
+      D->num_select1_hints * sizeof(uint64_t));
+  in.read(reinterpret_cast<char *>(D->select1_hints),
+          D->num_select1_hints * sizeof(uint64_t));
+  in_size += D->num_select1_hints * sizeof(uint64_t);
+
+  in.read(reinterpret_cast<char *>(&D->num_select0_hints), sizeof(uint64_t));
+  in_size += sizeof(uint64_t);
+  D->select0_hints = (uint64_t *) SuccinctAllocator().s_malloc(
+      D->num_select0_hints * sizeof(uint64_t));
+  in.read(reinterpret_cast<char *>(D->select0_hints),
+          D->num_select0_hints * sizeof(uint64_t));
+  in_size += D->num_select0_hints * sizeof(uint64_t);
+
+  in_size += DeserializeBitmap(&D->B, in);
+
+  return in_size;
+}
+
+// Memory map RANK9 dictionary following its marker
+size_t SuccinctBase::MemoryMapRank9Dictionary(Dictionary *D, uint8_t *buf) {
+  uint8_t *data, *data_beg;
+  data = data_beg = buf;
+
+  D->type = DictionaryType::RANK9;
+  D->rank_l12 = D->rank_l3 = D->pos_l12 = D->pos_l3 = NULL;
+
+  D->size = *((uint64_t *) data);
+  data += sizeof(uint64_t);
+
+  D->rank_blocks = (uint64_t *) data;
+  data += 2 * ((D->size / 512) + 1) * sizeof(uint64_t);
+
+  D->num_select1_hints = *((uint64_t *) data);
+  data += sizeof(uint64_t);
+  D->select1_hints = (uint64_t *) data;
+  data += D->num_select1_hints * sizeof(uint64_t);
+
+  D->num_select0_hints = *((uint64_t *) data);
+  data += sizeof(uint64_t);
+  D->select0_hints = (uint64_t *) data;
+  data += D->num_select0_hints * sizeof(uint64_t);
+
+  data += MemoryMapBitmap(&D->B, data);
+
+  return data - data_beg;
+}
+
+/* Elias-Fano vector access/modifier functions */
+// Create Elias-Fano vector from a non-decreasing array of n values
+void SuccinctBase::CreateEliasFanoVector(SuccinctBase::EliasFanoVector *E,
+                                         const uint64_t *A, uint64_t n,
+                                         SuccinctAllocator& s_allocator) {
+  E->size = n;
+  E->low_bits = 0;
+  E->low = nullptr;
+  E->high = nullptr;
+  if (n == 0)
+    return;
+
+  // Number of low bits is floor(log2(universe / n))
+  uint64_t universe = A[n - 1] + 1;
+  while (E->low_bits < 63 && (n << (E->low_bits + 1)) <= universe) {
+    E->low_bits++;
+  }
+
+  // Low bits are stored as a fixed-width array
+  uint64_t low_mask = (1ULL << E->low_bits) - 1;
+  std::vector<uint64_t> low_vals(n);
+  for (uint64_t i = 0; i < n; i++) {
+    low_vals[i] = A[i] & low_mask;
+  }
+  E->low = new Bitmap;
+  CreateBitmapArray(&E->low, &low_vals[0], n, E->low_bits, s_allocator);
+
+  // High bits are stored in unary: the i-th value sets bit (high + i)
+  Bitmap *B = new Bitmap;
+  InitBitmap(&B, n + (A[n - 1] >> E->low_bits) + 1, s_allocator);
+  for (uint64_t i = 0; i < n; i++) {
+    assert(i == 0 || A[i - 1] <= A[i]);
+    SETBITVAL(B, (A[i] >> E->low_bits) + i);
+  }
+  E->high = new Dictionary;
+  CreateDictionary(B, E->high, s_allocator, DictionaryType::RANK9);
+  DestroyBitmap(&B, s_allocator);
+}
+
+// Lookup the value at the specified index in the Elias-Fano vector
+uint64_t SuccinctBase::LookupEliasFanoVector(SuccinctBase::EliasFanoVector *E,
+                                             uint64_t i) {
+  assert(i < E->size);
+  uint64_t high = GetSelect1(E->high, i) - i;
+  return (high << E->low_bits) | LookupBitmapArray(E->low, i, E->low_bits);
+}
+
+// Get the index of the last value <= val in the Elias-Fano vector, or -1 if
+// there is no such value
+int64_t SuccinctBase::GetPredecessor(SuccinctBase::EliasFanoVector *E,
+                                     uint64_t val) {
+  if (E->size == 0)
+    return -1;
+
+  // All values lie in buckets [0, num_buckets)
+  uint64_t high = val >> E->low_bits;
+  uint64_t num_buckets = E->high->size - E->size;
+  if (high >= num_buckets)
+    return E->size - 1;
+
+  // Values in bucket high occupy indexes [sp, ep); the bucket is terminated
+  // by the high-th unset bit
+  uint64_t sp = (high == 0) ? 0 : GetSelect0(E->high, high - 1) - (high - 1);
+  uint64_t ep = GetSelect0(E->high, high) - high;
+
+  // Binary search for the first value in the bucket with low bits > val's
+  uint64_t low = val & ((1ULL << E->low_bits) - 1);
+  while (sp < ep) {
+    uint64_t m = (sp + ep) / 2;
+    if (LookupBitmapArray(E->low, m, E->low_bits) <= low)
+      sp = m + 1;
+    else
+      ep = m;
+  }
+
+  return (int64_t) sp - 1;
+}
+
+size_t SuccinctBase::SerializeEliasFanoVector(EliasFanoVector *E,
+                                              std::ostream& out) {
+  size_t out_size = 0;
+
+  out.write(reinterpret_cast<const char *>(&E->size), sizeof(uint64_t));
+  out_size += sizeof(uint64_t);
+  if (E->size == 0)
+    return out_size;
+
+  out.write(reinterpret_cast<const char *>(&E->low_bits), sizeof(uint64_t));
+  out_size += sizeof(uint64_t);
+  out_size += SerializeBitmap(E->low, out);
+  out_size += SerializeDictionary(E->high, out);
+
+  return out_size;
+}
+
+size_t SuccinctBase::DeserializeEliasFanoVector(EliasFanoVector *E,
+                                                std::istream& in) {
+  size_t in_size = 0;
+
+  E->low_bits = 0;
+  E->low = nullptr;
+  E->high = nullptr;
+
+  in.read(reinterpret_cast<char *>(&E->size), sizeof(uint64_t));
+  in_size += sizeof(uint64_t);
+  if (E->size == 0)
+    return in_size;
+
+  in.read(reinterpret_cast<char *>(&E->low_bits), sizeof(uint64_t));
+  in_size += sizeof(uint64_t);
+  in_size += DeserializeBitmap(&E->low, in);
+  E->high = new Dictionary;
+  in_size += DeserializeDictionary(E->high, in);
+
+  return in_size;
+}
+
+size_t SuccinctBase::MemoryMapEliasFanoVector(EliasFanoVector **E,
+                                              uint8_t *buf) {
+  uint8_t *data, *data_beg;
+  data = data_beg = buf;
+
+  (*E) = new EliasFanoVector;
+  (*E)->low_bits = 0;
+  (*E)->low = nullptr;
+  (*E)->high = nullptr;
+
+  (*E)->size = *((uint64_t *) data);
+  data += sizeof(uint64_t);
+  if ((*E)->size) {
+    (*E)->low_bits = *((uint64_t *) data);
+    data += sizeof(uint64_t);
+    data += MemoryMapBitmap(&(*E)->low, data);
+    data += MemoryMapDictionary(&(*E)->high, data);
+  }
+
+  return data - data_beg;
+}
+
+void SuccinctBase::DestroyEliasFanoVector(EliasFanoVector **E,
+                                         SuccinctAllocator& s_allocator,
+                                         bool owns_data) {
+  if (*E == nullptr)
+    return;
+
+  if ((*E)->low != nullptr) {
+    if (owns_data)
+      DestroyBitmap(&(*E)->low, s_allocator);
+    else
+      delete (*E)->low;
+  }
+
+  // The high bits are always in a RANK9 dictionary
+  Dictionary *D = (*E)->high;
+  if (D != nullptr) {
+    assert(D->type == DictionaryType::RANK9);
+    if (owns_data) {
+      s_allocator.s_free(D->rank_blocks);
+      s_allocator.s_free(D->select1_hints);
+      s_allocator.s_free(D->select0_hints);
+      DestroyBitmap(&D->B, s_allocator);
+    } else {
+      delete D->B;
+    }
+    delete D;
+  }
+
+  delete *E;
+  *E = nullptr;
+}
+
 size_t SuccinctBase::VectorSize(std::vector<uint64_t> &v) {
   return sizeof(v.size()) + v.size() * sizeof(uint64_t);
 }
@@ -797,10 +1251,25 @@ size_t SuccinctBase::BitmapSize(Bitmap *B) {
 size_t SuccinctBase::DictionarySize(Dictionary *D) {
   if (D == nullptr)
     return 0;
+  if (D->type == DictionaryType::RANK9) {
+    return 2 * sizeof(uint64_t)
+        + 2 * ((D->size / 512) + 1) * sizeof(uint64_t)
+        + (2 + D->num_select1_hints + D->num_select0_hints) * sizeof(uint64_t)
+        + BitmapSize(D->B);
+  }
   return sizeof(D->size) + 2 * ((D->size / L3BLKSIZE) + (D->size / L2BLKSIZE) + 2)
           * sizeof(uint64_t) + BitmapSize(D->B);
 }
 
+size_t SuccinctBase::EliasFanoVectorSize(EliasFanoVector *E) {
+  if (E == nullptr)
+    return 0;
+  if (E->size == 0)
+    return sizeof(E->size);
+  return sizeof(E->size) + sizeof(E->low_bits) + BitmapSize(E->low)
+      + DictionarySize(E->high);
+}
+
 size_t SuccinctBase::StorageSize() {
   // Size of tables + size of constants
   return 1048729 + 8 * 2;
@@ -1,5 +1,17 @@
 #include "succinct_core.h"
 
+namespace {
+
+// Input stream buffer over a block of memory
+class BufferStreamBuf : public std::streambuf {
+ public:
+  BufferStreamBuf(char *buf, size_t size) {
+    setg(buf, buf, buf + size);
+  }
+};
+
+}
+
 SuccinctCore::SuccinctCore(const std::string &filename, SuccinctMode s_mode,
                            uint32_t sa_sampling_rate,
                            uint32_t isa_sampling_rate,
@@ -7,25 +19,34 @@ SuccinctCore::SuccinctCore(const std::string &filename, SuccinctMode s_mode,
                            SamplingScheme sa_sampling_scheme,
                            SamplingScheme isa_sampling_scheme,
                            NPA::NPAEncodingScheme npa_encoding_scheme,
-                           uint32_t sampling_range)
-    : SuccinctBase() {
+                           uint32_t sampling_range, uint32_t num_threads,
+                           const PageInConfig &page_in_config)
+    : SuccinctBase(),
+      page_in_config_(page_in_config) {
 
   this->alphabet_ = nullptr;
+  this->alphabet_map_ = nullptr;
+  this->container_ = nullptr;
+  this->page_warmer_ = nullptr;
   this->sa_ = nullptr;
   this->isa_ = nullptr;
   this->npa_ = nullptr;
   this->alphabet_size_ = 0;
   this->input_size_ = 0;
+  this->loaded_ = true;
   switch (s_mode) {
     case SuccinctMode::CONSTRUCT_IN_MEMORY: {
       Construct(filename, sa_sampling_rate, isa_sampling_rate,
                 npa_sampling_rate, context_len, sa_sampling_scheme,
-                isa_sampling_scheme, npa_encoding_scheme, sampling_range);
+                isa_sampling_scheme, npa_encoding_scheme, sampling_range,
+                num_threads);
       break;
     }
     case SuccinctMode::CONSTRUCT_MEMORY_MAPPED: {
-      fprintf(stderr, "Unsupported mode.\n");
-      assert(0);
+      Construct(filename, sa_sampling_rate, isa_sampling_rate,
+                npa_sampling_rate, context_len, sa_sampling_scheme,
+                isa_sampling_scheme, npa_encoding_scheme, sampling_range,
+                num_threads, true);
       break;
     }
     case SuccinctMode::LOAD_IN_MEMORY: {
@@ -61,7 +82,7 @@ void SuccinctCore::Allocate(uint32_t sa_sampling_rate,
     case NPA::NPAEncodingScheme::ELIAS_DELTA_ENCODED:
       npa_ = new EliasDeltaEncodedNPA(context_len, npa_sampling_rate,
                                       s_allocator);
-      return;
+      break;
     case NPA::NPAEncodingScheme::WAVELET_TREE_ENCODED:
       npa_ = new WaveletTreeEncodedNPA(context_len, npa_sampling_rate,
                                        s_allocator);
@@ -121,22 +142,32 @@ void SuccinctCore::Construct(const std::string &filename,
                              SamplingScheme sa_sampling_scheme,
                              SamplingScheme isa_sampling_scheme,
                              NPA::NPAEncodingScheme npa_encoding_scheme,
-                             uint32_t sampling_range) {
+                             uint32_t sampling_range, uint32_t num_threads,
+                             bool memory_map) {
   // Get input size
   FILE *f = fopen(filename.c_str(), "r");
   fseek(f, 0, SEEK_END);
   uint64_t fsize = ftell(f);
   fseek(f, 0, SEEK_SET);
 
-  // Read input from file
-  auto *data = (uint8_t *) s_allocator.s_malloc(fsize + 1);
+  // Read input from file; when memory mapped, the input is copied into a
+  // temporary file-backed mapping, which is unlinked right away
+  uint8_t *data;
+  if (memory_map) {
+    std::string input_file = ".tmp.input";
+    data = (uint8_t *) SuccinctUtils::MemoryMapWritable(input_file, fsize + 1);
+    remove(input_file.c_str());
+  } else {
+    data = (uint8_t *) s_allocator.s_malloc(fsize + 1);
+  }
   fread(data, fsize, 1, f);
   fclose(f);
   data[fsize] = 1;
 
   Construct(data, fsize + 1, sa_sampling_rate, isa_sampling_rate,
             npa_sampling_rate, context_len, sa_sampling_scheme,
-            isa_sampling_scheme, npa_encoding_scheme, sampling_range);
+            isa_sampling_scheme, npa_encoding_scheme, sampling_range,
+            num_threads, memory_map);
 }
 
 /* Primary Construct function */
@@ -147,7 +178,8 @@ void SuccinctCore::Construct(uint8_t *input, size_t input_size,
                              SamplingScheme sa_sampling_scheme,
                              SamplingScheme isa_sampling_scheme,
                              NPA::NPAEncodingScheme npa_encoding_scheme,
-                             uint32_t sampling_range) {
+                             uint32_t sampling_range, uint32_t num_threads,
+                             bool memory_map) {
 
   std::string sa_file = ".tmp.sa";
   std::string isa_file = ".tmp.isa";
@@ -157,20 +189,41 @@ void SuccinctCore::Construct(uint8_t *input, size_t input_size,
   input_size_ = input_size;
   uint32_t bits = SuccinctUtils::IntegerLog2(input_size_ + 1);
 
-  // Construct Suffix Array
-  auto *lSA = (int64_t *) s_allocator.s_calloc(sizeof(int64_t), input_size_);
-  divsufsortxx::constructSA(input, (input + input_size_), lSA,
-                            lSA + input_size_, 256);
+  // Construct Suffix Array; when memory mapped, it is built directly in
+  // sa_file. The parallel construction keeps its working arrays in memory,
+  // so it is only used for in-memory construction.
+  int64_t *lSA;
+  if (memory_map) {
+    lSA = (int64_t *) SuccinctUtils::MemoryMapWritable(
+        sa_file, input_size_ * sizeof(int64_t));
+    divsufsortxx::constructSA(input, (input + input_size_), lSA,
+                              lSA + input_size_, 256);
+    SuccinctUtils::MemoryUnmap(lSA, input_size_ * sizeof(int64_t));
+  } else {
+    lSA = (int64_t *) s_allocator.s_calloc(sizeof(int64_t), input_size_);
+    if (num_threads > 1) {
+      parallelsa::constructSA(input, input_size_, lSA, num_threads);
+    } else {
+      divsufsortxx::constructSA(input, (input + input_size_), lSA,
+                                lSA + input_size_, 256);
+    }
 
-  // Write Suffix Array to file
-  SuccinctUtils::WriteToFile(lSA, input_size_, sa_file);
+    // Write Suffix Array to file
+    SuccinctUtils::WriteToFile(lSA, input_size_, sa_file);
+    s_allocator.s_free(lSA);
+  }
 
   ArrayStream sa_stream(sa_file);
-  s_allocator.s_free(lSA);
 
-  // Allocate space for Inverse Suffix Array
-  auto *lISA = (int64_t *) s_allocator.s_calloc(sizeof(int64_t),
-                                                input_size_);
+  // Allocate space for Inverse Suffix Array; when memory mapped, it is built
+  // directly in isa_file
+  int64_t *lISA;
+  if (memory_map) {
+    lISA = (int64_t *) SuccinctUtils::MemoryMapWritable(
+        isa_file, input_size_ * sizeof(int64_t));
+  } else {
+    lISA = (int64_t *) s_allocator.s_calloc(sizeof(int64_t), input_size_);
+  }
 
   // Auxiliary Data Structures for NPA
   std::vector<uint64_t> col_offsets;
@@ -179,32 +232,37 @@ void SuccinctCore::Construct(uint8_t *input, size_t input_size,
   prv_sa = cur_sa = sa_stream.Get();
   lISA[cur_sa] = 0;
   alphabet_size_ = 1;
-  alphabet_map_[input[cur_sa]] = std::pair<uint64_t, uint32_t>(0, 0);
+  alphabet_map_ = (AlphabetEntry *) s_allocator.s_calloc(sizeof(AlphabetEntry),
+                                                         kAlphabetMapSize);
+  alphabet_map_[input[cur_sa]] = { 0, 0, 1 };
   col_offsets.push_back(0);
   for (uint64_t i = 1; i < input_size_; i++) {
     cur_sa = sa_stream.Get();
     lISA[cur_sa] = i;
     if (input[cur_sa] != input[prv_sa]) {
-      alphabet_map_[input[cur_sa]] = std::pair<uint64_t, uint32_t>(
-          i, alphabet_size_++);
+      alphabet_map_[input[cur_sa]] = { i, alphabet_size_++, 1 };
       col_offsets.push_back(i);
     }
     prv_sa = cur_sa;
   }
 
-  alphabet_map_[(char) 0] = std::pair<uint64_t, uint32_t>(input_size_,
-                                                          alphabet_size_);
+  alphabet_map_[0] = { input_size_, alphabet_size_, 1 };
   assert(sa_stream.GetCurrentIndex() == input_size_);
   sa_stream.Reset();
 
-  alphabet_ = new char[alphabet_size_ + 1];
-  for (auto alphabet_entry : alphabet_map_) {
-    alphabet_[alphabet_entry.second.second] = alphabet_entry.first;
+  alphabet_ = (char *) s_allocator.s_malloc(alphabet_size_ + 1);
+  for (uint32_t c = 0; c < kAlphabetMapSize; c++) {
+    if (alphabet_map_[c].present)
+      alphabet_[alphabet_map_[c].col_id] = (char) c;
   }
 
   // Write Inverse Suffix Array to file
-  SuccinctUtils::WriteToFile(lISA, input_size_, isa_file);
-  s_allocator.s_free(lISA);
+  if (memory_map) {
+    SuccinctUtils::MemoryUnmap(lISA, input_size_ * sizeof(int64_t));
+  } else {
+    SuccinctUtils::WriteToFile(lISA, input_size_, isa_file);
+    s_allocator.s_free(lISA);
+  }
   ArrayStream isa_stream(isa_file);
 
   // Compact input data (if needed)
@@ -214,11 +272,15 @@ void SuccinctCore::Construct(uint8_t *input, size_t input_size,
     int sigma_bits = SuccinctUtils::IntegerLog2(alphabet_size_ + 1);
     InitBitmap(&data_bitmap, input_size_ * sigma_bits, s_allocator);
     for (uint64_t i = 0; i < input_size_; i++) {
-      SetBitmapArray(&data_bitmap, i, alphabet_map_[input[i]].second,
+      SetBitmapArray(&data_bitmap, i, alphabet_map_[input[i]].col_id,
                      sigma_bits);
     }
   }
-  s_allocator.s_free(input);
+  if (memory_map) {
+    SuccinctUtils::MemoryUnmap(input, input_size_);
+  } else {
+    s_allocator.s_free(input);
+  }
 
   switch (npa_encoding_scheme) {
     case NPA::NPAEncodingScheme::ELIAS_GAMMA_ENCODED: {
@@ -231,7 +293,7 @@ void SuccinctCore::Construct(uint8_t *input, size_t input_size,
       npa_ = new EliasDeltaEncodedNPA(input_size_, alphabet_size_, context_len,
                                       npa_sampling_rate, isa_file, col_offsets,
                                       npa_file, s_allocator);
-      return;
+      break;
     }
     case NPA::NPAEncodingScheme::WAVELET_TREE_ENCODED: {
       isa_stream.CloseAndRemove();
@@ -317,180 +379,224 @@ uint64_t SuccinctCore::LookupISA(uint64_t i) {
   return (*isa_)[i];
 }
 
+// Lookup NPA at each of the n indexes in idx
+void SuccinctCore::LookupNPABatch(const uint64_t *idx, uint64_t *out,
+                                  size_t n) {
+  npa_->LookupBatch(idx, out, n);
+}
+
+// Lookup SA at each of the n indexes in idx
+void SuccinctCore::LookupSABatch(const uint64_t *idx, uint64_t *out,
+                                 size_t n) {
+  sa_->LookupBatch(idx, out, n);
+}
+
+// Lookup ISA at each of the n indexes in idx
+void SuccinctCore::LookupISABatch(const uint64_t *idx, uint64_t *out,
+                                  size_t n) {
+  isa_->LookupBatch(idx, out, n);
+}
+
+// Lookup SA at every index in the range [first, second]
+void SuccinctCore::LookupSARange(Range range, int64_t *out) {
+  if (range.first > range.second)
+    return;
+  uint64_t *buf = reinterpret_cast<uint64_t *>(out);
+  uint64_t n = range.second - range.first + 1;
+  for (uint64_t i = 0; i < n; i++) {
+    buf[i] = range.first + i;
+  }
+  sa_->LookupBatch(buf, buf, n);
+}
+
 // Lookup C at index i
 uint64_t SuccinctCore::LookupC(uint64_t i) {
-  return GetRank1(&npa_->col_offsets_, i) - 1;
+  return npa_->GetColumnId(i);
 }
 
 char SuccinctCore::CharAt(uint64_t i) {
   return alphabet_[LookupC(LookupISA(i))];
 }
 
+uint64_t SuccinctCore::ExtractChars(uint64_t idx, uint64_t len, char *out) {
+  return npa_->Extract(idx, len, alphabet_, out);
+}
+
 size_t SuccinctCore::Serialize(const std::string &path) {
-  size_t out_size = 0;
-  typedef std::map<char, std::pair<uint64_t, uint32_t> >::iterator iterator_t;
-  struct stat st{};
-  mode_t create_mode = S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH;
-  if (stat(path.c_str(), &st) != 0) {
-    if (mkdir(path.c_str(), create_mode) != 0) {
-      fprintf(stderr, "Failed to create path '%s'\n", path.c_str());
-      fprintf(stderr, "Terminating the serialization process.\n");
-      return 0;
-    }
+  SuccinctContainer::Writer writer(path);
+  if (!writer.IsOpen()) {
+    fprintf(stderr, "Failed to create '%s'\n", path.c_str());
+    fprintf(stderr, "Terminating the serialization process.\n");
+    return 0;
   }
-  std::ofstream out(path + "/metadata");
-  std::ofstream sa_out(path + "/sa");
-  std::ofstream isa_out(path + "/isa");
-  std::ofstream npa_out(path + "/npa");
+  size_t out_size = SerializeSections(writer);
+  writer.Close();
+
+  return out_size;
+}
+
+size_t SuccinctCore::SerializeSections(SuccinctContainer::Writer &writer) {
+  size_t out_size = 0;
+
+  std::ostream &out = writer.BeginSection("metadata");
 
   // Output size of input file
   out.write(reinterpret_cast<const char *>(&(input_size_)), sizeof(uint64_t));
   out_size += sizeof(uint64_t);
 
-  // Output cmap size
-  uint64_t cmap_size = alphabet_map_.size();
-  out.write(reinterpret_cast<const char *>(&(cmap_size)), sizeof(uint64_t));
-  out_size += sizeof(uint64_t);
-  for (auto &it : alphabet_map_) {
-    out.write(reinterpret_cast<const char *>(&(it.first)), sizeof(char));
-    out_size += sizeof(char);
-    out.write(reinterpret_cast<const char *>(&(it.second.first)), sizeof(uint64_t));
-    out_size += sizeof(uint64_t);
-    out.write(reinterpret_cast<const char *>(&(it.second.second)), sizeof(uint32_t));
-    out_size += sizeof(uint32_t);
-  }
+  // Output alphabet map
+  out.write(reinterpret_cast<const char *>(alphabet_map_),
+            kAlphabetMapSize * sizeof(AlphabetEntry));
+  out_size += kAlphabetMapSize * sizeof(AlphabetEntry);
 
   out.write(reinterpret_cast<const char *>(&alphabet_size_), sizeof(uint32_t));
   out_size += sizeof(uint32_t);
-  for (uint32_t i = 0; i < alphabet_size_ + 1; i++) {
-    out.write(reinterpret_cast<const char *>(&alphabet_[i]), sizeof(char));
-  }
-
-  out_size += sa_->Serialize(sa_out);
-  out_size += isa_->Serialize(isa_out);
+  out.write(alphabet_, alphabet_size_ + 1);
 
   if (sa_->GetSamplingScheme() == SamplingScheme::FLAT_SAMPLE_BY_VALUE) {
     assert(isa_->GetSamplingScheme() == SamplingScheme::FLAT_SAMPLE_BY_VALUE);
     out_size += SerializeDictionary(((SampledByValueSA *) sa_)->GetSampledPositions(), out);
   }
+  writer.EndSection();
 
-  out_size += npa_->Serialize(npa_out);
-
-  out.close();
-  sa_out.close();
-  isa_out.close();
-  npa_out.close();
+  out_size += sa_->Serialize(writer.BeginSection("sa"));
+  writer.EndSection();
+  out_size += isa_->Serialize(writer.BeginSection("isa"));
+  writer.EndSection();
+  out_size += npa_->Serialize(writer.BeginSection("npa"));
+  writer.EndSection();
 
   return out_size;
 }
 
 size_t SuccinctCore::Deserialize(const std::string &path) {
-  // Check if directory exists
-  struct stat st{};
-  assert(stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode));
-
-  std::ifstream in(path + "/metadata");
-  std::ifstream sa_in(path + "/sa");
-  std::ifstream isa_in(path + "/isa");
-  std::ifstream npa_in(path + "/npa");
-
-  size_t in_size = 0;
-
-  // Read size of input file
-  in.read(reinterpret_cast<char *>(&(input_size_)), sizeof(uint64_t));
-  in_size += sizeof(uint64_t);
-
-  // Read alphabet map size
-  uint64_t alphabet_map_size;
-  in.read(reinterpret_cast<char *>(&(alphabet_map_size)), sizeof(uint64_t));
-  in_size += sizeof(uint64_t);
-
-  // Deserialize alphabet map
-  for (uint64_t i = 0; i < alphabet_map_size; i++) {
-    char first;
-    uint64_t second_first;
-    uint32_t second_second;
-    in.read(reinterpret_cast<char *>(&(first)), sizeof(char));
-    in_size += sizeof(char);
-    in.read(reinterpret_cast<char *>(&(second_first)), sizeof(uint64_t));
-    in_size += sizeof(uint64_t);
-    in.read(reinterpret_cast<char *>(&(second_second)), sizeof(uint32_t));
-    in_size += sizeof(uint32_t);
-    alphabet_map_[first] = std::pair<uint64_t, uint32_t>(second_first,
-                                                         second_second);
-  }
+  // Each section is read into an arena of its own with large sequential
+  // reads, and the data structures are laid out over it as when memory
+  // mapped
+  size_t in_size = Load(path, true);
+  loaded_ = in_size != 0;
+  return in_size;
+}
 
-  // Read alphabet size
-  in.read(reinterpret_cast<char *>(&alphabet_size_), sizeof(uint32_t));
-  in_size += sizeof(uint32_t);
+size_t SuccinctCore::MemoryMap(const std::string &path) {
+  size_t in_size = Load(path, false);
+  loaded_ = in_size != 0;
+  return in_size;
+}
 
-  // Deserialize alphabet
-  alphabet_ = new char[alphabet_size_ + 1];
-  for (uint32_t i = 0; i < alphabet_size_ + 1; i++) {
-    in.read(reinterpret_cast<char *>(&alphabet_[i]), sizeof(char));
-  }
+bool SuccinctCore::IsLoaded() {
+  return loaded_;
+}
 
-  // Deserialize SA, ISA
-  in_size += sa_->Deserialize(sa_in);
-  in_size += isa_->Deserialize(isa_in);
+void SuccinctCore::SetPageInConfig(const PageInConfig &page_in_config) {
+  page_in_config_ = page_in_config;
+}
 
-  // Deserialize bitmap marking positions of sampled values if the sampling scheme
-  // is sample by value.
-  if (sa_->GetSamplingScheme() == SamplingScheme::FLAT_SAMPLE_BY_VALUE) {
-    assert(isa_->GetSamplingScheme() == SamplingScheme::FLAT_SAMPLE_BY_VALUE);
-    auto *sampled_positions = new Dictionary;
-    in_size += DeserializeDictionary(sampled_positions, in);
-    ((SampledByValueSA *) sa_)->SetSampledPositions(sampled_positions);
-    ((SampledByValueISA *) isa_)->SetSampledPositions(sampled_positions);
+size_t SuccinctCore::WaitForPrefetch() {
+  if (page_warmer_ == nullptr)
+    return 0;
+  page_warmer_->Wait();
+  return page_warmer_->BytesWarmed();
+}
+
+uint8_t *SuccinctCore::LoadSection(const std::string &path,
+                                   const std::string &name, bool in_memory,
+                                   size_t *size) {
+  // Data structures serialized before the container format are in a
+  // directory, with a file per section
+  struct stat st{};
+  if (stat(path.c_str(), &st) != 0) {
+    fprintf(stderr, "Could not load %s: %s\n", path.c_str(), strerror(errno));
+    return NULL;
+  }
+  bool is_dir = S_ISDIR(st.st_mode);
+  if (is_dir && in_memory) {
+    return (uint8_t *) SuccinctUtils::ReadFile(path + "/" + name, s_allocator,
+                                               size);
+  }
+
+  size_t section_size;
+  uint8_t *data;
+  if (is_dir) {
+    std::string section_path = path + "/" + name;
+    if (stat(section_path.c_str(), &st) != 0) {
+      fprintf(stderr, "Could not load %s: %s\n", section_path.c_str(),
+              strerror(errno));
+      return NULL;
+    }
+    data = (uint8_t *) SuccinctUtils::MemoryMap(section_path, false,
+                                                &section_size);
+  } else {
+    if (container_ == NULL || container_->GetPath() != path) {
+      // Stop prefetching from the previous container before unmapping it
+      delete page_warmer_;
+      page_warmer_ = nullptr;
+      delete container_;
+      container_ = new SuccinctContainer(path);
+    }
+    if (!container_->IsOpen())
+      return NULL;
+    section_size = container_->SectionSize(name);
+    if (in_memory) {
+      data = container_->ReadSection(name, s_allocator);
+    } else {
+      data = container_->MapSection(name);
+    }
+    if (data == NULL)
+      return NULL;
+  }
+  if (size != NULL)
+    *size = section_size;
+
+  // Pages already faulted in are moved to the chosen node; pages faulted in
+  // later are placed by the memory policy of the thread that faults them.
+  // Sections read into the heap may share pages with other allocations, so
+  // only those mapped by the allocator are moved; the others are placed by
+  // the memory policy of the loading thread (see NumaUtils::BindThread).
+  int node = page_in_config_.numa_node;
+  if (in_memory) {
+    if (node >= 0 && SuccinctAllocator::IsMapped(data))
+      NumaUtils::BindMemory(data, section_size, node);
+    return data;
   }
 
-  // Deserialize NPA based on the NPA encoding scheme.
-  switch (npa_->GetEncodingScheme()) {
-    case NPA::NPAEncodingScheme::ELIAS_DELTA_ENCODED:in_size += ((EliasDeltaEncodedNPA *) npa_)->Deserialize(npa_in);
+  // Mapped pages are faulted in on first access unless populated here or
+  // prefetched in the background; the access advice is set per section,
+  // since sections of a container share one mapping
+  PageInPolicy policy = page_in_config_.GetPolicy(name);
+  PageWarmer::Advise(data, section_size, policy);
+  switch (policy) {
+    case PAGE_IN_POPULATE: {
+      PageWarmer::Populate(data, section_size);
+      if (node >= 0)
+        NumaUtils::BindMemory(data, section_size, node);
       break;
-    case NPA::NPAEncodingScheme::ELIAS_GAMMA_ENCODED:in_size += ((EliasGammaEncodedNPA *) npa_)->Deserialize(npa_in);
+    }
+    case PAGE_IN_LAZY: {
       break;
-    case NPA::NPAEncodingScheme::WAVELET_TREE_ENCODED:in_size += ((WaveletTreeEncodedNPA *) npa_)->Deserialize(npa_in);
+    }
+    case PAGE_IN_PREFETCH: {
+      if (page_warmer_ == nullptr)
+        page_warmer_ = new PageWarmer(page_in_config_.prefetch_rate, node);
+      page_warmer_->Add(data, section_size);
       break;
-    default:assert(0);
+    }
   }
-
-  in.close();
-  sa_in.close();
-  isa_in.close();
-  npa_in.close();
-
-  return in_size;
+  return data;
 }
 
-size_t SuccinctCore::MemoryMap(const std::string &path) {
-  // Check if directory exists
-  struct stat st{};
-  assert(stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode));
-
+size_t SuccinctCore::Load(const std::string &path, bool in_memory) {
   uint8_t *data_beg, *data;
-  data = data_beg = (uint8_t *) SuccinctUtils::MemoryMap(path + "/metadata");
+  data = data_beg = LoadSection(path, "metadata", in_memory);
+  if (data == NULL)
+    return 0;
 
   input_size_ = *((uint64_t *) data);
   data += sizeof(uint64_t);
 
-  // Read alphabet_map size
-  uint64_t alphabet_map_size = *((uint64_t *) data);
-  data += sizeof(uint64_t);
-
-  // Deserialize map, because we don't know how to have serialized,
-  // memory mapped maps yet. This is fine, since the map size is
-  // pretty small.
-  for (uint64_t i = 0; i < alphabet_map_size; i++) {
-    char first = *((char *) data);
-    data += sizeof(char);
-    uint64_t second_first = *((uint64_t *) data);
-    data += sizeof(uint64_t);
-    uint32_t second_second = *((uint32_t *) data);
-    data += sizeof(uint32_t);
-    alphabet_map_[first] = std::pair<uint64_t, uint32_t>(second_first,
-                                                         second_second);
-  }
+  // Read alphabet map
+  alphabet_map_ = (AlphabetEntry *) data;
+  data += kAlphabetMapSize * sizeof(AlphabetEntry);
 
   // Read alphabet size
   alphabet_size_ = *((uint32_t *) data);
@@ -500,11 +606,7 @@ size_t SuccinctCore::MemoryMap(const std::string &path) {
   alphabet_ = (char *) data;
   data += (sizeof(char) * (alphabet_size_ + 1));
 
-  // Memory map SA and ISA
-  data += sa_->MemoryMap(path + "/sa");
-  data += isa_->MemoryMap(path + "/isa");
-
-  // Memory map bitmap marking positions of sampled values if the sampling scheme
+  // Map bitmap marking positions of sampled values if the sampling scheme
   // is sample by value.
   if (sa_->GetSamplingScheme() == SamplingScheme::FLAT_SAMPLE_BY_VALUE) {
     Dictionary *d_bpos;
@@ -514,21 +616,49 @@ size_t SuccinctCore::MemoryMap(const std::string &path) {
     ((SampledByValueISA *) isa_)->SetSampledPositions(d_bpos);
   }
 
-  // Memory map NPA based on the NPA encoding scheme.
-  switch (npa_->GetEncodingScheme()) {
-    case NPA::NPAEncodingScheme::ELIAS_DELTA_ENCODED:data += ((EliasDeltaEncodedNPA *) npa_)->MemoryMap(path + "/npa");
-      break;
-    case NPA::NPAEncodingScheme::ELIAS_GAMMA_ENCODED:data += ((EliasGammaEncodedNPA *) npa_)->MemoryMap(path + "/npa");
-      break;
-    case NPA::NPAEncodingScheme::WAVELET_TREE_ENCODED:
-      data += ((WaveletTreeEncodedNPA *) npa_)->MemoryMap(path + "/npa");
-      break;
-    default:assert(0);
-  }
+  // Load SA and ISA
+  size_t sa_size = LoadSampledArray(sa_, path, "sa", in_memory);
+  if (sa_size == 0)
+    return 0;
+  data += sa_size;
+  size_t isa_size = LoadSampledArray(isa_, path, "isa", in_memory);
+  if (isa_size == 0)
+    return 0;
+  data += isa_size;
+
+  // Load NPA
+  uint8_t *npa_buf = LoadSection(path, "npa", in_memory);
+  if (npa_buf == NULL)
+    return 0;
+  data += npa_->MapBuffer(npa_buf);
 
   return data - data_beg;
 }
 
+size_t SuccinctCore::LoadSampledArray(SampledArray *A, const std::string &path,
+                                      const std::string &name,
+                                      bool in_memory) {
+  // Layers of a layered array are destroyed and rebuilt one at a time, so
+  // in memory they are deserialized into bitmaps of their own
+  SamplingScheme scheme = A->GetSamplingScheme();
+  if (in_memory && (scheme == SamplingScheme::LAYERED_SAMPLE_BY_INDEX
+      || scheme == SamplingScheme::OPPORTUNISTIC_LAYERED_SAMPLE_BY_INDEX)) {
+    size_t size;
+    uint8_t *buf = LoadSection(path, name, in_memory, &size);
+    if (buf == NULL)
+      return 0;
+    BufferStreamBuf stream_buf((char *) buf, size);
+    std::istream in(&stream_buf);
+    size_t in_size = A->Deserialize(in);
+    s_allocator.s_free(buf);
+    return in_size;
+  }
+  uint8_t *buf = LoadSection(path, name, in_memory);
+  if (buf == NULL)
+    return 0;
+  return A->MapBuffer(buf);
+}
+
 uint64_t SuccinctCore::GetOriginalSize() {
   return input_size_;
 }
@@ -536,9 +666,7 @@ uint64_t SuccinctCore::GetOriginalSize() {
 size_t SuccinctCore::StorageSize() {
   size_t tot_size = SuccinctBase::StorageSize();
   tot_size += sizeof(uint64_t);
-  tot_size += sizeof(alphabet_map_.size())
-      + alphabet_map_.size()
-          * (sizeof(char) + sizeof(uint64_t) + sizeof(uint32_t));
+  tot_size += kAlphabetMapSize * sizeof(AlphabetEntry);
   tot_size += sizeof(alphabet_size_) + alphabet_size_ * sizeof(char);
   tot_size += sa_->StorageSize();
   tot_size += isa_->StorageSize();
@@ -549,9 +677,7 @@ size_t SuccinctCore::StorageSize() {
 void SuccinctCore::PrintStorageBreakdown() {
   size_t metadata_size = SuccinctBase::StorageSize();
   metadata_size += sizeof(uint64_t);
-  metadata_size += sizeof(alphabet_map_.size())
-      + alphabet_map_.size()
-          * (sizeof(char) + sizeof(uint64_t) + sizeof(uint32_t));
+  metadata_size += kAlphabetMapSize * sizeof(AlphabetEntry);
   metadata_size += sizeof(alphabet_size_) + alphabet_size_ * sizeof(char);
   fprintf(stderr, "Metadata size = %zu\n", metadata_size);
   fprintf(stderr, "SA size = %zu\n", sa_->StorageSize());
@@ -560,59 +686,28 @@ void SuccinctCore::PrintStorageBreakdown() {
 }
 
 std::pair<int64_t, int64_t> SuccinctCore::BwdSearch(std::string mgram) {
-  std::pair<int64_t, int64_t> range(0, -1), col_range;
   uint64_t m_len = mgram.length();
 
-  if (alphabet_map_.find(mgram[m_len - 1]) != alphabet_map_.end()) {
-    range.first = (alphabet_map_[mgram[m_len - 1]]).first;
-    range.second = alphabet_map_[alphabet_[alphabet_map_[mgram[m_len - 1]]
-        .second + 1]].first - 1;
-  } else
+  Range range = GetColumnRange(mgram[m_len - 1]);
+  if (range.first > range.second)
     return std::make_pair(0, -1);
 
-  for (int64_t i = m_len - 2; i >= 0; i--) {
-    if (alphabet_map_.find(mgram[i]) != alphabet_map_.end()) {
-      col_range.first = alphabet_map_[mgram[i]].first;
-      col_range.second = alphabet_map_[alphabet_[alphabet_map_[mgram[i]].second
-          + 1]].first - 1;
-    } else
-      return std::make_pair(0, -1);
-
-    if (col_range.first > col_range.second)
-      return std::make_pair(0, -1);
-
-    range.first = npa_->BinarySearch(range.first, col_range.first,
-                                     col_range.second, false);
-    range.second = npa_->BinarySearch(range.second, col_range.first,
-                                      col_range.second, true);
-
-    if (range.first > range.second)
-      return range;
-  }
-
-  return range;
+  return ContinueBwdSearch(mgram.c_str(), m_len - 1, range);
 }
 
 std::pair<int64_t, int64_t> SuccinctCore::ContinueBwdSearch(
     std::string mgram, std::pair<int64_t, int64_t> range) {
-  std::pair<int64_t, int64_t> col_range;
-  uint64_t m_len = mgram.length();
-
-  for (int64_t i = m_len - 1; i >= 0; i--) {
-    if (alphabet_map_.find(mgram[i]) != alphabet_map_.end()) {
-      col_range.first = alphabet_map_[mgram[i]].first;
-      col_range.second = alphabet_map_[alphabet_[alphabet_map_[mgram[i]].second
-          + 1]].first - 1;
-    } else
-      return std::make_pair(0, -1);
+  return ContinueBwdSearch(mgram.c_str(), mgram.length(), range);
+}
 
+std::pair<int64_t, int64_t> SuccinctCore::ContinueBwdSearch(
+    const char *p, uint64_t len, std::pair<int64_t, int64_t> range) {
+  for (int64_t i = len - 1; i >= 0; i--) {
+    Range col_range = GetColumnRange(p[i]);
     if (col_range.first > col_range.second)
       return std::make_pair(0, -1);
 
-    range.first = npa_->BinarySearch(range.first, col_range.first,
-                                     col_range.second, false);
-    range.second = npa_->BinarySearch(range.second, col_range.first,
-                                      col_range.second, true);
+    range = npa_->BinarySearchRange(range, col_range.first, col_range.second);
 
     if (range.first > range.second)
       return range;
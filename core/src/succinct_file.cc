@@ -7,17 +7,19 @@ SuccinctFile::SuccinctFile(const std::string& filename, SuccinctMode s_mode,
                            SamplingScheme sa_sampling_scheme,
                            SamplingScheme isa_sampling_scheme,
                            NPA::NPAEncodingScheme npa_encoding_scheme,
-                           uint32_t context_len, uint32_t sampling_range)
+                           uint32_t context_len, uint32_t sampling_range,
+                           uint32_t num_threads,
+                           const PageInConfig& page_in_config)
     : SuccinctCore(filename, s_mode, sa_sampling_rate,
                    isa_sampling_rate, npa_sampling_rate, context_len,
                    sa_sampling_scheme, isa_sampling_scheme, npa_encoding_scheme,
-                   sampling_range) {
+                   sampling_range, num_threads, page_in_config) {
 }
 
 uint64_t SuccinctFile::ComputeContextValue(const char *p, uint64_t i) {
   uint64_t val = 0;
   for (uint64_t t = i; t < i + npa_->GetContextLength(); t++) {
-    val = val * alphabet_size_ + alphabet_map_[p[t]].second;
+    val = val * alphabet_size_ + alphabet_map_[(uint8_t) p[t]].col_id;
   }
 
   return val;
@@ -25,38 +27,14 @@ uint64_t SuccinctFile::ComputeContextValue(const char *p, uint64_t i) {
 
 std::pair<int64_t, int64_t> SuccinctFile::GetRange(const char *p,
                                                    uint64_t len) {
-  std::pair<int64_t, int64_t> range(0, -1);
-  int64_t left, right, c1, c2;
-
-  if (alphabet_map_.find(p[len - 1]) != alphabet_map_.end()) {
-    left = (alphabet_map_[p[len - 1]]).first;
-    right = alphabet_map_[alphabet_[alphabet_map_[p[len - 1]].second + 1]].first
-        - 1;
-  } else {
-    return range;
-  }
-
-  for (int64_t i = len - 2; i >= 0; i--) {
-    if (alphabet_map_.find(p[i]) != alphabet_map_.end()) {
-      c1 = alphabet_map_[p[i]].first;
-      c2 = alphabet_map_[alphabet_[alphabet_map_[p[i]].second + 1]].first - 1;
-    } else
-      return range;
-
-    if (c2 < c1) {
-      return range;
-    }
-
-    left = npa_->BinarySearch(left, c1, c2, false);
-    right = npa_->BinarySearch(right, left, c2, true);
+  std::pair<int64_t, int64_t> range = GetColumnRange(p[len - 1]);
+  if (range.first > range.second)
+    return std::pair<int64_t, int64_t>(0, -1);
 
-    if (left > right) {
-      return range;
-    }
-  }
+  range = ContinueBwdSearch(p, len - 1, range);
+  if (range.first > range.second)
+    return std::pair<int64_t, int64_t>(0, -1);
 
-  range.first = left;
-  range.second = right;
   return range;
 }
 
@@ -81,10 +59,9 @@ std::pair<int64_t, int64_t> SuccinctFile::GetRange(const char *p,
   // context and sigma
 
   // Get sigma_id:
-  if (alphabet_map_.find(p[m - npa_->GetContextLength() - 1])
-      == alphabet_map_.end())
+  if (!alphabet_map_[(uint8_t) p[m - npa_->GetContextLength() - 1]].present)
     return range;
-  sigma_id = alphabet_map_[p[m - npa_->GetContextLength() - 1]].second;
+  sigma_id = alphabet_map_[(uint8_t) p[m - npa_->GetContextLength() - 1]].col_id;
 
   // Get context_id:
   context_val = ComputeContextValue(p, m - npa_->GetContextLength());
@@ -114,9 +91,9 @@ std::pair<int64_t, int64_t> SuccinctFile::GetRange(const char *p,
 
   for (int64_t i = m - npa_->GetContextLength() - 2; i >= 0; i--) {
     // Get sigma_id:
-    if (alphabet_map_.find(p[i]) == alphabet_map_.end())
+    if (!alphabet_map_[(uint8_t) p[i]].present)
       return range;
-    sigma_id = alphabet_map_[p[i]].second;
+    sigma_id = alphabet_map_[(uint8_t) p[i]].col_id;
 
     // Get context_id:
     context_val = ComputeContextValue(p, i + 1);
@@ -159,11 +136,9 @@ std::pair<int64_t, int64_t> SuccinctFile::GetRange(const char *p,
 
 void SuccinctFile::Extract(std::string& result, uint64_t offset, uint64_t len) {
   result.resize(len);
-  uint64_t idx = LookupISA(offset);
-  for (uint64_t k = 0; k < len; k++) {
-    result[k] = alphabet_[LookupC(idx)];
-    idx = LookupNPA(idx);
-  }
+  if (len == 0)
+    return;
+  ExtractChars(LookupISA(offset), len, &result[0]);
 }
 
 uint64_t SuccinctFile::Count(const std::string& str) {
@@ -176,12 +151,23 @@ void SuccinctFile::Search(std::vector<int64_t>& result, const std::string& str)
   if (range.first > range.second)
     return;
   result.resize((uint64_t) (range.second - range.first + 1));
-  for (int64_t i = range.first; i <= range.second; i++) {
-    result[i - range.first] = ((int64_t) LookupSA(i));
-  }
+  LookupSARange(range, &result[0]);
+}
+
+void SuccinctFile::Search(std::vector<int64_t>& result, const std::string& str,
+                          int64_t offset, int64_t limit) {
+  result.clear();
+  std::pair<int64_t, int64_t> range = GetRange(str.c_str(), str.length());
+  range.first += std::max<int64_t>(offset, 0);
+  if (limit >= 0)
+    range.second = std::min(range.second, range.first + limit - 1);
+  if (range.first > range.second)
+    return;
+  result.resize((uint64_t) (range.second - range.first + 1));
+  LookupSARange(range, &result[0]);
 }
 
-void SuccinctFile::RegexSearch(std::set<std::pair<size_t, size_t>>& results,
+void SuccinctFile::RegexSearch(std::vector<std::pair<size_t, size_t>>& results,
                                const std::string& query) {
   SRegEx re(query, this, true);
   re.Execute();
@@ -7,99 +7,75 @@ SuccinctShard::SuccinctShard(uint32_t id, std::string filename,
                              SamplingScheme sa_sampling_scheme,
                              SamplingScheme isa_sampling_scheme,
                              NPA::NPAEncodingScheme npa_encoding_scheme,
-                             uint32_t context_len, uint32_t sampling_range)
+                             uint32_t context_len, uint32_t sampling_range,
+                             uint32_t num_threads,
+                             const PageInConfig& page_in_config)
     : SuccinctCore(filename, s_mode, sa_sampling_rate,
                    isa_sampling_rate, npa_sampling_rate, context_len,
                    sa_sampling_scheme, isa_sampling_scheme, npa_encoding_scheme,
-                   sampling_range) {
+                   sampling_range, num_threads, page_in_config) {
 
   this->id_ = id;
+  this->keys_ = nullptr;
+  this->value_offsets_ = nullptr;
+  this->invalid_offsets_ = nullptr;
+  this->has_invalid_values_ = false;
+  this->owns_key_value_ = false;
+  this->key_value_buf_ = nullptr;
 
   switch (s_mode) {
-    case SuccinctMode::CONSTRUCT_IN_MEMORY: {
-      // Determine keys and value offsets from original input
+    case SuccinctMode::CONSTRUCT_IN_MEMORY:
+    case SuccinctMode::CONSTRUCT_MEMORY_MAPPED: {
+      // Determine keys and value offsets from original input; these are
+      // built in memory in either mode
       std::ifstream input(filename);
-      int64_t value_offset = 0;
+      std::vector<uint64_t> keys, value_offsets;
+      uint64_t value_offset = 0;
       for (uint32_t i = 0; !input.eof(); i++) {
-        keys_.push_back(i);
-        value_offsets_.push_back(value_offset);
+        keys.push_back(i);
+        value_offsets.push_back(value_offset);
         std::string line;
         std::getline(input, line, '\n');
         value_offset += line.length() + 1;
       }
       input.close();
+      CreateKeyValue(keys, value_offsets);
       invalid_offsets_ = new Bitmap;
-      InitBitmap(&invalid_offsets_, keys_.size(), s_allocator);
-      break;
-    }
-    case SuccinctMode::CONSTRUCT_MEMORY_MAPPED: {
-      fprintf(stderr, "Unsupported mode.\n");
-      assert(0);
+      InitBitmap(&invalid_offsets_, GetNumKeys(), s_allocator);
+      has_invalid_values_ = false;
       break;
     }
     case SuccinctMode::LOAD_IN_MEMORY: {
       // Read keys, value offsets, and invalid bitmap from file
-      std::ifstream keyval(filename + "/keyval");
-
-      // Read keys
-      size_t keys_size;
-      keyval.read(reinterpret_cast<char *>(&keys_size), sizeof(size_t));
-      keys_.reserve(keys_size);
-      for (size_t i = 0; i < keys_size; i++) {
-        uint64_t key;
-        keyval.read(reinterpret_cast<char *>(&key), sizeof(int64_t));
-        keys_.push_back(key);
-      }
-
-      // Read values
-      size_t value_offsets_size;
-      keyval.read(reinterpret_cast<char *>(&value_offsets_size),
-                  sizeof(size_t));
-      value_offsets_.reserve(value_offsets_size);
-      for (size_t i = 0; i < value_offsets_size; i++) {
-        uint64_t value_offset;
-        keyval.read(reinterpret_cast<char *>(&value_offset), sizeof(int64_t));
-        value_offsets_.push_back(value_offset);
-      }
-
-      // Read bitmap
-      SuccinctBase::DeserializeBitmap(&invalid_offsets_, keyval);
+      LoadKeyValue(filename, true);
       break;
     }
     case SuccinctMode::LOAD_MEMORY_MAPPED: {
-      uint8_t *data, *data_beg;
-      data = data_beg = (uint8_t *) SuccinctUtils::MemoryMap(
-          filename + "/keyval");
-
-      // Read keys
-      size_t keys_size = *((size_t *) data);
-      data += sizeof(size_t);
-      buf_allocator<int64_t> key_allocator((int64_t *) data);
-      keys_ = std::vector<int64_t>((int64_t *) data,
-                                   (int64_t *) data + keys_size, key_allocator);
-      data += (sizeof(int64_t) * keys_size);
-
-      // Read values
-      size_t value_offsets_size = *((size_t *) data);
-      data += sizeof(size_t);
-      buf_allocator<int64_t> value_offsets_allocator((int64_t *) data);
-      value_offsets_ = std::vector<int64_t>(
-          (int64_t *) data, (int64_t *) data + value_offsets_size,
-          value_offsets_allocator);
-      data += (sizeof(int64_t) * value_offsets_size);
-
-      // Read bitmap
-      data += SuccinctBase::MemoryMapBitmap(&invalid_offsets_, data);
+      // Map keys, value offsets, and invalid bitmap from file
+      LoadKeyValue(filename, false);
       break;
     }
   }
 }
 
+SuccinctShard::~SuccinctShard() {
+  DestroyEliasFanoVector(&keys_, s_allocator, owns_key_value_);
+  DestroyEliasFanoVector(&value_offsets_, s_allocator, owns_key_value_);
+  if (invalid_offsets_ != nullptr) {
+    if (owns_key_value_)
+      DestroyBitmap(&invalid_offsets_, s_allocator);
+    else
+      delete invalid_offsets_;
+  }
+  if (key_value_buf_ != nullptr)
+    s_allocator.s_free(key_value_buf_);
+}
+
 uint64_t SuccinctShard::ComputeContextValue(const char *p, uint64_t i) {
   uint64_t val = 0;
 
   for (uint64_t t = i; t < i + npa_->GetContextLength(); t++) {
-    val = val * alphabet_size_ + alphabet_map_[p[t]].second;
+    val = val * alphabet_size_ + alphabet_map_[(uint8_t) p[t]].col_id;
   }
 
   return val;
@@ -107,45 +83,19 @@ uint64_t SuccinctShard::ComputeContextValue(const char *p, uint64_t i) {
 
 std::pair<int64_t, int64_t> SuccinctShard::GetRange(const char *p,
                                                     uint64_t len) {
-  std::pair<int64_t, int64_t> range(0, -1);
-  int64_t sp, ep, c1, c2;
-
-  if (alphabet_map_.find(p[len - 1]) != alphabet_map_.end()) {
-    sp = (alphabet_map_[p[len - 1]]).first;
-    ep = alphabet_map_[alphabet_[alphabet_map_[p[len - 1]].second + 1]].first
-        - 1;
-  } else {
-    return range;
-  }
-
-  for (int64_t i = len - 2; i >= 0; i--) {
-    if (alphabet_map_.find(p[i]) != alphabet_map_.end()) {
-      c1 = alphabet_map_[p[i]].first;
-      c2 = alphabet_map_[alphabet_[alphabet_map_[p[i]].second + 1]].first - 1;
-    } else {
-      return range;
-    }
-
-    if (c2 < c1) {
-      return range;
-    }
-
-    sp = npa_->BinarySearch(sp, c1, c2, false);
-    ep = npa_->BinarySearch(ep, sp, c2, true);
-
-    if (sp > ep) {
-      return range;
-    }
-  }
+  std::pair<int64_t, int64_t> range = GetColumnRange(p[len - 1]);
+  if (range.first > range.second)
+    return std::pair<int64_t, int64_t>(0, -1);
 
-  range.first = sp;
-  range.second = ep;
+  range = ContinueBwdSearch(p, len - 1, range);
+  if (range.first > range.second)
+    return std::pair<int64_t, int64_t>(0, -1);
 
   return range;
 }
 
 size_t SuccinctShard::GetNumKeys() {
-  return keys_.size();
+  return keys_->size;
 }
 
 uint32_t SuccinctShard::GetSASamplingRate() {
@@ -161,35 +111,33 @@ uint32_t SuccinctShard::GetNPASamplingRate() {
 }
 
 int64_t SuccinctShard::GetValueOffsetPos(const int64_t key) {
-  size_t pos = std::lower_bound(keys_.begin(), keys_.end(), key)
-      - keys_.begin();
+  if (key < 0)
+    return -1;
+  int64_t pos = GetPredecessor(keys_, key);
   return
-      (keys_[pos] != key || pos >= keys_.size()
+      (pos < 0 || (int64_t) LookupEliasFanoVector(keys_, pos) != key
           || ACCESSBIT(invalid_offsets_, pos) == 1) ? -1 : pos;
 }
 
+int64_t SuccinctShard::GetValueOffset(int64_t pos) {
+  if ((uint64_t) pos >= value_offsets_->size)
+    return input_size_;
+  return LookupEliasFanoVector(value_offsets_, pos);
+}
+
 void SuccinctShard::Access(std::string &result, int64_t key, int32_t offset,
                            int32_t len) {
   result = "";
   int64_t pos = GetValueOffsetPos(key);
   if (pos < 0)
     return;
-  int64_t start = value_offsets_[pos] + offset;
-  int64_t end =
-      ((size_t) (pos + 1) < value_offsets_.size()) ?
-      value_offsets_[pos + 1] : input_size_;
+  int64_t start = GetValueOffset(pos) + offset;
+  int64_t end = GetValueOffset(pos + 1);
   len = fmin(len, end - start - 1);
+  if (len <= 0)
+    return;
   result.resize(len);
-  uint64_t idx = LookupISA(start);
-  for (int64_t i = 0; i < len; i++) {
-    result[i] = alphabet_[LookupC(idx)];
-    uint64_t next_pos = start + i + 1;
-    if ((next_pos % isa_->GetSamplingRate()) == 0) {
-      idx = LookupISA(next_pos);
-    } else {
-      idx = LookupNPA(idx);
-    }
-  }
+  ExtractValue(start, len, &result[0]);
 }
 
 void SuccinctShard::Get(std::string &result, int64_t key) {
@@ -197,46 +145,108 @@ void SuccinctShard::Get(std::string &result, int64_t key) {
   int64_t pos = GetValueOffsetPos(key);
   if (pos < 0)
     return;
-  int64_t start = value_offsets_[pos];
-  int64_t end =
-      ((size_t) (pos + 1) < value_offsets_.size()) ?
-      value_offsets_[pos + 1] : input_size_;
+  int64_t start = GetValueOffset(pos);
+  int64_t end = GetValueOffset(pos + 1);
   int64_t len = end - start - 1;
+  if (len <= 0)
+    return;
   result.resize(len);
-  uint64_t idx = LookupISA(start);
-  for (int64_t i = 0; i < len; i++) {
-    result[i] = alphabet_[LookupC(idx)];
-    uint64_t next_pos = start + i + 1;
-    if (isa_->IsSampled(next_pos)) {
-      idx = LookupISA(next_pos);
-    } else {
-      idx = LookupNPA(idx);
-    }
+  ExtractValue(start, len, &result[0]);
+}
+
+void SuccinctShard::ExtractValue(int64_t offset, int64_t len, char *out) {
+  int64_t i = 0;
+  while (i < len) {
+    // Extract up to the next sampled position
+    int64_t j = i + 1;
+    while (j < len && !isa_->IsSampled(offset + j))
+      j++;
+    ExtractChars(LookupISA(offset + i), j - i, out + i);
+    i = j;
   }
 }
 
 int64_t SuccinctShard::GetKeyPos(const int64_t value_offset) {
-  int64_t pos = std::prev(
-      std::upper_bound(value_offsets_.begin(), value_offsets_.end(),
-                       value_offset)) - value_offsets_.begin();
-  return
-      (pos >= (int64_t) value_offsets_.size()
-          || ACCESSBIT(invalid_offsets_, pos) == 1) ? -1 : pos;
+  int64_t pos = GetPredecessor(value_offsets_, value_offset);
+  return (pos < 0 || ACCESSBIT(invalid_offsets_, pos) == 1) ? -1 : pos;
 }
 
-void SuccinctShard::Search(std::set<int64_t> &result, const std::string &str) {
+void SuccinctShard::Search(std::vector<int64_t> &result,
+                           const std::string &str) {
+  result.clear();
   std::pair<int64_t, int64_t> range = GetRange(str.c_str(), str.length());
   if (range.first > range.second)
     return;
+  std::vector<int64_t> offsets((uint64_t) (range.second - range.first + 1));
+  LookupSARange(range, &offsets[0]);
+
+  // Keys increase with their value offsets, so visiting the occurrences in
+  // input order yields the keys sorted; each value is looked up only once
+  SortedVector::RadixSort(offsets);
+  int64_t value_end = -1;
+  for (auto offset : offsets) {
+    if (offset < value_end)
+      continue;
+    int64_t pos = GetPredecessor(value_offsets_, offset);
+    if (pos >= 0 && ACCESSBIT(invalid_offsets_, pos) == 0)
+      result.push_back(LookupEliasFanoVector(keys_, pos));
+    value_end = GetValueOffset(pos + 1);
+  }
+}
+
+void SuccinctShard::Search(std::vector<int64_t> &result,
+                           const std::string &str, int64_t offset,
+                           int64_t limit) {
+  if (offset <= 0 && limit < 0) {
+    Search(result, str);
+    return;
+  }
+
+  result.clear();
+  std::pair<int64_t, int64_t> range = GetRange(str.c_str(), str.length());
+  if (range.first > range.second || limit == 0)
+    return;
+
+  // Keys are only looked up for the page, unless skipping a key requires
+  // checking that it is valid
+  bool check_skipped = HasInvalidValues();
+
+  // Skipped occurrences are walked too, so the walks are bounded as in
+  // CountValueEnds: once they take as many steps as looking up the SA for
+  // every occurrence would, the last occurrences are found from the SA
+  uint64_t budget = (range.second - range.first + 1) * sa_->GetSamplingRate();
+  std::pair<int64_t, int64_t> delimiters = GetColumnRange('\n');
+  int64_t input_end = LookupISA(input_size_ - 1);
+  std::vector<bool> last;
   for (int64_t i = range.first; i <= range.second; i++) {
-    int64_t key_pos = GetKeyPos((int64_t) LookupSA(i));
-    if (key_pos >= 0) {
-      result.insert(keys_[key_pos]);
+    if (last.empty()) {
+      int32_t is_last = IsLastInValue(i, range, delimiters, input_end, budget);
+      if (is_last < 0)
+        FindLastInValues(range, last);
+      else if (!is_last)
+        continue;
     }
+    if (!last.empty() && !last[i - range.first])
+      continue;
+    if (offset > 0 && !check_skipped) {
+      offset--;
+      continue;
+    }
+    int64_t pos = GetKeyPos(LookupSA(i));
+    if (pos < 0)
+      continue;
+    if (offset > 0) {
+      offset--;
+      continue;
+    }
+    result.push_back(LookupEliasFanoVector(keys_, pos));
+    if ((int64_t) result.size() == limit)
+      break;
   }
+  std::sort(result.begin(), result.end());
 }
 
-void SuccinctShard::RegexSearch(std::set<std::pair<size_t, size_t>> &result,
+void SuccinctShard::RegexSearch(std::vector<std::pair<size_t, size_t>> &result,
                                 const std::string &query, bool opt) {
   SRegEx re(query, this, opt);
   re.Execute();
@@ -249,20 +259,120 @@ void SuccinctShard::RegexCount(std::vector<size_t> &result,
   re.Count(result);
 }
 
-int64_t SuccinctShard::Count(const std::string &str) {
-  std::set<int64_t> result;
-  Search(result, str);
-  return result.size();
+int64_t SuccinctShard::Count(const std::string &str, bool approximate) {
+  if (approximate)
+    return FlatCount(str);
+
+  std::pair<int64_t, int64_t> range = GetRange(str.c_str(), str.length());
+  if (range.first > range.second)
+    return 0;
+
+  int64_t count = CountValueEnds(range);
+  if (count < 0)
+    count = CountValueOffsets(range);
+  return count;
+}
+
+bool SuccinctShard::HasInvalidValues() {
+  return has_invalid_values_;
+}
+
+uint64_t SuccinctShard::CountInvalidValues() {
+  uint64_t count = 0;
+  for (uint64_t i = 0; i < BITS2BLOCKS(invalid_offsets_->size); i++) {
+    count += SuccinctUtils::PopCount(invalid_offsets_->bitmap[i]);
+  }
+  return count;
+}
+
+int32_t SuccinctShard::IsLastInValue(int64_t i,
+                                     std::pair<int64_t, int64_t> range,
+                                     std::pair<int64_t, int64_t> delimiters,
+                                     int64_t input_end, uint64_t &budget) {
+  int64_t idx = i;
+  while (true) {
+    if ((idx >= delimiters.first && idx <= delimiters.second)
+        || idx == input_end)
+      return 1;
+    if (budget-- == 0)
+      return -1;
+    idx = LookupNPA(idx);
+    if (idx >= range.first && idx <= range.second)
+      return 0;
+  }
+}
+
+int64_t SuccinctShard::CountValueEnds(std::pair<int64_t, int64_t> range) {
+  // Values must be mapped back to keys to check if they are invalid
+  if (HasInvalidValues())
+    return -1;
+
+  // Stop once the walks take as many steps as looking up the SA would
+  uint64_t budget = (range.second - range.first + 1) * sa_->GetSamplingRate();
+  std::pair<int64_t, int64_t> delimiters = GetColumnRange('\n');
+  int64_t input_end = LookupISA(input_size_ - 1);
+
+  int64_t count = 0;
+  for (int64_t i = range.first; i <= range.second; i++) {
+    int32_t last = IsLastInValue(i, range, delimiters, input_end, budget);
+    if (last < 0)
+      return -1;
+    count += last;
+  }
+  return count;
+}
+
+void SuccinctShard::FindLastInValues(std::pair<int64_t, int64_t> range,
+                                     std::vector<bool> &last) {
+  std::vector<int64_t> offsets((uint64_t) (range.second - range.first + 1));
+  LookupSARange(range, &offsets[0]);
+
+  // The last occurrence in each value is the one followed by the value end
+  // or by an occurrence in the next value, in input order
+  std::vector<int64_t> sorted(offsets);
+  SortedVector::RadixSort(sorted);
+  std::vector<int64_t> last_offsets;
+  for (size_t j = 0; j < sorted.size(); j++) {
+    if (j + 1 == sorted.size()
+        || sorted[j + 1] >= GetValueOffset(
+            GetPredecessor(value_offsets_, sorted[j]) + 1))
+      last_offsets.push_back(sorted[j]);
+  }
+
+  last.resize(offsets.size());
+  for (size_t j = 0; j < offsets.size(); j++) {
+    last[j] = std::binary_search(last_offsets.begin(), last_offsets.end(),
+                                 offsets[j]);
+  }
+}
+
+int64_t SuccinctShard::CountValueOffsets(std::pair<int64_t, int64_t> range) {
+  std::vector<int64_t> offsets((uint64_t) (range.second - range.first + 1));
+  LookupSARange(range, &offsets[0]);
+
+  // Visit the occurrences in input order, so that the occurrences within a
+  // value are adjacent; each value is then looked up only once
+  SortedVector::RadixSort(offsets);
+  int64_t count = 0;
+  int64_t value_end = -1;
+  for (auto offset : offsets) {
+    if (offset < value_end)
+      continue;
+    int64_t pos = GetPredecessor(value_offsets_, offset);
+    if (pos >= 0 && ACCESSBIT(invalid_offsets_, pos) == 0)
+      count++;
+    value_end = GetValueOffset(pos + 1);
+  }
+  return count;
 }
 
 void SuccinctShard::FlatExtract(std::string &result, int64_t offset,
                                 int64_t len) {
   result = "";
-  uint64_t idx = LookupISA(offset);
-  for (uint64_t k = 0; k < len; k++) {
-    result += alphabet_[LookupC(idx)];
-    idx = LookupNPA(idx);
-  }
+  if (len <= 0)
+    return;
+  result.resize(len);
+  ExtractChars(LookupISA(offset), len, &result[0]);
 }
 
 int64_t SuccinctShard::FlatCount(const std::string &str) {
@@ -275,115 +385,123 @@ void SuccinctShard::FlatSearch(std::vector<int64_t> &result,
   std::pair<int64_t, int64_t> range = GetRange(str.c_str(), str.length());
   if (range.first > range.second)
     return;
-  result.reserve((uint64_t) (range.second - range.first + 1));
-  for (int64_t i = range.first; i <= range.second; i++) {
-    result.push_back((int64_t) LookupSA(i));
-  }
+  size_t result_offset = result.size();
+  result.resize(result_offset + (range.second - range.first + 1));
+  LookupSARange(range, &result[result_offset]);
 }
 
-size_t SuccinctShard::Serialize(const std::string &path) {
-  size_t out_size = SuccinctCore::Serialize(path);
+void SuccinctShard::CreateKeyValue(const std::vector<uint64_t> &keys,
+                                   const std::vector<uint64_t> &value_offsets) {
+  keys_ = new EliasFanoVector;
+  CreateEliasFanoVector(keys_, keys.data(), keys.size(), s_allocator);
+  value_offsets_ = new EliasFanoVector;
+  CreateEliasFanoVector(value_offsets_, value_offsets.data(),
+                        value_offsets.size(), s_allocator);
+  owns_key_value_ = true;
+}
 
-  // Write keys, value offsets, and invalid bitmap to file
-  std::ofstream keyval(path + "/keyval");
+size_t SuccinctShard::SerializeKeyValue(std::ostream &out) {
+  size_t out_size = 0;
 
   // Write keys
-  size_t keys_size = keys_.size();
-  keyval.write(reinterpret_cast<const char *>(&(keys_size)), sizeof(size_t));
-  out_size += sizeof(size_t);
-  for (size_t i = 0; i < keys_.size(); i++) {
-    keyval.write(reinterpret_cast<const char *>(&keys_[i]), sizeof(int64_t));
-    out_size += sizeof(int64_t);
-  }
+  out_size += SerializeEliasFanoVector(keys_, out);
 
   // Write values
-  size_t value_offsets_size = value_offsets_.size();
-  keyval.write(reinterpret_cast<const char *>(&(value_offsets_size)),
-               sizeof(size_t));
-  out_size += sizeof(size_t);
-  for (size_t i = 0; i < value_offsets_.size(); i++) {
-    keyval.write(reinterpret_cast<const char *>(&value_offsets_[i]),
-                 sizeof(int64_t));
-    out_size += sizeof(int64_t);
-  }
+  out_size += SerializeEliasFanoVector(value_offsets_, out);
 
   // Write bitmap
-  SuccinctBase::SerializeBitmap(invalid_offsets_, keyval);
+  out_size += SuccinctBase::SerializeBitmap(invalid_offsets_, out);
 
   return out_size;
 }
 
-size_t SuccinctShard::Deserialize(const std::string &path) {
-  size_t in_size = SuccinctCore::Deserialize(path);
-
-  // Read keys, value offsets, and invalid bitmap from file
-  std::ifstream keyval(path + "/keyval");
+size_t SuccinctShard::DeserializeKeyValue(std::istream &in) {
+  size_t in_size = 0;
 
   // Read keys
-  size_t keys_size;
-  keyval.read(reinterpret_cast<char *>(&keys_size), sizeof(size_t));
-  in_size += sizeof(size_t);
-  keys_.reserve(keys_size);
-  for (size_t i = 0; i < keys_size; i++) {
-    uint64_t key;
-    keyval.read(reinterpret_cast<char *>(&key), sizeof(int64_t));
-    keys_.push_back(key);
-    in_size += sizeof(int64_t);
-  }
+  keys_ = new EliasFanoVector;
+  in_size += DeserializeEliasFanoVector(keys_, in);
 
   // Read values
-  size_t value_offsets_size;
-  keyval.read(reinterpret_cast<char *>(&value_offsets_size), sizeof(size_t));
-  in_size += sizeof(size_t);
-  value_offsets_.reserve(value_offsets_size);
-  for (size_t i = 0; i < value_offsets_size; i++) {
-    uint64_t value_offset;
-    keyval.read(reinterpret_cast<char *>(&value_offset), sizeof(int64_t));
-    value_offsets_.push_back(value_offset);
-    in_size += sizeof(int64_t);
-  }
+  value_offsets_ = new EliasFanoVector;
+  in_size += DeserializeEliasFanoVector(value_offsets_, in);
 
   // Read bitmap
-  SuccinctBase::DeserializeBitmap(&invalid_offsets_, keyval);
+  in_size += SuccinctBase::DeserializeBitmap(&invalid_offsets_, in);
+  has_invalid_values_ = CountInvalidValues() > 0;
+  owns_key_value_ = true;
 
   return in_size;
 }
 
-size_t SuccinctShard::MemoryMap(const std::string &path) {
-  size_t core_size = SuccinctCore::MemoryMap(path);
-
+size_t SuccinctShard::MemoryMapKeyValue(uint8_t *buf) {
   uint8_t *data, *data_beg;
-  data = data_beg = (uint8_t *) SuccinctUtils::MemoryMap(path + "/keyval");
+  data = data_beg = buf;
 
-  // Read keys
-  size_t keys_size = *((size_t *) data);
-  data += sizeof(size_t);
-  buf_allocator<int64_t> key_allocator((int64_t *) data);
-  keys_ = std::vector<int64_t>((int64_t *) data, (int64_t *) data + keys_size,
-                               key_allocator);
-  data += (keys_size * sizeof(int64_t));
+  // Map keys
+  data += MemoryMapEliasFanoVector(&keys_, data);
 
-  // Read values
-  size_t value_offsets_size = *((size_t *) data);
-  fprintf(stderr, "Value offsets size = %zu\n", value_offsets_size);
-  data += sizeof(size_t);
-  buf_allocator<int64_t> value_offsets_allocator((int64_t *) data);
-  value_offsets_ = std::vector<int64_t>((int64_t *) data,
-                                        (int64_t *) data + value_offsets_size,
-                                        value_offsets_allocator);
-  data += (sizeof(int64_t) * value_offsets_size);
+  // Map values
+  data += MemoryMapEliasFanoVector(&value_offsets_, data);
 
-  // Read bitmap
+  // Map bitmap
   data += SuccinctBase::MemoryMapBitmap(&invalid_offsets_, data);
+  has_invalid_values_ = CountInvalidValues() > 0;
+  owns_key_value_ = false;
+
+  return data - data_beg;
+}
+
+size_t SuccinctShard::SerializeSections(SuccinctContainer::Writer &writer) {
+  size_t out_size = SuccinctCore::SerializeSections(writer);
+
+  // Write keys, value offsets, and invalid bitmap
+  out_size += SerializeKeyValue(writer.BeginSection("keyval"));
+  writer.EndSection();
+
+  return out_size;
+}
+
+size_t SuccinctShard::Deserialize(const std::string &path) {
+  size_t in_size = SuccinctCore::Deserialize(path);
+  if (in_size == 0)
+    return 0;
+
+  // Read keys, value offsets, and invalid bitmap
+  size_t kv_size = LoadKeyValue(path, true);
+
+  return kv_size == 0 ? 0 : in_size + kv_size;
+}
+
+size_t SuccinctShard::MemoryMap(const std::string &path) {
+  size_t core_size = SuccinctCore::MemoryMap(path);
+  if (core_size == 0)
+    return 0;
+  size_t kv_size = LoadKeyValue(path, false);
+  return kv_size == 0 ? 0 : core_size + kv_size;
+}
+
+size_t SuccinctShard::LoadKeyValue(const std::string &path, bool in_memory) {
+  if (!loaded_)
+    return 0;
+  uint8_t *buf = LoadSection(path, "keyval", in_memory);
+  if (buf == NULL) {
+    loaded_ = false;
+    return 0;
+  }
 
-  return core_size + (data - data_beg);
+  // Keys, offsets and bitmap are laid out over the section; when it is read
+  // into memory, the shard frees it
+  if (in_memory)
+    key_value_buf_ = buf;
+  return MemoryMapKeyValue(buf);
 }
 
 size_t SuccinctShard::StorageSize() {
   size_t tot_size = SuccinctCore::StorageSize();
   tot_size += sizeof(sizeof(uint32_t));
-  tot_size += keys_.size() * sizeof(int64_t) + sizeof(size_t);
-  tot_size += value_offsets_.size() * sizeof(int64_t) + sizeof(size_t);
+  tot_size += SuccinctBase::EliasFanoVectorSize(keys_);
+  tot_size += SuccinctBase::EliasFanoVectorSize(value_offsets_);
   tot_size += SuccinctBase::BitmapSize(invalid_offsets_);
   return tot_size;
 }
@@ -0,0 +1,126 @@
+#include "utils/numa_utils.h"
+
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace {
+
+// Memory policy constants of <linux/mempolicy.h>, so that libnuma is not
+// needed
+const int kPolicyPreferred = 1;
+const int kPolicyBind = 2;
+const unsigned kMoveFlag = 1 << 1;
+
+const int kMaxNodes = 1024;
+const int kBitsPerWord = 8 * sizeof(unsigned long);
+
+const char *kNodePath = "/sys/devices/system/node/";
+
+size_t PageSize() {
+  static const size_t page_size = sysconf(_SC_PAGESIZE);
+  return page_size;
+}
+
+// Mask with only node set
+std::vector<unsigned long> NodeMask(int node) {
+  std::vector<unsigned long> mask(kMaxNodes / kBitsPerWord, 0);
+  mask[node / kBitsPerWord] = 1UL << (node % kBitsPerWord);
+  return mask;
+}
+
+// Parses a sysfs list, such as "0-3,8,10-11"
+bool ParseList(const std::string& list, std::vector<int> *values) {
+  std::stringstream ss(list);
+  std::string range;
+  while (std::getline(ss, range, ',')) {
+    int first, last;
+    int n = sscanf(range.c_str(), "%d-%d", &first, &last);
+    if (n < 1)
+      continue;
+    if (n == 1)
+      last = first;
+    for (int i = first; i <= last; i++) {
+      values->push_back(i);
+    }
+  }
+  return !values->empty();
+}
+
+}
+
+int NumaUtils::NumNodes() {
+  std::ifstream in(std::string(kNodePath) + "online");
+  std::string list;
+  std::vector<int> nodes;
+  if (!std::getline(in, list) || !ParseList(list, &nodes))
+    return 1;
+  return nodes.back() + 1;
+}
+
+bool NumaUtils::NodeCpus(int node, std::vector<int> *cpus) {
+  std::ifstream in(
+      std::string(kNodePath) + "node" + std::to_string(node) + "/cpulist");
+  std::string list;
+  if (!std::getline(in, list)) {
+    // Without NUMA support, every CPU is on node 0
+    if (node != 0)
+      return false;
+    long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    for (long cpu = 0; cpu < num_cpus; cpu++) {
+      cpus->push_back(cpu);
+    }
+    return true;
+  }
+  return ParseList(list, cpus);
+}
+
+bool NumaUtils::BindThread(int node) {
+  std::vector<int> cpus;
+  if (node < 0 || node >= kMaxNodes || !NodeCpus(node, &cpus))
+    return false;
+
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (int cpu : cpus) {
+    CPU_SET(cpu, &cpu_set);
+  }
+  if (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) != 0) {
+    perror("sched_setaffinity");
+    return false;
+  }
+
+  // Preferred rather than bound, so that allocations spill over to other
+  // nodes instead of failing when node runs out of memory
+  std::vector<unsigned long> mask = NodeMask(node);
+  if (syscall(SYS_set_mempolicy, kPolicyPreferred, mask.data(),
+              (unsigned long) kMaxNodes) != 0) {
+    perror("set_mempolicy");
+    return false;
+  }
+  return true;
+}
+
+bool NumaUtils::BindMemory(const void *data, size_t size, int node) {
+  if (size == 0 || node < 0 || node >= kMaxNodes)
+    return false;
+  uintptr_t begin = (uintptr_t) data & ~(uintptr_t) (PageSize() - 1);
+  size_t length = (uintptr_t) data + size - begin;
+  std::vector<unsigned long> mask = NodeMask(node);
+  return syscall(SYS_mbind, begin, length, kPolicyBind, mask.data(),
+                 (unsigned long) kMaxNodes, kMoveFlag) == 0;
+}
+
+int NumaUtils::NodeOf(const void *data) {
+  void *page = (void *) ((uintptr_t) data & ~(uintptr_t) (PageSize() - 1));
+  int status = -1;
+  if (syscall(SYS_move_pages, 0, 1UL, &page, NULL, &status, 0) != 0)
+    return -1;
+  return status < 0 ? -1 : status;
+}
@@ -0,0 +1,178 @@
+#include "utils/page_warmer.h"
+#include "utils/numa_utils.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace {
+
+// Policy called name, if any
+bool ParsePolicy(const std::string& name, PageInPolicy *policy) {
+  if (name == "populate") {
+    *policy = PAGE_IN_POPULATE;
+  } else if (name == "lazy") {
+    *policy = PAGE_IN_LAZY;
+  } else if (name == "prefetch") {
+    *policy = PAGE_IN_PREFETCH;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+size_t PageSize() {
+  static const size_t page_size = sysconf(_SC_PAGESIZE);
+  return page_size;
+}
+
+// Fault in the pages of size bytes at data, reading them ahead first
+void Touch(const uint8_t *data, size_t size) {
+  uintptr_t begin = (uintptr_t) data & ~(uintptr_t) (PageSize() - 1);
+  size_t length = (uintptr_t) data + size - begin;
+#ifdef MADV_POPULATE_READ
+  if (madvise((void *) begin, length, MADV_POPULATE_READ) == 0)
+    return;
+#endif
+  madvise((void *) begin, length, MADV_WILLNEED);
+  volatile uint8_t sink = 0;
+  for (uintptr_t page = begin; page < (uintptr_t) data + size; page +=
+      PageSize()) {
+    sink += *(volatile const uint8_t *) std::max(page, (uintptr_t) data);
+  }
+  (void) sink;
+}
+
+}
+
+PageInPolicy PageInConfig::GetPolicy(const std::string& name) const {
+  auto it = policies.find(name);
+  return it == policies.end() ? default_policy : it->second;
+}
+
+bool PageInConfig::Parse(const std::string& spec, PageInConfig *config) {
+  PageInConfig parsed;
+  size_t begin = 0;
+  for (bool first = true; begin <= spec.size(); first = false) {
+    size_t end = std::min(spec.find(',', begin), spec.size());
+    std::string item = spec.substr(begin, end - begin);
+    begin = end + 1;
+
+    size_t eq = item.find('=');
+    PageInPolicy policy;
+    if (first && eq == std::string::npos) {
+      if (!ParsePolicy(item, &policy))
+        return false;
+      parsed.default_policy = policy;
+    } else {
+      if (eq == std::string::npos || eq == 0
+          || !ParsePolicy(item.substr(eq + 1), &policy))
+        return false;
+      parsed.policies[item.substr(0, eq)] = policy;
+    }
+  }
+
+  parsed.prefetch_rate = config->prefetch_rate;
+  parsed.numa_node = config->numa_node;
+  *config = parsed;
+  return true;
+}
+
+PageWarmer::PageWarmer(uint64_t bytes_per_sec, int numa_node)
+    : bytes_per_sec_(bytes_per_sec),
+      numa_node_(numa_node),
+      busy_(false),
+      stop_(false),
+      bytes_warmed_(0) {
+  thread_ = std::thread(&PageWarmer::Run, this);
+}
+
+PageWarmer::~PageWarmer() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  work_.notify_all();
+  thread_.join();
+}
+
+void PageWarmer::Add(const void *data, size_t size) {
+  if (size == 0)
+    return;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    ranges_.push_back(Range { (const uint8_t *) data, size });
+  }
+  work_.notify_one();
+}
+
+void PageWarmer::Wait() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_.wait(lock, [this] {return ranges_.empty() && !busy_;});
+}
+
+size_t PageWarmer::BytesWarmed() {
+  return bytes_warmed_;
+}
+
+void PageWarmer::Populate(const void *data, size_t size) {
+  if (size > 0)
+    Touch((const uint8_t *) data, size);
+}
+
+void PageWarmer::Advise(const void *data, size_t size, PageInPolicy policy) {
+  if (size == 0)
+    return;
+  uintptr_t begin = (uintptr_t) data & ~(uintptr_t) (PageSize() - 1);
+  size_t length = (uintptr_t) data + size - begin;
+  madvise((void *) begin, length,
+          policy == PAGE_IN_LAZY ? MADV_RANDOM : MADV_NORMAL);
+}
+
+void PageWarmer::Run() {
+  typedef std::chrono::steady_clock Clock;
+  while (true) {
+    Range range;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      busy_ = false;
+      if (ranges_.empty())
+        done_.notify_all();
+      work_.wait(lock, [this] {return !ranges_.empty() || stop_;});
+      if (stop_)
+        break;
+      range = ranges_.front();
+      ranges_.pop_front();
+      busy_ = true;
+    }
+
+    // Warm a chunk at a time, waiting whenever the warmer gets ahead of
+    // its bandwidth, so that it does not starve queries of disk bandwidth;
+    // the wait ends early if the warmer is stopped
+    Clock::time_point start = Clock::now();
+    for (size_t done = 0; done < range.size;) {
+      if (stop_)
+        break;
+      size_t chunk = std::min(kChunkSize, range.size - done);
+      Touch(range.data + done, chunk);
+      if (numa_node_ >= 0)
+        NumaUtils::BindMemory(range.data + done, chunk, numa_node_);
+      done += chunk;
+      bytes_warmed_ += chunk;
+      if (bytes_per_sec_ > 0) {
+        Clock::time_point deadline = start
+            + std::chrono::microseconds(
+                (uint64_t) (done * 1e6 / bytes_per_sec_));
+        std::unique_lock<std::mutex> lock(mutex_);
+        work_.wait_until(lock, deadline, [this] {return stop_.load();});
+      }
+    }
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  busy_ = false;
+  done_.notify_all();
+}
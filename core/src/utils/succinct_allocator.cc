@@ -1,5 +1,66 @@
 #include "utils/succinct_allocator.h"
 
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+// A block mapped on huge pages, by its start
+struct HugePageMapping {
+  size_t length;
+  bool hugetlb;
+};
+
+std::atomic<bool> default_use_hugepages(false);
+std::atomic<size_t> hugetlb_bytes(0);
+std::atomic<size_t> thp_bytes(0);
+std::atomic<size_t> num_fallbacks(0);
+
+std::mutex& MappingsMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::unordered_map<void *, HugePageMapping>& Mappings() {
+  static std::unordered_map<void *, HugePageMapping> mappings;
+  return mappings;
+}
+
+// Forget the mapping of ptr, if it was mapped on huge pages
+bool TakeMapping(void *ptr, HugePageMapping *mapping) {
+  std::lock_guard<std::mutex> lock(MappingsMutex());
+  auto it = Mappings().find(ptr);
+  if (it == Mappings().end())
+    return false;
+  *mapping = it->second;
+  Mappings().erase(it);
+  return true;
+}
+
+void Unmap(void *ptr, const HugePageMapping &mapping) {
+  munmap(ptr, mapping.length);
+  if (mapping.hugetlb) {
+    hugetlb_bytes -= mapping.length;
+  } else {
+    thp_bytes -= mapping.length;
+  }
+}
+
+}
+
+/*
+ * Constructor; uses huge pages if they are enabled by default.
+ *
+ */
+SuccinctAllocator::SuccinctAllocator() {
+  this->use_hugepages_ = default_use_hugepages;
+}
+
 /*
  * Constructor
  *
@@ -13,18 +74,31 @@ SuccinctAllocator::SuccinctAllocator(bool s_use_hugepages) {
  *
  */
 bool SuccinctAllocator::UseHugePages() {
-  use_hugepages_ = false;
+  use_hugepages_ = true;
   return use_hugepages_;
 }
 
+/*
+ * Enable or disable the use of huge pages by allocators created without an
+ * explicit choice.
+ *
+ */
+void SuccinctAllocator::UseHugePagesByDefault(bool use_hugepages) {
+  default_use_hugepages = use_hugepages;
+}
+
 /*
  * Allocates a block of size bytes of memory, returning a pointer to the
  * beginning of the block.
  *
  */
 void* SuccinctAllocator::s_malloc(size_t size) {
-  if (use_hugepages_) {
-    return 0;
+  if (use_hugepages_ && size >= kHugePageSize) {
+    void *ptr = HugePageAlloc(size);
+    if (ptr != NULL) {
+      return ptr;
+    }
+    num_fallbacks++;
   }
   return malloc(size);
 }
@@ -35,8 +109,13 @@ void* SuccinctAllocator::s_malloc(size_t size) {
  *
  */
 void* SuccinctAllocator::s_calloc(size_t num, size_t size) {
-  if (use_hugepages_) {
-    return 0;
+  if (use_hugepages_ && num * size >= kHugePageSize) {
+    // Fresh anonymous mappings are already zeroed
+    void *ptr = HugePageAlloc(num * size);
+    if (ptr != NULL) {
+      return ptr;
+    }
+    num_fallbacks++;
   }
   return calloc(num, size);
 }
@@ -46,10 +125,20 @@ void* SuccinctAllocator::s_calloc(size_t num, size_t size) {
  *
  */
 void* SuccinctAllocator::s_realloc(void* ptr, size_t size) {
-  if (use_hugepages_) {
-    return 0;
+  HugePageMapping mapping;
+  if (ptr == NULL || !TakeMapping(ptr, &mapping)) {
+    return realloc(ptr, size);
   }
-  return realloc(ptr, size);
+
+  void *new_ptr = s_malloc(size);
+  if (new_ptr == NULL) {
+    std::lock_guard<std::mutex> lock(MappingsMutex());
+    Mappings()[ptr] = mapping;
+    return NULL;
+  }
+  memcpy(new_ptr, ptr, std::min(size, mapping.length));
+  Unmap(ptr, mapping);
+  return new_ptr;
 }
 
 /*
@@ -59,7 +148,9 @@ void* SuccinctAllocator::s_realloc(void* ptr, size_t size) {
  *
  */
 void SuccinctAllocator::s_free(void* ptr) {
-  if (use_hugepages_) {
+  HugePageMapping mapping;
+  if (ptr != NULL && TakeMapping(ptr, &mapping)) {
+    Unmap(ptr, mapping);
     return;
   }
   free(ptr);
@@ -71,8 +162,93 @@ void SuccinctAllocator::s_free(void* ptr) {
  *
  */
 void *SuccinctAllocator::s_memset(void *ptr, int value, size_t num) {
-  if (use_hugepages_) {
-    return 0;
-  }
   return memset(ptr, value, num);
 }
+
+/*
+ * Bytes currently mapped on explicit (MAP_HUGETLB) huge pages.
+ *
+ */
+size_t SuccinctAllocator::HugeTLBBytes() {
+  return hugetlb_bytes;
+}
+
+/*
+ * Bytes currently mapped on pages advised for transparent huge pages.
+ *
+ */
+size_t SuccinctAllocator::TransparentHugePageBytes() {
+  return thp_bytes;
+}
+
+/*
+ * Number of huge page allocations that fell back to the heap.
+ *
+ */
+size_t SuccinctAllocator::NumFallbacks() {
+  return num_fallbacks;
+}
+
+/*
+ * Whether ptr is the start of a block mapped on huge pages, rather than
+ * taken from the heap.
+ *
+ */
+bool SuccinctAllocator::IsMapped(const void* ptr) {
+  std::lock_guard<std::mutex> lock(MappingsMutex());
+  return Mappings().count(const_cast<void *>(ptr)) > 0;
+}
+
+/*
+ * Maps a block of at least size bytes on huge pages, trying explicit huge
+ * pages first and transparent huge pages next; returns NULL if neither is
+ * available.
+ *
+ */
+void* SuccinctAllocator::HugePageAlloc(size_t size) {
+  size_t length = (size + kHugePageSize - 1) & ~(kHugePageSize - 1);
+  HugePageMapping mapping;
+  void *ptr = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+  ptr = mmap(NULL, length, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+  if (ptr != MAP_FAILED) {
+    mapping.length = length;
+    mapping.hugetlb = true;
+    hugetlb_bytes += length;
+  } else {
+#ifdef MADV_HUGEPAGE
+    // Over-allocate so that the block can start on a huge page boundary, and
+    // trim the excess on either side
+    size_t padded = length + kHugePageSize;
+    uint8_t *raw = (uint8_t *) mmap(NULL, padded, PROT_READ | PROT_WRITE,
+                                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+      return NULL;
+    }
+    uintptr_t start = ((uintptr_t) raw + kHugePageSize - 1)
+        & ~(uintptr_t) (kHugePageSize - 1);
+    size_t head = start - (uintptr_t) raw;
+    if (head > 0) {
+      munmap(raw, head);
+    }
+    munmap((uint8_t *) start + length, padded - head - length);
+    ptr = (void *) start;
+    if (madvise(ptr, length, MADV_HUGEPAGE) != 0) {
+      munmap(ptr, length);
+      return NULL;
+    }
+    mapping.length = length;
+    mapping.hugetlb = false;
+    thp_bytes += length;
+#else
+    return NULL;
+#endif
+  }
+
+  std::lock_guard<std::mutex> lock(MappingsMutex());
+  Mappings()[ptr] = mapping;
+  return ptr;
+}
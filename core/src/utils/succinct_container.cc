@@ -0,0 +1,375 @@
+#include "utils/succinct_container.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+const uint32_t SuccinctContainer::kVersion;
+const uint32_t SuccinctContainer::kMaxSections;
+const uint64_t SuccinctContainer::kAlignment;
+const char SuccinctContainer::kMagic[8] = { 'S', 'U', 'C', 'C', 'I', 'N', 'C',
+    'T' };
+
+namespace {
+
+// Files of a serialized directory, in the order they become sections
+const char *kDirectoryFiles[] = { "metadata", "sa", "isa", "npa", "keyval" };
+
+const size_t kHeaderSize = sizeof(SuccinctContainer::Header)
+    + SuccinctContainer::kMaxSections * sizeof(SuccinctContainer::SectionEntry);
+
+// Read size bytes at offset of fd into data; false on error or end of file
+bool ReadFully(int fd, uint8_t *data, size_t size, uint64_t offset) {
+  size_t done = 0;
+  while (done < size) {
+    ssize_t n = pread(fd, data + done, std::min<size_t>(size - done, 1 << 26),
+                      offset + done);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    done += n;
+  }
+  return true;
+}
+
+}
+
+SuccinctContainer::Writer::ChecksumBuf::ChecksumBuf(std::ofstream& out)
+    : out_(out),
+      buf_(kBufferSize) {
+  Reset();
+}
+
+void SuccinctContainer::Writer::ChecksumBuf::Reset() {
+  setp(&buf_[0], &buf_[0] + buf_.size());
+  checksum_ = kChecksumSeed;
+  size_ = 0;
+}
+
+uint64_t SuccinctContainer::Writer::ChecksumBuf::Finish() {
+  Flush();
+  return ChecksumFinish(checksum_, size_);
+}
+
+uint64_t SuccinctContainer::Writer::ChecksumBuf::Size() {
+  return size_ + (pptr() - pbase());
+}
+
+int SuccinctContainer::Writer::ChecksumBuf::overflow(int c) {
+  Flush();
+  if (c != EOF) {
+    *pptr() = (char) c;
+    pbump(1);
+  }
+  return 0;
+}
+
+std::streamsize SuccinctContainer::Writer::ChecksumBuf::xsputn(
+    const char *s, std::streamsize n) {
+  std::streamsize done = 0;
+  while (done < n) {
+    if (pptr() == epptr())
+      Flush();
+    std::streamsize chunk = std::min<std::streamsize>(n - done,
+                                                      epptr() - pptr());
+    memcpy(pptr(), s + done, chunk);
+    pbump((int) chunk);
+    done += chunk;
+  }
+  return n;
+}
+
+// Checksum and write out the buffer; only the last flush of a section may
+// hold a partial word
+void SuccinctContainer::Writer::ChecksumBuf::Flush() {
+  size_t n = pptr() - pbase();
+  checksum_ = ChecksumUpdate(checksum_, (const uint8_t *) pbase(), n);
+  out_.write(pbase(), n);
+  size_ += n;
+  setp(&buf_[0], &buf_[0] + buf_.size());
+}
+
+SuccinctContainer::Writer::Writer(const std::string& path)
+    : out_(path, std::ios::binary | std::ios::trunc),
+      checksum_buf_(out_),
+      section_out_(&checksum_buf_),
+      offset_(kHeaderSize) {
+  // The header and section table are filled in on Close
+  std::vector<char> zeros(kHeaderSize, 0);
+  out_.write(&zeros[0], zeros.size());
+}
+
+SuccinctContainer::Writer::~Writer() {
+  if (out_.is_open()) {
+    Close();
+  }
+}
+
+bool SuccinctContainer::Writer::IsOpen() {
+  return out_.is_open() && out_.good();
+}
+
+std::ostream& SuccinctContainer::Writer::BeginSection(const std::string& name) {
+  assert(sections_.size() < kMaxSections);
+  assert(name.size() < sizeof(SectionEntry::name));
+
+  uint64_t padding = (kAlignment - offset_ % kAlignment) % kAlignment;
+  std::vector<char> zeros(padding, 0);
+  out_.write(zeros.data(), padding);
+  offset_ += padding;
+
+  SectionEntry entry;
+  memset(&entry, 0, sizeof(entry));
+  strncpy(entry.name, name.c_str(), sizeof(entry.name) - 1);
+  entry.offset = offset_;
+  sections_.push_back(entry);
+
+  checksum_buf_.Reset();
+  return section_out_;
+}
+
+void SuccinctContainer::Writer::EndSection() {
+  SectionEntry& entry = sections_.back();
+  entry.size = checksum_buf_.Size();
+  entry.checksum = checksum_buf_.Finish();
+  offset_ += entry.size;
+}
+
+bool SuccinctContainer::Writer::Close() {
+  Header header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.num_sections = sections_.size();
+  header.file_size = offset_;
+
+  out_.seekp(0);
+  out_.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  out_.write(reinterpret_cast<const char *>(sections_.data()),
+             sections_.size() * sizeof(SectionEntry));
+  out_.close();
+  return !out_.fail();
+}
+
+SuccinctContainer::SuccinctContainer(const std::string& path)
+    : path_(path),
+      is_open_(false),
+      mapping_(NULL) {
+  memset(&header_, 0, sizeof(header_));
+  int fd = open(path.c_str(), O_RDONLY, 0);
+  if (fd == -1) {
+    fprintf(stderr, "Could not open %s: %s\n", path.c_str(), strerror(errno));
+    return;
+  }
+
+  std::vector<uint8_t> buf(kHeaderSize);
+  struct stat st;
+  bool read_ok = fstat(fd, &st) == 0
+      && ReadFully(fd, &buf[0], kHeaderSize, 0);
+  close(fd);
+  memcpy(&header_, &buf[0], sizeof(Header));
+  if (!read_ok || memcmp(header_.magic, kMagic, sizeof(kMagic)) != 0) {
+    fprintf(stderr, "%s is not a succinct container\n", path.c_str());
+    return;
+  }
+  if (header_.version != kVersion) {
+    fprintf(stderr, "%s has format version %u; expected version %u\n",
+            path.c_str(), header_.version, kVersion);
+    return;
+  }
+  if (header_.num_sections > kMaxSections
+      || header_.file_size > (uint64_t) st.st_size) {
+    fprintf(stderr, "%s is truncated or has a corrupt header\n",
+            path.c_str());
+    return;
+  }
+
+  // Sections must lie within the file, so that a mapping of the whole file
+  // covers them
+  const SectionEntry *entries = (const SectionEntry *) (&buf[0]
+      + sizeof(Header));
+  for (uint32_t i = 0; i < header_.num_sections; i++) {
+    const SectionEntry& entry = entries[i];
+    if (entry.offset < kHeaderSize || entry.offset > header_.file_size
+        || entry.size > header_.file_size - entry.offset) {
+      fprintf(stderr, "Section %u of %s lies outside the file\n", i,
+              path.c_str());
+      sections_.clear();
+      return;
+    }
+    std::string name(entry.name, strnlen(entry.name, sizeof(entry.name)));
+    sections_[name] = entry;
+  }
+  is_open_ = true;
+}
+
+SuccinctContainer::~SuccinctContainer() {
+  if (mapping_ != NULL) {
+    munmap(mapping_, header_.file_size);
+  }
+}
+
+bool SuccinctContainer::IsContainer(const std::string& path) {
+  int fd = open(path.c_str(), O_RDONLY, 0);
+  if (fd == -1)
+    return false;
+  char magic[sizeof(kMagic)];
+  bool is_container = ReadFully(fd, (uint8_t *) magic, sizeof(magic), 0)
+      && memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+  close(fd);
+  return is_container;
+}
+
+bool SuccinctContainer::ConvertDirectory(const std::string& dir,
+                                         const std::string& path) {
+  std::ifstream metadata(dir + "/metadata", std::ios::binary);
+  if (!metadata.is_open()) {
+    fprintf(stderr, "%s is not a serialized directory\n", dir.c_str());
+    return false;
+  }
+  metadata.close();
+
+  Writer writer(path);
+  if (!writer.IsOpen()) {
+    fprintf(stderr, "Could not create %s\n", path.c_str());
+    return false;
+  }
+
+  std::vector<char> buf(kBufferSize);
+  for (const char *name : kDirectoryFiles) {
+    std::ifstream in(dir + "/" + name, std::ios::binary);
+    if (!in.is_open())
+      continue;
+    std::ostream& out = writer.BeginSection(name);
+    while (in) {
+      in.read(&buf[0], buf.size());
+      out.write(&buf[0], in.gcount());
+    }
+    if (in.bad()) {
+      fprintf(stderr, "Could not read %s/%s\n", dir.c_str(), name);
+      return false;
+    }
+    writer.EndSection();
+  }
+  if (!writer.Close()) {
+    fprintf(stderr, "Could not write %s\n", path.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool SuccinctContainer::HasSection(const std::string& name) {
+  return sections_.find(name) != sections_.end();
+}
+
+size_t SuccinctContainer::SectionSize(const std::string& name) {
+  const SectionEntry *entry = FindSection(name);
+  return entry == NULL ? 0 : entry->size;
+}
+
+uint8_t *SuccinctContainer::MapSection(const std::string& name) {
+  const SectionEntry *entry = FindSection(name);
+  if (entry == NULL)
+    return NULL;
+  if (mapping_ == NULL) {
+    int fd = open(path_.c_str(), O_RDONLY, 0);
+    if (fd == -1) {
+      fprintf(stderr, "Could not open %s: %s\n", path_.c_str(),
+              strerror(errno));
+      return NULL;
+    }
+    void *data = mmap(NULL, header_.file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+      fprintf(stderr, "Could not map %s: %s\n", path_.c_str(),
+              strerror(errno));
+      return NULL;
+    }
+    mapping_ = (uint8_t *) data;
+  }
+  return mapping_ + entry->offset;
+}
+
+uint8_t *SuccinctContainer::ReadSection(const std::string& name,
+                                        SuccinctAllocator& s_allocator) {
+  const SectionEntry *entry = FindSection(name);
+  if (entry == NULL)
+    return NULL;
+  int fd = open(path_.c_str(), O_RDONLY, 0);
+  if (fd == -1) {
+    fprintf(stderr, "Could not open %s: %s\n", path_.c_str(),
+            strerror(errno));
+    return NULL;
+  }
+#ifdef POSIX_FADV_SEQUENTIAL
+  posix_fadvise(fd, entry->offset, entry->size, POSIX_FADV_SEQUENTIAL);
+#endif
+
+  uint8_t *data = (uint8_t *) s_allocator.s_malloc(entry->size);
+  bool read_ok = data != NULL
+      && ReadFully(fd, data, entry->size, entry->offset);
+  close(fd);
+  if (!read_ok || Checksum(data, entry->size) != entry->checksum) {
+    fprintf(stderr, "Section %s of %s is corrupt\n", name.c_str(),
+            path_.c_str());
+    if (data != NULL)
+      s_allocator.s_free(data);
+    return NULL;
+  }
+  return data;
+}
+
+bool SuccinctContainer::VerifySection(const std::string& name) {
+  const SectionEntry *entry = FindSection(name);
+  if (entry == NULL)
+    return false;
+  uint8_t *data = MapSection(name);
+  return data != NULL && Checksum(data, entry->size) == entry->checksum;
+}
+
+uint64_t SuccinctContainer::Checksum(const uint8_t *data, size_t size) {
+  return ChecksumFinish(ChecksumUpdate(kChecksumSeed, data, size), size);
+}
+
+// FNV-1a over 64-bit words, with a zero-padded last word
+uint64_t SuccinctContainer::ChecksumUpdate(uint64_t checksum,
+                                           const uint8_t *data, size_t size) {
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, data + i, sizeof(uint64_t));
+    checksum = (checksum ^ word) * kChecksumPrime;
+  }
+  if (i < size) {
+    uint64_t word = 0;
+    memcpy(&word, data + i, size - i);
+    checksum = (checksum ^ word) * kChecksumPrime;
+  }
+  return checksum;
+}
+
+uint64_t SuccinctContainer::ChecksumFinish(uint64_t checksum, uint64_t size) {
+  checksum = (checksum ^ size) * kChecksumPrime;
+  checksum ^= checksum >> 33;
+  checksum *= 0xff51afd7ed558ccdULL;
+  checksum ^= checksum >> 33;
+  return checksum;
+}
+
+const SuccinctContainer::SectionEntry *SuccinctContainer::FindSection(
+    const std::string& name) {
+  auto it = sections_.find(name);
+  if (it == sections_.end()) {
+    fprintf(stderr, "%s has no section %s\n", path_.c_str(), name.c_str());
+    return NULL;
+  }
+  return &it->second;
+}
@@ -15,7 +15,7 @@
 void print_usage(char *exec) {
   fprintf(
       stderr,
-      "Usage: %s [-s sa_sampling_rate] [-i isa_sampling_rate] [-x sampling_scheme] [-n npa_sampling_rate] [-r npa_encoding_scheme] [-t input_type] [file]\n",
+      "Usage: %s [-s sa_sampling_rate] [-i isa_sampling_rate] [-x sampling_scheme] [-n npa_sampling_rate] [-r npa_encoding_scheme] [-t input_type] [-p num_threads] [file]\n",
       exec);
 }
 
@@ -76,7 +76,7 @@ int main(int argc, char **argv) {
   // Logic to parse command line arguments
 
   // starts here ==>
-  if (argc < 2 || argc > 12) {
+  if (argc < 2 || argc > 14) {
     print_usage(argv[0]);
     return -1;
   }
@@ -89,8 +89,9 @@ int main(int argc, char **argv) {
   NPA::NPAEncodingScheme npa_encoding_scheme =
       NPA::NPAEncodingScheme::ELIAS_GAMMA_ENCODED;
   std::string type = "file";
+  uint32_t num_threads = 1;
 
-  while ((c = getopt(argc, argv, "s:i:x:n:r:t:")) != -1) {
+  while ((c = getopt(argc, argv, "s:i:x:n:r:t:p:")) != -1) {
     switch (c) {
       case 's': {
         sa_sampling_rate = atoi(optarg);
@@ -116,6 +117,10 @@ int main(int argc, char **argv) {
         type = optarg;
         break;
       }
+      case 'p': {
+        num_threads = atoi(optarg);
+        break;
+      }
       default: {
         fprintf(stderr, "Error parsing options\n");
         exit(-1);
@@ -140,7 +145,8 @@ int main(int argc, char **argv) {
                                 SuccinctMode::CONSTRUCT_IN_MEMORY,
                                 sa_sampling_rate, isa_sampling_rate,
                                 npa_sampling_rate, sampling_scheme,
-                                sampling_scheme, npa_encoding_scheme);
+                                sampling_scheme, npa_encoding_scheme, 3, 1024,
+                                num_threads);
 
     // Serialize the compressed representation to disk at the location <inputpath>.succinct
     fd->Serialize(inputpath + ".succinct");
@@ -154,7 +160,8 @@ int main(int argc, char **argv) {
                                  SuccinctMode::CONSTRUCT_IN_MEMORY,
                                  sa_sampling_rate, isa_sampling_rate,
                                  npa_sampling_rate, sampling_scheme,
-                                 sampling_scheme, npa_encoding_scheme);
+                                 sampling_scheme, npa_encoding_scheme, 3, 1024,
+                                 num_threads);
 
     // Serialize the compressed representation to disk at the location <inputpath>.succinct
     fd->Serialize(inputpath + ".succinct");
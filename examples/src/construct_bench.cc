@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "succinct_file.h"
+
+/**
+ * Example program that measures how long it takes to compress an input file
+ * using Succinct, as the number of construction threads grows.
+ */
+
+/**
+ * Prints usage
+ */
+void print_usage(char *exec) {
+  fprintf(stderr, "Usage: %s [-p max_threads] [-r repeats] [file]\n", exec);
+}
+
+/**
+ * Returns the current time in microseconds
+ */
+uint64_t get_timestamp() {
+  struct timeval now;
+  gettimeofday(&now, NULL);
+
+  return now.tv_usec + (uint64_t) now.tv_sec * 1000000;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2 || argc > 6) {
+    print_usage(argv[0]);
+    return -1;
+  }
+
+  int c;
+  uint32_t max_threads = std::thread::hardware_concurrency();
+  uint32_t repeats = 1;
+  while ((c = getopt(argc, argv, "p:r:")) != -1) {
+    switch (c) {
+      case 'p': {
+        max_threads = atoi(optarg);
+        break;
+      }
+      case 'r': {
+        repeats = atoi(optarg);
+        break;
+      }
+      default: {
+        fprintf(stderr, "Error parsing options\n");
+        exit(-1);
+      }
+    }
+  }
+
+  if (optind == argc) {
+    print_usage(argv[0]);
+    return -1;
+  }
+
+  std::string inputpath = std::string(argv[optind]);
+
+  // Construct with 1, 2, 4, ... threads, up to max_threads
+  fprintf(stdout, "threads\tconstruction_time(s)\n");
+  for (uint32_t num_threads = 1; num_threads <= std::max(max_threads, 1U);
+      num_threads *= 2) {
+    uint64_t total_time = 0;
+    for (uint32_t r = 0; r < repeats; r++) {
+      uint64_t start = get_timestamp();
+      auto *fd = new SuccinctFile(inputpath, SuccinctMode::CONSTRUCT_IN_MEMORY,
+                                  32, 32, 128,
+                                  SamplingScheme::FLAT_SAMPLE_BY_INDEX,
+                                  SamplingScheme::FLAT_SAMPLE_BY_INDEX,
+                                  NPA::NPAEncodingScheme::ELIAS_GAMMA_ENCODED,
+                                  3, 1024, num_threads);
+      total_time += get_timestamp() - start;
+      delete fd;
+    }
+    fprintf(stdout, "%u\t%lf\n", num_threads,
+            ((double) total_time / repeats) / 1000000.0);
+  }
+
+  return 0;
+}
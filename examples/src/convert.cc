@@ -0,0 +1,47 @@
+#include <cstdio>
+#include <string>
+
+#include "utils/succinct_container.h"
+
+/**
+ * Example program that converts data structures serialized in the older
+ * directory layout, with a file per data structure, into a single-file
+ * container.
+ */
+
+/**
+ * Prints usage
+ */
+void print_usage(char *exec) {
+  fprintf(stderr, "Usage: %s [directory] [container]\n", exec);
+}
+
+int main(int argc, char **argv) {
+  if (argc != 3) {
+    print_usage(argv[0]);
+    return -1;
+  }
+
+  std::string dir = argv[1];
+  std::string path = argv[2];
+  if (!SuccinctContainer::ConvertDirectory(dir, path)) {
+    return -1;
+  }
+
+  // Check the written sections against their checksums
+  SuccinctContainer container(path);
+  const char *names[] = { "metadata", "sa", "isa", "npa", "keyval" };
+  for (const char *name : names) {
+    if (!container.HasSection(name))
+      continue;
+    if (!container.VerifySection(name)) {
+      fprintf(stderr, "Section %s of %s does not match its checksum\n", name,
+              path.c_str());
+      return -1;
+    }
+    fprintf(stderr, "Converted %s (%zu bytes)\n", name,
+            container.SectionSize(name));
+  }
+
+  return 0;
+}
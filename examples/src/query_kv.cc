@@ -90,7 +90,7 @@ int main(int argc, char **argv) {
         std::cerr << "Could not parse argument: " << cmd_line << "\n";
         continue;
       }
-      std::set<int64_t> results;
+      std::vector<int64_t> results;
       timestamp_t start = get_timestamp();
       s_file->Search(results, arg);
       timestamp_t tot_time = get_timestamp() - start;
@@ -17,6 +17,32 @@ if [ "$NUM_SHARDS" = "" ]; then
 	NUM_SHARDS="1"
 fi
 
+if [ "$SHARDS_PER_SERVER" = "" ]; then
+	SHARDS_PER_SERVER="1"
+fi
+
+if [ "$QUERY_TIMEOUT_MS" = "" ]; then
+	QUERY_TIMEOUT_MS="0"
+fi
+
+# Threaded servers run a thread per connection; pooled servers share a fixed
+# pool of workers across connections
+SERVER_OPTS=""
+if [ "$SERVER_MODE" = "pooled" ]; then
+	SERVER_OPTS="-n"
+	if [ "$SERVER_WORKERS" != "" ]; then
+		SERVER_OPTS="$SERVER_OPTS -w $SERVER_WORKERS"
+	fi
+	if [ "$SERVER_MAX_PENDING" != "" ]; then
+		SERVER_OPTS="$SERVER_OPTS -q $SERVER_MAX_PENDING"
+	fi
+fi
+
+# Idle connections kept open to each shard
+if [ "$AGGREGATOR_MAX_IDLE" != "" ]; then
+	SERVER_OPTS="$SERVER_OPTS -i $AGGREGATOR_MAX_IDLE"
+fi
+
 mkdir -p $SUCCINCT_LOG_PATH
 
-nohup "$AGGREGATOR" -s "$NUM_SHARDS" 2>"$SUCCINCT_LOG_PATH/aggregator.log" >/dev/null &
+nohup "$AGGREGATOR" -s "$NUM_SHARDS" -l "$SHARDS_PER_SERVER" -t "$QUERY_TIMEOUT_MS" $SERVER_OPTS 2>"$SUCCINCT_LOG_PATH/aggregator.log" >/dev/null &
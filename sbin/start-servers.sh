@@ -32,6 +32,10 @@ if [ "$NUM_SHARDS" = "" ]; then
     NUM_SHARDS="1"
 fi
 
+if [ "$SHARDS_PER_SERVER" = "" ]; then
+    SHARDS_PER_SERVER="1"
+fi
+
 if [ "$SA_SAMPLING_RATE" = "" ]; then
     SA_SAMPLING_RATE="32"
 fi
@@ -48,9 +52,59 @@ if [ "$NPA_SCHEME" = "" ]; then
     NPA_SCHEME="1"
 fi
 
-limit=$(($NUM_SHARDS - 1))
+# Threaded servers run a thread per connection; pooled servers share a fixed
+# pool of workers across connections
+SERVER_OPTS=""
+if [ "$SERVER_MODE" = "pooled" ]; then
+	SERVER_OPTS="-n"
+	if [ "$SERVER_WORKERS" != "" ]; then
+		SERVER_OPTS="$SERVER_OPTS -w $SERVER_WORKERS"
+	fi
+	if [ "$SERVER_MAX_PENDING" != "" ]; then
+		SERVER_OPTS="$SERVER_OPTS -q $SERVER_MAX_PENDING"
+	fi
+fi
+
+# Back the shards with huge pages, falling back to regular pages
+if [ "$HUGE_PAGES" = "TRUE" ]; then
+	SERVER_OPTS="$SERVER_OPTS -g"
+fi
+
+# Memory map the shards instead of reading them into memory; mapped sections
+# are paged in as set by PAGE_IN (e.g. "prefetch,keyval=populate"), with
+# background prefetching limited to PREFETCH_MBPS MB/s
+LOAD_MODE="1"
+if [ "$MEMORY_MAPPED" = "TRUE" ]; then
+	LOAD_MODE="2"
+	if [ "$PAGE_IN" != "" ]; then
+		SERVER_OPTS="$SERVER_OPTS -l $PAGE_IN"
+	fi
+	if [ "$PREFETCH_MBPS" != "" ]; then
+		SERVER_OPTS="$SERVER_OPTS -b $PREFETCH_MBPS"
+	fi
+fi
+
+# Servers are bound in turn to the NUMA nodes listed in NUMA_NODES: their
+# threads run on the node's cores, and their shards are placed in its memory
+NODES=($NUMA_NODES)
+
+# Each server hosts $SHARDS_PER_SERVER consecutive shards
+NUM_SERVERS=$((($NUM_SHARDS + $SHARDS_PER_SERVER - 1) / $SHARDS_PER_SERVER))
+limit=$(($NUM_SERVERS - 1))
 for i in `seq 0 $limit`; do
 	PORT=$(($QUERY_SERVER_PORT + $i))
-	DATA_FILE="$SUCCINCT_DATA_PATH/data_$i"
-	nohup "$QUERY_SERVER" -m 1 -p $PORT -s $SA_SAMPLING_RATE -i $ISA_SAMPLING_RATE -x $SAMPLING_SCHEME -r $NPA_SCHEME $DATA_FILE 2>"$SUCCINCT_LOG_PATH/server_${i}.log" > /dev/null &
+	DATA_FILES=""
+	first=$(($i * $SHARDS_PER_SERVER))
+	last=$(($first + $SHARDS_PER_SERVER - 1))
+	if [ $last -ge $NUM_SHARDS ]; then
+		last=$(($NUM_SHARDS - 1))
+	fi
+	for j in `seq $first $last`; do
+		DATA_FILES="$DATA_FILES $SUCCINCT_DATA_PATH/data_$j"
+	done
+	NUMA_OPTS=""
+	if [ ${#NODES[@]} -gt 0 ]; then
+		NUMA_OPTS="-N ${NODES[$(($i % ${#NODES[@]}))]}"
+	fi
+	nohup "$QUERY_SERVER" -m $LOAD_MODE -p $PORT -s $SA_SAMPLING_RATE -i $ISA_SAMPLING_RATE -x $SAMPLING_SCHEME -r $NPA_SCHEME $SERVER_OPTS $NUMA_OPTS $DATA_FILES 2>"$SUCCINCT_LOG_PATH/server_${i}.log" > /dev/null &
 done
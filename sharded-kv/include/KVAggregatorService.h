@@ -1,1624 +0,0 @@
-/**
- * Autogenerated by Thrift Compiler (0.12.0)
- *
- * DO NOT EDIT UNLESS YOU ARE SURE THAT YOU KNOW WHAT YOU ARE DOING
- *  @generated
- */
-#ifndef KVAggregatorService_H
-#define KVAggregatorService_H
-
-#include <thrift/TDispatchProcessor.h>
-#include <thrift/async/TConcurrentClientSyncInfo.h>
-#include "succinctkv_types.h"
-
-
-
-#ifdef _MSC_VER
-  #pragma warning( push )
-  #pragma warning (disable : 4250 ) //inheriting methods via dominance 
-#endif
-
-class KVAggregatorServiceIf {
- public:
-  virtual ~KVAggregatorServiceIf() {}
-  virtual int32_t ConnectToServers() = 0;
-  virtual int32_t DisconnectFromServers() = 0;
-  virtual int32_t Initialize() = 0;
-  virtual void Get(std::string& _return, const int64_t key) = 0;
-  virtual void Access(std::string& _return, const int64_t key, const int32_t offset, const int32_t len) = 0;
-  virtual void Search(std::set<int64_t> & _return, const std::string& query) = 0;
-  virtual void Regex(std::set<int64_t> & _return, const std::string& query) = 0;
-  virtual int64_t Count(const std::string& query) = 0;
-  virtual int32_t GetNumShards() = 0;
-  virtual int32_t GetNumKeys() = 0;
-  virtual int32_t GetNumKeysShard(const int32_t shard_id) = 0;
-  virtual int64_t GetTotSize() = 0;
-};
-
-class KVAggregatorServiceIfFactory {
- public:
-  typedef KVAggregatorServiceIf Handler;
-
-  virtual ~KVAggregatorServiceIfFactory() {}
-
-  virtual KVAggregatorServiceIf* getHandler(const ::apache::thrift::TConnectionInfo& connInfo) = 0;
-  virtual void releaseHandler(KVAggregatorServiceIf* /* handler */) = 0;
-};
-
-class KVAggregatorServiceIfSingletonFactory : virtual public KVAggregatorServiceIfFactory {
- public:
-  KVAggregatorServiceIfSingletonFactory(const ::apache::thrift::stdcxx::shared_ptr<KVAggregatorServiceIf>& iface) : iface_(iface) {}
-  virtual ~KVAggregatorServiceIfSingletonFactory() {}
-
-  virtual KVAggregatorServiceIf* getHandler(const ::apache::thrift::TConnectionInfo&) {
-    return iface_.get();
-  }
-  virtual void releaseHandler(KVAggregatorServiceIf* /* handler */) {}
-
- protected:
-  ::apache::thrift::stdcxx::shared_ptr<KVAggregatorServiceIf> iface_;
-};
-
-class KVAggregatorServiceNull : virtual public KVAggregatorServiceIf {
- public:
-  virtual ~KVAggregatorServiceNull() {}
-  int32_t ConnectToServers() {
-    int32_t _return = 0;
-    return _return;
-  }
-  int32_t DisconnectFromServers() {
-    int32_t _return = 0;
-    return _return;
-  }
-  int32_t Initialize() {
-    int32_t _return = 0;
-    return _return;
-  }
-  void Get(std::string& /* _return */, const int64_t /* key */) {
-    return;
-  }
-  void Access(std::string& /* _return */, const int64_t /* key */, const int32_t /* offset */, const int32_t /* len */) {
-    return;
-  }
-  void Search(std::set<int64_t> & /* _return */, const std::string& /* query */) {
-    return;
-  }
-  void Regex(std::set<int64_t> & /* _return */, const std::string& /* query */) {
-    return;
-  }
-  int64_t Count(const std::string& /* query */) {
-    int64_t _return = 0;
-    return _return;
-  }
-  int32_t GetNumShards() {
-    int32_t _return = 0;
-    return _return;
-  }
-  int32_t GetNumKeys() {
-    int32_t _return = 0;
-    return _return;
-  }
-  int32_t GetNumKeysShard(const int32_t /* shard_id */) {
-    int32_t _return = 0;
-    return _return;
-  }
-  int64_t GetTotSize() {
-    int64_t _return = 0;
-    return _return;
-  }
-};
-
-
-class KVAggregatorService_ConnectToServers_args {
- public:
-
-  KVAggregatorService_ConnectToServers_args(const KVAggregatorService_ConnectToServers_args&);
-  KVAggregatorService_ConnectToServers_args& operator=(const KVAggregatorService_ConnectToServers_args&);
-  KVAggregatorService_ConnectToServers_args() {
-  }
-
-  virtual ~KVAggregatorService_ConnectToServers_args() throw();
-
-  bool operator == (const KVAggregatorService_ConnectToServers_args & /* rhs */) const
-  {
-    return true;
-  }
-  bool operator != (const KVAggregatorService_ConnectToServers_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_ConnectToServers_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVAggregatorService_ConnectToServers_pargs {
- public:
-
-
-  virtual ~KVAggregatorService_ConnectToServers_pargs() throw();
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_ConnectToServers_result__isset {
-  _KVAggregatorService_ConnectToServers_result__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_ConnectToServers_result__isset;
-
-class KVAggregatorService_ConnectToServers_result {
- public:
-
-  KVAggregatorService_ConnectToServers_result(const KVAggregatorService_ConnectToServers_result&);
-  KVAggregatorService_ConnectToServers_result& operator=(const KVAggregatorService_ConnectToServers_result&);
-  KVAggregatorService_ConnectToServers_result() : success(0) {
-  }
-
-  virtual ~KVAggregatorService_ConnectToServers_result() throw();
-  int32_t success;
-
-  _KVAggregatorService_ConnectToServers_result__isset __isset;
-
-  void __set_success(const int32_t val);
-
-  bool operator == (const KVAggregatorService_ConnectToServers_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVAggregatorService_ConnectToServers_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_ConnectToServers_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_ConnectToServers_presult__isset {
-  _KVAggregatorService_ConnectToServers_presult__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_ConnectToServers_presult__isset;
-
-class KVAggregatorService_ConnectToServers_presult {
- public:
-
-
-  virtual ~KVAggregatorService_ConnectToServers_presult() throw();
-  int32_t* success;
-
-  _KVAggregatorService_ConnectToServers_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-
-class KVAggregatorService_DisconnectFromServers_args {
- public:
-
-  KVAggregatorService_DisconnectFromServers_args(const KVAggregatorService_DisconnectFromServers_args&);
-  KVAggregatorService_DisconnectFromServers_args& operator=(const KVAggregatorService_DisconnectFromServers_args&);
-  KVAggregatorService_DisconnectFromServers_args() {
-  }
-
-  virtual ~KVAggregatorService_DisconnectFromServers_args() throw();
-
-  bool operator == (const KVAggregatorService_DisconnectFromServers_args & /* rhs */) const
-  {
-    return true;
-  }
-  bool operator != (const KVAggregatorService_DisconnectFromServers_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_DisconnectFromServers_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVAggregatorService_DisconnectFromServers_pargs {
- public:
-
-
-  virtual ~KVAggregatorService_DisconnectFromServers_pargs() throw();
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_DisconnectFromServers_result__isset {
-  _KVAggregatorService_DisconnectFromServers_result__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_DisconnectFromServers_result__isset;
-
-class KVAggregatorService_DisconnectFromServers_result {
- public:
-
-  KVAggregatorService_DisconnectFromServers_result(const KVAggregatorService_DisconnectFromServers_result&);
-  KVAggregatorService_DisconnectFromServers_result& operator=(const KVAggregatorService_DisconnectFromServers_result&);
-  KVAggregatorService_DisconnectFromServers_result() : success(0) {
-  }
-
-  virtual ~KVAggregatorService_DisconnectFromServers_result() throw();
-  int32_t success;
-
-  _KVAggregatorService_DisconnectFromServers_result__isset __isset;
-
-  void __set_success(const int32_t val);
-
-  bool operator == (const KVAggregatorService_DisconnectFromServers_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVAggregatorService_DisconnectFromServers_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_DisconnectFromServers_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_DisconnectFromServers_presult__isset {
-  _KVAggregatorService_DisconnectFromServers_presult__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_DisconnectFromServers_presult__isset;
-
-class KVAggregatorService_DisconnectFromServers_presult {
- public:
-
-
-  virtual ~KVAggregatorService_DisconnectFromServers_presult() throw();
-  int32_t* success;
-
-  _KVAggregatorService_DisconnectFromServers_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-
-class KVAggregatorService_Initialize_args {
- public:
-
-  KVAggregatorService_Initialize_args(const KVAggregatorService_Initialize_args&);
-  KVAggregatorService_Initialize_args& operator=(const KVAggregatorService_Initialize_args&);
-  KVAggregatorService_Initialize_args() {
-  }
-
-  virtual ~KVAggregatorService_Initialize_args() throw();
-
-  bool operator == (const KVAggregatorService_Initialize_args & /* rhs */) const
-  {
-    return true;
-  }
-  bool operator != (const KVAggregatorService_Initialize_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_Initialize_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVAggregatorService_Initialize_pargs {
- public:
-
-
-  virtual ~KVAggregatorService_Initialize_pargs() throw();
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_Initialize_result__isset {
-  _KVAggregatorService_Initialize_result__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_Initialize_result__isset;
-
-class KVAggregatorService_Initialize_result {
- public:
-
-  KVAggregatorService_Initialize_result(const KVAggregatorService_Initialize_result&);
-  KVAggregatorService_Initialize_result& operator=(const KVAggregatorService_Initialize_result&);
-  KVAggregatorService_Initialize_result() : success(0) {
-  }
-
-  virtual ~KVAggregatorService_Initialize_result() throw();
-  int32_t success;
-
-  _KVAggregatorService_Initialize_result__isset __isset;
-
-  void __set_success(const int32_t val);
-
-  bool operator == (const KVAggregatorService_Initialize_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVAggregatorService_Initialize_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_Initialize_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_Initialize_presult__isset {
-  _KVAggregatorService_Initialize_presult__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_Initialize_presult__isset;
-
-class KVAggregatorService_Initialize_presult {
- public:
-
-
-  virtual ~KVAggregatorService_Initialize_presult() throw();
-  int32_t* success;
-
-  _KVAggregatorService_Initialize_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-typedef struct _KVAggregatorService_Get_args__isset {
-  _KVAggregatorService_Get_args__isset() : key(false) {}
-  bool key :1;
-} _KVAggregatorService_Get_args__isset;
-
-class KVAggregatorService_Get_args {
- public:
-
-  KVAggregatorService_Get_args(const KVAggregatorService_Get_args&);
-  KVAggregatorService_Get_args& operator=(const KVAggregatorService_Get_args&);
-  KVAggregatorService_Get_args() : key(0) {
-  }
-
-  virtual ~KVAggregatorService_Get_args() throw();
-  int64_t key;
-
-  _KVAggregatorService_Get_args__isset __isset;
-
-  void __set_key(const int64_t val);
-
-  bool operator == (const KVAggregatorService_Get_args & rhs) const
-  {
-    if (!(key == rhs.key))
-      return false;
-    return true;
-  }
-  bool operator != (const KVAggregatorService_Get_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_Get_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVAggregatorService_Get_pargs {
- public:
-
-
-  virtual ~KVAggregatorService_Get_pargs() throw();
-  const int64_t* key;
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_Get_result__isset {
-  _KVAggregatorService_Get_result__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_Get_result__isset;
-
-class KVAggregatorService_Get_result {
- public:
-
-  KVAggregatorService_Get_result(const KVAggregatorService_Get_result&);
-  KVAggregatorService_Get_result& operator=(const KVAggregatorService_Get_result&);
-  KVAggregatorService_Get_result() : success() {
-  }
-
-  virtual ~KVAggregatorService_Get_result() throw();
-  std::string success;
-
-  _KVAggregatorService_Get_result__isset __isset;
-
-  void __set_success(const std::string& val);
-
-  bool operator == (const KVAggregatorService_Get_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVAggregatorService_Get_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_Get_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_Get_presult__isset {
-  _KVAggregatorService_Get_presult__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_Get_presult__isset;
-
-class KVAggregatorService_Get_presult {
- public:
-
-
-  virtual ~KVAggregatorService_Get_presult() throw();
-  std::string* success;
-
-  _KVAggregatorService_Get_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-typedef struct _KVAggregatorService_Access_args__isset {
-  _KVAggregatorService_Access_args__isset() : key(false), offset(false), len(false) {}
-  bool key :1;
-  bool offset :1;
-  bool len :1;
-} _KVAggregatorService_Access_args__isset;
-
-class KVAggregatorService_Access_args {
- public:
-
-  KVAggregatorService_Access_args(const KVAggregatorService_Access_args&);
-  KVAggregatorService_Access_args& operator=(const KVAggregatorService_Access_args&);
-  KVAggregatorService_Access_args() : key(0), offset(0), len(0) {
-  }
-
-  virtual ~KVAggregatorService_Access_args() throw();
-  int64_t key;
-  int32_t offset;
-  int32_t len;
-
-  _KVAggregatorService_Access_args__isset __isset;
-
-  void __set_key(const int64_t val);
-
-  void __set_offset(const int32_t val);
-
-  void __set_len(const int32_t val);
-
-  bool operator == (const KVAggregatorService_Access_args & rhs) const
-  {
-    if (!(key == rhs.key))
-      return false;
-    if (!(offset == rhs.offset))
-      return false;
-    if (!(len == rhs.len))
-      return false;
-    return true;
-  }
-  bool operator != (const KVAggregatorService_Access_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_Access_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVAggregatorService_Access_pargs {
- public:
-
-
-  virtual ~KVAggregatorService_Access_pargs() throw();
-  const int64_t* key;
-  const int32_t* offset;
-  const int32_t* len;
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_Access_result__isset {
-  _KVAggregatorService_Access_result__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_Access_result__isset;
-
-class KVAggregatorService_Access_result {
- public:
-
-  KVAggregatorService_Access_result(const KVAggregatorService_Access_result&);
-  KVAggregatorService_Access_result& operator=(const KVAggregatorService_Access_result&);
-  KVAggregatorService_Access_result() : success() {
-  }
-
-  virtual ~KVAggregatorService_Access_result() throw();
-  std::string success;
-
-  _KVAggregatorService_Access_result__isset __isset;
-
-  void __set_success(const std::string& val);
-
-  bool operator == (const KVAggregatorService_Access_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVAggregatorService_Access_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_Access_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_Access_presult__isset {
-  _KVAggregatorService_Access_presult__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_Access_presult__isset;
-
-class KVAggregatorService_Access_presult {
- public:
-
-
-  virtual ~KVAggregatorService_Access_presult() throw();
-  std::string* success;
-
-  _KVAggregatorService_Access_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-typedef struct _KVAggregatorService_Search_args__isset {
-  _KVAggregatorService_Search_args__isset() : query(false) {}
-  bool query :1;
-} _KVAggregatorService_Search_args__isset;
-
-class KVAggregatorService_Search_args {
- public:
-
-  KVAggregatorService_Search_args(const KVAggregatorService_Search_args&);
-  KVAggregatorService_Search_args& operator=(const KVAggregatorService_Search_args&);
-  KVAggregatorService_Search_args() : query() {
-  }
-
-  virtual ~KVAggregatorService_Search_args() throw();
-  std::string query;
-
-  _KVAggregatorService_Search_args__isset __isset;
-
-  void __set_query(const std::string& val);
-
-  bool operator == (const KVAggregatorService_Search_args & rhs) const
-  {
-    if (!(query == rhs.query))
-      return false;
-    return true;
-  }
-  bool operator != (const KVAggregatorService_Search_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_Search_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVAggregatorService_Search_pargs {
- public:
-
-
-  virtual ~KVAggregatorService_Search_pargs() throw();
-  const std::string* query;
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_Search_result__isset {
-  _KVAggregatorService_Search_result__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_Search_result__isset;
-
-class KVAggregatorService_Search_result {
- public:
-
-  KVAggregatorService_Search_result(const KVAggregatorService_Search_result&);
-  KVAggregatorService_Search_result& operator=(const KVAggregatorService_Search_result&);
-  KVAggregatorService_Search_result() {
-  }
-
-  virtual ~KVAggregatorService_Search_result() throw();
-  std::set<int64_t>  success;
-
-  _KVAggregatorService_Search_result__isset __isset;
-
-  void __set_success(const std::set<int64_t> & val);
-
-  bool operator == (const KVAggregatorService_Search_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVAggregatorService_Search_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_Search_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_Search_presult__isset {
-  _KVAggregatorService_Search_presult__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_Search_presult__isset;
-
-class KVAggregatorService_Search_presult {
- public:
-
-
-  virtual ~KVAggregatorService_Search_presult() throw();
-  std::set<int64_t> * success;
-
-  _KVAggregatorService_Search_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-typedef struct _KVAggregatorService_Regex_args__isset {
-  _KVAggregatorService_Regex_args__isset() : query(false) {}
-  bool query :1;
-} _KVAggregatorService_Regex_args__isset;
-
-class KVAggregatorService_Regex_args {
- public:
-
-  KVAggregatorService_Regex_args(const KVAggregatorService_Regex_args&);
-  KVAggregatorService_Regex_args& operator=(const KVAggregatorService_Regex_args&);
-  KVAggregatorService_Regex_args() : query() {
-  }
-
-  virtual ~KVAggregatorService_Regex_args() throw();
-  std::string query;
-
-  _KVAggregatorService_Regex_args__isset __isset;
-
-  void __set_query(const std::string& val);
-
-  bool operator == (const KVAggregatorService_Regex_args & rhs) const
-  {
-    if (!(query == rhs.query))
-      return false;
-    return true;
-  }
-  bool operator != (const KVAggregatorService_Regex_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_Regex_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVAggregatorService_Regex_pargs {
- public:
-
-
-  virtual ~KVAggregatorService_Regex_pargs() throw();
-  const std::string* query;
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_Regex_result__isset {
-  _KVAggregatorService_Regex_result__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_Regex_result__isset;
-
-class KVAggregatorService_Regex_result {
- public:
-
-  KVAggregatorService_Regex_result(const KVAggregatorService_Regex_result&);
-  KVAggregatorService_Regex_result& operator=(const KVAggregatorService_Regex_result&);
-  KVAggregatorService_Regex_result() {
-  }
-
-  virtual ~KVAggregatorService_Regex_result() throw();
-  std::set<int64_t>  success;
-
-  _KVAggregatorService_Regex_result__isset __isset;
-
-  void __set_success(const std::set<int64_t> & val);
-
-  bool operator == (const KVAggregatorService_Regex_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVAggregatorService_Regex_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_Regex_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_Regex_presult__isset {
-  _KVAggregatorService_Regex_presult__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_Regex_presult__isset;
-
-class KVAggregatorService_Regex_presult {
- public:
-
-
-  virtual ~KVAggregatorService_Regex_presult() throw();
-  std::set<int64_t> * success;
-
-  _KVAggregatorService_Regex_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-typedef struct _KVAggregatorService_Count_args__isset {
-  _KVAggregatorService_Count_args__isset() : query(false) {}
-  bool query :1;
-} _KVAggregatorService_Count_args__isset;
-
-class KVAggregatorService_Count_args {
- public:
-
-  KVAggregatorService_Count_args(const KVAggregatorService_Count_args&);
-  KVAggregatorService_Count_args& operator=(const KVAggregatorService_Count_args&);
-  KVAggregatorService_Count_args() : query() {
-  }
-
-  virtual ~KVAggregatorService_Count_args() throw();
-  std::string query;
-
-  _KVAggregatorService_Count_args__isset __isset;
-
-  void __set_query(const std::string& val);
-
-  bool operator == (const KVAggregatorService_Count_args & rhs) const
-  {
-    if (!(query == rhs.query))
-      return false;
-    return true;
-  }
-  bool operator != (const KVAggregatorService_Count_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_Count_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVAggregatorService_Count_pargs {
- public:
-
-
-  virtual ~KVAggregatorService_Count_pargs() throw();
-  const std::string* query;
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_Count_result__isset {
-  _KVAggregatorService_Count_result__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_Count_result__isset;
-
-class KVAggregatorService_Count_result {
- public:
-
-  KVAggregatorService_Count_result(const KVAggregatorService_Count_result&);
-  KVAggregatorService_Count_result& operator=(const KVAggregatorService_Count_result&);
-  KVAggregatorService_Count_result() : success(0) {
-  }
-
-  virtual ~KVAggregatorService_Count_result() throw();
-  int64_t success;
-
-  _KVAggregatorService_Count_result__isset __isset;
-
-  void __set_success(const int64_t val);
-
-  bool operator == (const KVAggregatorService_Count_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVAggregatorService_Count_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_Count_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_Count_presult__isset {
-  _KVAggregatorService_Count_presult__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_Count_presult__isset;
-
-class KVAggregatorService_Count_presult {
- public:
-
-
-  virtual ~KVAggregatorService_Count_presult() throw();
-  int64_t* success;
-
-  _KVAggregatorService_Count_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-
-class KVAggregatorService_GetNumShards_args {
- public:
-
-  KVAggregatorService_GetNumShards_args(const KVAggregatorService_GetNumShards_args&);
-  KVAggregatorService_GetNumShards_args& operator=(const KVAggregatorService_GetNumShards_args&);
-  KVAggregatorService_GetNumShards_args() {
-  }
-
-  virtual ~KVAggregatorService_GetNumShards_args() throw();
-
-  bool operator == (const KVAggregatorService_GetNumShards_args & /* rhs */) const
-  {
-    return true;
-  }
-  bool operator != (const KVAggregatorService_GetNumShards_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_GetNumShards_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVAggregatorService_GetNumShards_pargs {
- public:
-
-
-  virtual ~KVAggregatorService_GetNumShards_pargs() throw();
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_GetNumShards_result__isset {
-  _KVAggregatorService_GetNumShards_result__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_GetNumShards_result__isset;
-
-class KVAggregatorService_GetNumShards_result {
- public:
-
-  KVAggregatorService_GetNumShards_result(const KVAggregatorService_GetNumShards_result&);
-  KVAggregatorService_GetNumShards_result& operator=(const KVAggregatorService_GetNumShards_result&);
-  KVAggregatorService_GetNumShards_result() : success(0) {
-  }
-
-  virtual ~KVAggregatorService_GetNumShards_result() throw();
-  int32_t success;
-
-  _KVAggregatorService_GetNumShards_result__isset __isset;
-
-  void __set_success(const int32_t val);
-
-  bool operator == (const KVAggregatorService_GetNumShards_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVAggregatorService_GetNumShards_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_GetNumShards_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_GetNumShards_presult__isset {
-  _KVAggregatorService_GetNumShards_presult__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_GetNumShards_presult__isset;
-
-class KVAggregatorService_GetNumShards_presult {
- public:
-
-
-  virtual ~KVAggregatorService_GetNumShards_presult() throw();
-  int32_t* success;
-
-  _KVAggregatorService_GetNumShards_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-
-class KVAggregatorService_GetNumKeys_args {
- public:
-
-  KVAggregatorService_GetNumKeys_args(const KVAggregatorService_GetNumKeys_args&);
-  KVAggregatorService_GetNumKeys_args& operator=(const KVAggregatorService_GetNumKeys_args&);
-  KVAggregatorService_GetNumKeys_args() {
-  }
-
-  virtual ~KVAggregatorService_GetNumKeys_args() throw();
-
-  bool operator == (const KVAggregatorService_GetNumKeys_args & /* rhs */) const
-  {
-    return true;
-  }
-  bool operator != (const KVAggregatorService_GetNumKeys_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_GetNumKeys_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVAggregatorService_GetNumKeys_pargs {
- public:
-
-
-  virtual ~KVAggregatorService_GetNumKeys_pargs() throw();
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_GetNumKeys_result__isset {
-  _KVAggregatorService_GetNumKeys_result__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_GetNumKeys_result__isset;
-
-class KVAggregatorService_GetNumKeys_result {
- public:
-
-  KVAggregatorService_GetNumKeys_result(const KVAggregatorService_GetNumKeys_result&);
-  KVAggregatorService_GetNumKeys_result& operator=(const KVAggregatorService_GetNumKeys_result&);
-  KVAggregatorService_GetNumKeys_result() : success(0) {
-  }
-
-  virtual ~KVAggregatorService_GetNumKeys_result() throw();
-  int32_t success;
-
-  _KVAggregatorService_GetNumKeys_result__isset __isset;
-
-  void __set_success(const int32_t val);
-
-  bool operator == (const KVAggregatorService_GetNumKeys_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVAggregatorService_GetNumKeys_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_GetNumKeys_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_GetNumKeys_presult__isset {
-  _KVAggregatorService_GetNumKeys_presult__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_GetNumKeys_presult__isset;
-
-class KVAggregatorService_GetNumKeys_presult {
- public:
-
-
-  virtual ~KVAggregatorService_GetNumKeys_presult() throw();
-  int32_t* success;
-
-  _KVAggregatorService_GetNumKeys_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-typedef struct _KVAggregatorService_GetNumKeysShard_args__isset {
-  _KVAggregatorService_GetNumKeysShard_args__isset() : shard_id(false) {}
-  bool shard_id :1;
-} _KVAggregatorService_GetNumKeysShard_args__isset;
-
-class KVAggregatorService_GetNumKeysShard_args {
- public:
-
-  KVAggregatorService_GetNumKeysShard_args(const KVAggregatorService_GetNumKeysShard_args&);
-  KVAggregatorService_GetNumKeysShard_args& operator=(const KVAggregatorService_GetNumKeysShard_args&);
-  KVAggregatorService_GetNumKeysShard_args() : shard_id(0) {
-  }
-
-  virtual ~KVAggregatorService_GetNumKeysShard_args() throw();
-  int32_t shard_id;
-
-  _KVAggregatorService_GetNumKeysShard_args__isset __isset;
-
-  void __set_shard_id(const int32_t val);
-
-  bool operator == (const KVAggregatorService_GetNumKeysShard_args & rhs) const
-  {
-    if (!(shard_id == rhs.shard_id))
-      return false;
-    return true;
-  }
-  bool operator != (const KVAggregatorService_GetNumKeysShard_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_GetNumKeysShard_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVAggregatorService_GetNumKeysShard_pargs {
- public:
-
-
-  virtual ~KVAggregatorService_GetNumKeysShard_pargs() throw();
-  const int32_t* shard_id;
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_GetNumKeysShard_result__isset {
-  _KVAggregatorService_GetNumKeysShard_result__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_GetNumKeysShard_result__isset;
-
-class KVAggregatorService_GetNumKeysShard_result {
- public:
-
-  KVAggregatorService_GetNumKeysShard_result(const KVAggregatorService_GetNumKeysShard_result&);
-  KVAggregatorService_GetNumKeysShard_result& operator=(const KVAggregatorService_GetNumKeysShard_result&);
-  KVAggregatorService_GetNumKeysShard_result() : success(0) {
-  }
-
-  virtual ~KVAggregatorService_GetNumKeysShard_result() throw();
-  int32_t success;
-
-  _KVAggregatorService_GetNumKeysShard_result__isset __isset;
-
-  void __set_success(const int32_t val);
-
-  bool operator == (const KVAggregatorService_GetNumKeysShard_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVAggregatorService_GetNumKeysShard_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_GetNumKeysShard_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_GetNumKeysShard_presult__isset {
-  _KVAggregatorService_GetNumKeysShard_presult__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_GetNumKeysShard_presult__isset;
-
-class KVAggregatorService_GetNumKeysShard_presult {
- public:
-
-
-  virtual ~KVAggregatorService_GetNumKeysShard_presult() throw();
-  int32_t* success;
-
-  _KVAggregatorService_GetNumKeysShard_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-
-class KVAggregatorService_GetTotSize_args {
- public:
-
-  KVAggregatorService_GetTotSize_args(const KVAggregatorService_GetTotSize_args&);
-  KVAggregatorService_GetTotSize_args& operator=(const KVAggregatorService_GetTotSize_args&);
-  KVAggregatorService_GetTotSize_args() {
-  }
-
-  virtual ~KVAggregatorService_GetTotSize_args() throw();
-
-  bool operator == (const KVAggregatorService_GetTotSize_args & /* rhs */) const
-  {
-    return true;
-  }
-  bool operator != (const KVAggregatorService_GetTotSize_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_GetTotSize_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVAggregatorService_GetTotSize_pargs {
- public:
-
-
-  virtual ~KVAggregatorService_GetTotSize_pargs() throw();
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_GetTotSize_result__isset {
-  _KVAggregatorService_GetTotSize_result__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_GetTotSize_result__isset;
-
-class KVAggregatorService_GetTotSize_result {
- public:
-
-  KVAggregatorService_GetTotSize_result(const KVAggregatorService_GetTotSize_result&);
-  KVAggregatorService_GetTotSize_result& operator=(const KVAggregatorService_GetTotSize_result&);
-  KVAggregatorService_GetTotSize_result() : success(0) {
-  }
-
-  virtual ~KVAggregatorService_GetTotSize_result() throw();
-  int64_t success;
-
-  _KVAggregatorService_GetTotSize_result__isset __isset;
-
-  void __set_success(const int64_t val);
-
-  bool operator == (const KVAggregatorService_GetTotSize_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVAggregatorService_GetTotSize_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVAggregatorService_GetTotSize_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVAggregatorService_GetTotSize_presult__isset {
-  _KVAggregatorService_GetTotSize_presult__isset() : success(false) {}
-  bool success :1;
-} _KVAggregatorService_GetTotSize_presult__isset;
-
-class KVAggregatorService_GetTotSize_presult {
- public:
-
-
-  virtual ~KVAggregatorService_GetTotSize_presult() throw();
-  int64_t* success;
-
-  _KVAggregatorService_GetTotSize_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-class KVAggregatorServiceClient : virtual public KVAggregatorServiceIf {
- public:
-  KVAggregatorServiceClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
-    setProtocol(prot);
-  }
-  KVAggregatorServiceClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> iprot, apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> oprot) {
-    setProtocol(iprot,oprot);
-  }
- private:
-  void setProtocol(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
-  setProtocol(prot,prot);
-  }
-  void setProtocol(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> iprot, apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> oprot) {
-    piprot_=iprot;
-    poprot_=oprot;
-    iprot_ = iprot.get();
-    oprot_ = oprot.get();
-  }
- public:
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> getInputProtocol() {
-    return piprot_;
-  }
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> getOutputProtocol() {
-    return poprot_;
-  }
-  int32_t ConnectToServers();
-  void send_ConnectToServers();
-  int32_t recv_ConnectToServers();
-  int32_t DisconnectFromServers();
-  void send_DisconnectFromServers();
-  int32_t recv_DisconnectFromServers();
-  int32_t Initialize();
-  void send_Initialize();
-  int32_t recv_Initialize();
-  void Get(std::string& _return, const int64_t key);
-  void send_Get(const int64_t key);
-  void recv_Get(std::string& _return);
-  void Access(std::string& _return, const int64_t key, const int32_t offset, const int32_t len);
-  void send_Access(const int64_t key, const int32_t offset, const int32_t len);
-  void recv_Access(std::string& _return);
-  void Search(std::set<int64_t> & _return, const std::string& query);
-  void send_Search(const std::string& query);
-  void recv_Search(std::set<int64_t> & _return);
-  void Regex(std::set<int64_t> & _return, const std::string& query);
-  void send_Regex(const std::string& query);
-  void recv_Regex(std::set<int64_t> & _return);
-  int64_t Count(const std::string& query);
-  void send_Count(const std::string& query);
-  int64_t recv_Count();
-  int32_t GetNumShards();
-  void send_GetNumShards();
-  int32_t recv_GetNumShards();
-  int32_t GetNumKeys();
-  void send_GetNumKeys();
-  int32_t recv_GetNumKeys();
-  int32_t GetNumKeysShard(const int32_t shard_id);
-  void send_GetNumKeysShard(const int32_t shard_id);
-  int32_t recv_GetNumKeysShard();
-  int64_t GetTotSize();
-  void send_GetTotSize();
-  int64_t recv_GetTotSize();
- protected:
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
-  ::apache::thrift::protocol::TProtocol* iprot_;
-  ::apache::thrift::protocol::TProtocol* oprot_;
-};
-
-class KVAggregatorServiceProcessor : public ::apache::thrift::TDispatchProcessor {
- protected:
-  ::apache::thrift::stdcxx::shared_ptr<KVAggregatorServiceIf> iface_;
-  virtual bool dispatchCall(::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, const std::string& fname, int32_t seqid, void* callContext);
- private:
-  typedef  void (KVAggregatorServiceProcessor::*ProcessFunction)(int32_t, ::apache::thrift::protocol::TProtocol*, ::apache::thrift::protocol::TProtocol*, void*);
-  typedef std::map<std::string, ProcessFunction> ProcessMap;
-  ProcessMap processMap_;
-  void process_ConnectToServers(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_DisconnectFromServers(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_Initialize(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_Get(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_Access(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_Search(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_Regex(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_Count(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_GetNumShards(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_GetNumKeys(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_GetNumKeysShard(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_GetTotSize(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
- public:
-  KVAggregatorServiceProcessor(::apache::thrift::stdcxx::shared_ptr<KVAggregatorServiceIf> iface) :
-    iface_(iface) {
-    processMap_["ConnectToServers"] = &KVAggregatorServiceProcessor::process_ConnectToServers;
-    processMap_["DisconnectFromServers"] = &KVAggregatorServiceProcessor::process_DisconnectFromServers;
-    processMap_["Initialize"] = &KVAggregatorServiceProcessor::process_Initialize;
-    processMap_["Get"] = &KVAggregatorServiceProcessor::process_Get;
-    processMap_["Access"] = &KVAggregatorServiceProcessor::process_Access;
-    processMap_["Search"] = &KVAggregatorServiceProcessor::process_Search;
-    processMap_["Regex"] = &KVAggregatorServiceProcessor::process_Regex;
-    processMap_["Count"] = &KVAggregatorServiceProcessor::process_Count;
-    processMap_["GetNumShards"] = &KVAggregatorServiceProcessor::process_GetNumShards;
-    processMap_["GetNumKeys"] = &KVAggregatorServiceProcessor::process_GetNumKeys;
-    processMap_["GetNumKeysShard"] = &KVAggregatorServiceProcessor::process_GetNumKeysShard;
-    processMap_["GetTotSize"] = &KVAggregatorServiceProcessor::process_GetTotSize;
-  }
-
-  virtual ~KVAggregatorServiceProcessor() {}
-};
-
-class KVAggregatorServiceProcessorFactory : public ::apache::thrift::TProcessorFactory {
- public:
-  KVAggregatorServiceProcessorFactory(const ::apache::thrift::stdcxx::shared_ptr< KVAggregatorServiceIfFactory >& handlerFactory) :
-      handlerFactory_(handlerFactory) {}
-
-  ::apache::thrift::stdcxx::shared_ptr< ::apache::thrift::TProcessor > getProcessor(const ::apache::thrift::TConnectionInfo& connInfo);
-
- protected:
-  ::apache::thrift::stdcxx::shared_ptr< KVAggregatorServiceIfFactory > handlerFactory_;
-};
-
-class KVAggregatorServiceMultiface : virtual public KVAggregatorServiceIf {
- public:
-  KVAggregatorServiceMultiface(std::vector<apache::thrift::stdcxx::shared_ptr<KVAggregatorServiceIf> >& ifaces) : ifaces_(ifaces) {
-  }
-  virtual ~KVAggregatorServiceMultiface() {}
- protected:
-  std::vector<apache::thrift::stdcxx::shared_ptr<KVAggregatorServiceIf> > ifaces_;
-  KVAggregatorServiceMultiface() {}
-  void add(::apache::thrift::stdcxx::shared_ptr<KVAggregatorServiceIf> iface) {
-    ifaces_.push_back(iface);
-  }
- public:
-  int32_t ConnectToServers() {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->ConnectToServers();
-    }
-    return ifaces_[i]->ConnectToServers();
-  }
-
-  int32_t DisconnectFromServers() {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->DisconnectFromServers();
-    }
-    return ifaces_[i]->DisconnectFromServers();
-  }
-
-  int32_t Initialize() {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->Initialize();
-    }
-    return ifaces_[i]->Initialize();
-  }
-
-  void Get(std::string& _return, const int64_t key) {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->Get(_return, key);
-    }
-    ifaces_[i]->Get(_return, key);
-    return;
-  }
-
-  void Access(std::string& _return, const int64_t key, const int32_t offset, const int32_t len) {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->Access(_return, key, offset, len);
-    }
-    ifaces_[i]->Access(_return, key, offset, len);
-    return;
-  }
-
-  void Search(std::set<int64_t> & _return, const std::string& query) {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->Search(_return, query);
-    }
-    ifaces_[i]->Search(_return, query);
-    return;
-  }
-
-  void Regex(std::set<int64_t> & _return, const std::string& query) {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->Regex(_return, query);
-    }
-    ifaces_[i]->Regex(_return, query);
-    return;
-  }
-
-  int64_t Count(const std::string& query) {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->Count(query);
-    }
-    return ifaces_[i]->Count(query);
-  }
-
-  int32_t GetNumShards() {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->GetNumShards();
-    }
-    return ifaces_[i]->GetNumShards();
-  }
-
-  int32_t GetNumKeys() {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->GetNumKeys();
-    }
-    return ifaces_[i]->GetNumKeys();
-  }
-
-  int32_t GetNumKeysShard(const int32_t shard_id) {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->GetNumKeysShard(shard_id);
-    }
-    return ifaces_[i]->GetNumKeysShard(shard_id);
-  }
-
-  int64_t GetTotSize() {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->GetTotSize();
-    }
-    return ifaces_[i]->GetTotSize();
-  }
-
-};
-
-// The 'concurrent' client is a thread safe client that correctly handles
-// out of order responses.  It is slower than the regular client, so should
-// only be used when you need to share a connection among multiple threads
-class KVAggregatorServiceConcurrentClient : virtual public KVAggregatorServiceIf {
- public:
-  KVAggregatorServiceConcurrentClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
-    setProtocol(prot);
-  }
-  KVAggregatorServiceConcurrentClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> iprot, apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> oprot) {
-    setProtocol(iprot,oprot);
-  }
- private:
-  void setProtocol(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
-  setProtocol(prot,prot);
-  }
-  void setProtocol(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> iprot, apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> oprot) {
-    piprot_=iprot;
-    poprot_=oprot;
-    iprot_ = iprot.get();
-    oprot_ = oprot.get();
-  }
- public:
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> getInputProtocol() {
-    return piprot_;
-  }
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> getOutputProtocol() {
-    return poprot_;
-  }
-  int32_t ConnectToServers();
-  int32_t send_ConnectToServers();
-  int32_t recv_ConnectToServers(const int32_t seqid);
-  int32_t DisconnectFromServers();
-  int32_t send_DisconnectFromServers();
-  int32_t recv_DisconnectFromServers(const int32_t seqid);
-  int32_t Initialize();
-  int32_t send_Initialize();
-  int32_t recv_Initialize(const int32_t seqid);
-  void Get(std::string& _return, const int64_t key);
-  int32_t send_Get(const int64_t key);
-  void recv_Get(std::string& _return, const int32_t seqid);
-  void Access(std::string& _return, const int64_t key, const int32_t offset, const int32_t len);
-  int32_t send_Access(const int64_t key, const int32_t offset, const int32_t len);
-  void recv_Access(std::string& _return, const int32_t seqid);
-  void Search(std::set<int64_t> & _return, const std::string& query);
-  int32_t send_Search(const std::string& query);
-  void recv_Search(std::set<int64_t> & _return, const int32_t seqid);
-  void Regex(std::set<int64_t> & _return, const std::string& query);
-  int32_t send_Regex(const std::string& query);
-  void recv_Regex(std::set<int64_t> & _return, const int32_t seqid);
-  int64_t Count(const std::string& query);
-  int32_t send_Count(const std::string& query);
-  int64_t recv_Count(const int32_t seqid);
-  int32_t GetNumShards();
-  int32_t send_GetNumShards();
-  int32_t recv_GetNumShards(const int32_t seqid);
-  int32_t GetNumKeys();
-  int32_t send_GetNumKeys();
-  int32_t recv_GetNumKeys(const int32_t seqid);
-  int32_t GetNumKeysShard(const int32_t shard_id);
-  int32_t send_GetNumKeysShard(const int32_t shard_id);
-  int32_t recv_GetNumKeysShard(const int32_t seqid);
-  int64_t GetTotSize();
-  int32_t send_GetTotSize();
-  int64_t recv_GetTotSize(const int32_t seqid);
- protected:
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
-  ::apache::thrift::protocol::TProtocol* iprot_;
-  ::apache::thrift::protocol::TProtocol* oprot_;
-  ::apache::thrift::async::TConcurrentClientSyncInfo sync_;
-};
-
-#ifdef _MSC_VER
-  #pragma warning( pop )
-#endif
-
-
-
-#endif
@@ -1,1168 +0,0 @@
-/**
- * Autogenerated by Thrift Compiler (0.12.0)
- *
- * DO NOT EDIT UNLESS YOU ARE SURE THAT YOU KNOW WHAT YOU ARE DOING
- *  @generated
- */
-#ifndef KVQueryService_H
-#define KVQueryService_H
-
-#include <thrift/TDispatchProcessor.h>
-#include <thrift/async/TConcurrentClientSyncInfo.h>
-#include "succinctkv_types.h"
-
-
-
-#ifdef _MSC_VER
-  #pragma warning( push )
-  #pragma warning (disable : 4250 ) //inheriting methods via dominance 
-#endif
-
-class KVQueryServiceIf {
- public:
-  virtual ~KVQueryServiceIf() {}
-  virtual int32_t Initialize(const int32_t id) = 0;
-  virtual void Get(std::string& _return, const int64_t key) = 0;
-  virtual void Access(std::string& _return, const int64_t key, const int32_t offset, const int32_t len) = 0;
-  virtual void Search(std::set<int64_t> & _return, const std::string& query) = 0;
-  virtual void Regex(std::set<int64_t> & _return, const std::string& query) = 0;
-  virtual int64_t Count(const std::string& query) = 0;
-  virtual int32_t GetNumKeys() = 0;
-  virtual int64_t GetShardSize() = 0;
-};
-
-class KVQueryServiceIfFactory {
- public:
-  typedef KVQueryServiceIf Handler;
-
-  virtual ~KVQueryServiceIfFactory() {}
-
-  virtual KVQueryServiceIf* getHandler(const ::apache::thrift::TConnectionInfo& connInfo) = 0;
-  virtual void releaseHandler(KVQueryServiceIf* /* handler */) = 0;
-};
-
-class KVQueryServiceIfSingletonFactory : virtual public KVQueryServiceIfFactory {
- public:
-  KVQueryServiceIfSingletonFactory(const ::apache::thrift::stdcxx::shared_ptr<KVQueryServiceIf>& iface) : iface_(iface) {}
-  virtual ~KVQueryServiceIfSingletonFactory() {}
-
-  virtual KVQueryServiceIf* getHandler(const ::apache::thrift::TConnectionInfo&) {
-    return iface_.get();
-  }
-  virtual void releaseHandler(KVQueryServiceIf* /* handler */) {}
-
- protected:
-  ::apache::thrift::stdcxx::shared_ptr<KVQueryServiceIf> iface_;
-};
-
-class KVQueryServiceNull : virtual public KVQueryServiceIf {
- public:
-  virtual ~KVQueryServiceNull() {}
-  int32_t Initialize(const int32_t /* id */) {
-    int32_t _return = 0;
-    return _return;
-  }
-  void Get(std::string& /* _return */, const int64_t /* key */) {
-    return;
-  }
-  void Access(std::string& /* _return */, const int64_t /* key */, const int32_t /* offset */, const int32_t /* len */) {
-    return;
-  }
-  void Search(std::set<int64_t> & /* _return */, const std::string& /* query */) {
-    return;
-  }
-  void Regex(std::set<int64_t> & /* _return */, const std::string& /* query */) {
-    return;
-  }
-  int64_t Count(const std::string& /* query */) {
-    int64_t _return = 0;
-    return _return;
-  }
-  int32_t GetNumKeys() {
-    int32_t _return = 0;
-    return _return;
-  }
-  int64_t GetShardSize() {
-    int64_t _return = 0;
-    return _return;
-  }
-};
-
-typedef struct _KVQueryService_Initialize_args__isset {
-  _KVQueryService_Initialize_args__isset() : id(false) {}
-  bool id :1;
-} _KVQueryService_Initialize_args__isset;
-
-class KVQueryService_Initialize_args {
- public:
-
-  KVQueryService_Initialize_args(const KVQueryService_Initialize_args&);
-  KVQueryService_Initialize_args& operator=(const KVQueryService_Initialize_args&);
-  KVQueryService_Initialize_args() : id(0) {
-  }
-
-  virtual ~KVQueryService_Initialize_args() throw();
-  int32_t id;
-
-  _KVQueryService_Initialize_args__isset __isset;
-
-  void __set_id(const int32_t val);
-
-  bool operator == (const KVQueryService_Initialize_args & rhs) const
-  {
-    if (!(id == rhs.id))
-      return false;
-    return true;
-  }
-  bool operator != (const KVQueryService_Initialize_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVQueryService_Initialize_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVQueryService_Initialize_pargs {
- public:
-
-
-  virtual ~KVQueryService_Initialize_pargs() throw();
-  const int32_t* id;
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVQueryService_Initialize_result__isset {
-  _KVQueryService_Initialize_result__isset() : success(false) {}
-  bool success :1;
-} _KVQueryService_Initialize_result__isset;
-
-class KVQueryService_Initialize_result {
- public:
-
-  KVQueryService_Initialize_result(const KVQueryService_Initialize_result&);
-  KVQueryService_Initialize_result& operator=(const KVQueryService_Initialize_result&);
-  KVQueryService_Initialize_result() : success(0) {
-  }
-
-  virtual ~KVQueryService_Initialize_result() throw();
-  int32_t success;
-
-  _KVQueryService_Initialize_result__isset __isset;
-
-  void __set_success(const int32_t val);
-
-  bool operator == (const KVQueryService_Initialize_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVQueryService_Initialize_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVQueryService_Initialize_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVQueryService_Initialize_presult__isset {
-  _KVQueryService_Initialize_presult__isset() : success(false) {}
-  bool success :1;
-} _KVQueryService_Initialize_presult__isset;
-
-class KVQueryService_Initialize_presult {
- public:
-
-
-  virtual ~KVQueryService_Initialize_presult() throw();
-  int32_t* success;
-
-  _KVQueryService_Initialize_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-typedef struct _KVQueryService_Get_args__isset {
-  _KVQueryService_Get_args__isset() : key(false) {}
-  bool key :1;
-} _KVQueryService_Get_args__isset;
-
-class KVQueryService_Get_args {
- public:
-
-  KVQueryService_Get_args(const KVQueryService_Get_args&);
-  KVQueryService_Get_args& operator=(const KVQueryService_Get_args&);
-  KVQueryService_Get_args() : key(0) {
-  }
-
-  virtual ~KVQueryService_Get_args() throw();
-  int64_t key;
-
-  _KVQueryService_Get_args__isset __isset;
-
-  void __set_key(const int64_t val);
-
-  bool operator == (const KVQueryService_Get_args & rhs) const
-  {
-    if (!(key == rhs.key))
-      return false;
-    return true;
-  }
-  bool operator != (const KVQueryService_Get_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVQueryService_Get_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVQueryService_Get_pargs {
- public:
-
-
-  virtual ~KVQueryService_Get_pargs() throw();
-  const int64_t* key;
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVQueryService_Get_result__isset {
-  _KVQueryService_Get_result__isset() : success(false) {}
-  bool success :1;
-} _KVQueryService_Get_result__isset;
-
-class KVQueryService_Get_result {
- public:
-
-  KVQueryService_Get_result(const KVQueryService_Get_result&);
-  KVQueryService_Get_result& operator=(const KVQueryService_Get_result&);
-  KVQueryService_Get_result() : success() {
-  }
-
-  virtual ~KVQueryService_Get_result() throw();
-  std::string success;
-
-  _KVQueryService_Get_result__isset __isset;
-
-  void __set_success(const std::string& val);
-
-  bool operator == (const KVQueryService_Get_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVQueryService_Get_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVQueryService_Get_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVQueryService_Get_presult__isset {
-  _KVQueryService_Get_presult__isset() : success(false) {}
-  bool success :1;
-} _KVQueryService_Get_presult__isset;
-
-class KVQueryService_Get_presult {
- public:
-
-
-  virtual ~KVQueryService_Get_presult() throw();
-  std::string* success;
-
-  _KVQueryService_Get_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-typedef struct _KVQueryService_Access_args__isset {
-  _KVQueryService_Access_args__isset() : key(false), offset(false), len(false) {}
-  bool key :1;
-  bool offset :1;
-  bool len :1;
-} _KVQueryService_Access_args__isset;
-
-class KVQueryService_Access_args {
- public:
-
-  KVQueryService_Access_args(const KVQueryService_Access_args&);
-  KVQueryService_Access_args& operator=(const KVQueryService_Access_args&);
-  KVQueryService_Access_args() : key(0), offset(0), len(0) {
-  }
-
-  virtual ~KVQueryService_Access_args() throw();
-  int64_t key;
-  int32_t offset;
-  int32_t len;
-
-  _KVQueryService_Access_args__isset __isset;
-
-  void __set_key(const int64_t val);
-
-  void __set_offset(const int32_t val);
-
-  void __set_len(const int32_t val);
-
-  bool operator == (const KVQueryService_Access_args & rhs) const
-  {
-    if (!(key == rhs.key))
-      return false;
-    if (!(offset == rhs.offset))
-      return false;
-    if (!(len == rhs.len))
-      return false;
-    return true;
-  }
-  bool operator != (const KVQueryService_Access_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVQueryService_Access_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVQueryService_Access_pargs {
- public:
-
-
-  virtual ~KVQueryService_Access_pargs() throw();
-  const int64_t* key;
-  const int32_t* offset;
-  const int32_t* len;
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVQueryService_Access_result__isset {
-  _KVQueryService_Access_result__isset() : success(false) {}
-  bool success :1;
-} _KVQueryService_Access_result__isset;
-
-class KVQueryService_Access_result {
- public:
-
-  KVQueryService_Access_result(const KVQueryService_Access_result&);
-  KVQueryService_Access_result& operator=(const KVQueryService_Access_result&);
-  KVQueryService_Access_result() : success() {
-  }
-
-  virtual ~KVQueryService_Access_result() throw();
-  std::string success;
-
-  _KVQueryService_Access_result__isset __isset;
-
-  void __set_success(const std::string& val);
-
-  bool operator == (const KVQueryService_Access_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVQueryService_Access_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVQueryService_Access_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVQueryService_Access_presult__isset {
-  _KVQueryService_Access_presult__isset() : success(false) {}
-  bool success :1;
-} _KVQueryService_Access_presult__isset;
-
-class KVQueryService_Access_presult {
- public:
-
-
-  virtual ~KVQueryService_Access_presult() throw();
-  std::string* success;
-
-  _KVQueryService_Access_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-typedef struct _KVQueryService_Search_args__isset {
-  _KVQueryService_Search_args__isset() : query(false) {}
-  bool query :1;
-} _KVQueryService_Search_args__isset;
-
-class KVQueryService_Search_args {
- public:
-
-  KVQueryService_Search_args(const KVQueryService_Search_args&);
-  KVQueryService_Search_args& operator=(const KVQueryService_Search_args&);
-  KVQueryService_Search_args() : query() {
-  }
-
-  virtual ~KVQueryService_Search_args() throw();
-  std::string query;
-
-  _KVQueryService_Search_args__isset __isset;
-
-  void __set_query(const std::string& val);
-
-  bool operator == (const KVQueryService_Search_args & rhs) const
-  {
-    if (!(query == rhs.query))
-      return false;
-    return true;
-  }
-  bool operator != (const KVQueryService_Search_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVQueryService_Search_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVQueryService_Search_pargs {
- public:
-
-
-  virtual ~KVQueryService_Search_pargs() throw();
-  const std::string* query;
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVQueryService_Search_result__isset {
-  _KVQueryService_Search_result__isset() : success(false) {}
-  bool success :1;
-} _KVQueryService_Search_result__isset;
-
-class KVQueryService_Search_result {
- public:
-
-  KVQueryService_Search_result(const KVQueryService_Search_result&);
-  KVQueryService_Search_result& operator=(const KVQueryService_Search_result&);
-  KVQueryService_Search_result() {
-  }
-
-  virtual ~KVQueryService_Search_result() throw();
-  std::set<int64_t>  success;
-
-  _KVQueryService_Search_result__isset __isset;
-
-  void __set_success(const std::set<int64_t> & val);
-
-  bool operator == (const KVQueryService_Search_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVQueryService_Search_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVQueryService_Search_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVQueryService_Search_presult__isset {
-  _KVQueryService_Search_presult__isset() : success(false) {}
-  bool success :1;
-} _KVQueryService_Search_presult__isset;
-
-class KVQueryService_Search_presult {
- public:
-
-
-  virtual ~KVQueryService_Search_presult() throw();
-  std::set<int64_t> * success;
-
-  _KVQueryService_Search_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-typedef struct _KVQueryService_Regex_args__isset {
-  _KVQueryService_Regex_args__isset() : query(false) {}
-  bool query :1;
-} _KVQueryService_Regex_args__isset;
-
-class KVQueryService_Regex_args {
- public:
-
-  KVQueryService_Regex_args(const KVQueryService_Regex_args&);
-  KVQueryService_Regex_args& operator=(const KVQueryService_Regex_args&);
-  KVQueryService_Regex_args() : query() {
-  }
-
-  virtual ~KVQueryService_Regex_args() throw();
-  std::string query;
-
-  _KVQueryService_Regex_args__isset __isset;
-
-  void __set_query(const std::string& val);
-
-  bool operator == (const KVQueryService_Regex_args & rhs) const
-  {
-    if (!(query == rhs.query))
-      return false;
-    return true;
-  }
-  bool operator != (const KVQueryService_Regex_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVQueryService_Regex_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVQueryService_Regex_pargs {
- public:
-
-
-  virtual ~KVQueryService_Regex_pargs() throw();
-  const std::string* query;
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVQueryService_Regex_result__isset {
-  _KVQueryService_Regex_result__isset() : success(false) {}
-  bool success :1;
-} _KVQueryService_Regex_result__isset;
-
-class KVQueryService_Regex_result {
- public:
-
-  KVQueryService_Regex_result(const KVQueryService_Regex_result&);
-  KVQueryService_Regex_result& operator=(const KVQueryService_Regex_result&);
-  KVQueryService_Regex_result() {
-  }
-
-  virtual ~KVQueryService_Regex_result() throw();
-  std::set<int64_t>  success;
-
-  _KVQueryService_Regex_result__isset __isset;
-
-  void __set_success(const std::set<int64_t> & val);
-
-  bool operator == (const KVQueryService_Regex_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVQueryService_Regex_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVQueryService_Regex_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVQueryService_Regex_presult__isset {
-  _KVQueryService_Regex_presult__isset() : success(false) {}
-  bool success :1;
-} _KVQueryService_Regex_presult__isset;
-
-class KVQueryService_Regex_presult {
- public:
-
-
-  virtual ~KVQueryService_Regex_presult() throw();
-  std::set<int64_t> * success;
-
-  _KVQueryService_Regex_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-typedef struct _KVQueryService_Count_args__isset {
-  _KVQueryService_Count_args__isset() : query(false) {}
-  bool query :1;
-} _KVQueryService_Count_args__isset;
-
-class KVQueryService_Count_args {
- public:
-
-  KVQueryService_Count_args(const KVQueryService_Count_args&);
-  KVQueryService_Count_args& operator=(const KVQueryService_Count_args&);
-  KVQueryService_Count_args() : query() {
-  }
-
-  virtual ~KVQueryService_Count_args() throw();
-  std::string query;
-
-  _KVQueryService_Count_args__isset __isset;
-
-  void __set_query(const std::string& val);
-
-  bool operator == (const KVQueryService_Count_args & rhs) const
-  {
-    if (!(query == rhs.query))
-      return false;
-    return true;
-  }
-  bool operator != (const KVQueryService_Count_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVQueryService_Count_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVQueryService_Count_pargs {
- public:
-
-
-  virtual ~KVQueryService_Count_pargs() throw();
-  const std::string* query;
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVQueryService_Count_result__isset {
-  _KVQueryService_Count_result__isset() : success(false) {}
-  bool success :1;
-} _KVQueryService_Count_result__isset;
-
-class KVQueryService_Count_result {
- public:
-
-  KVQueryService_Count_result(const KVQueryService_Count_result&);
-  KVQueryService_Count_result& operator=(const KVQueryService_Count_result&);
-  KVQueryService_Count_result() : success(0) {
-  }
-
-  virtual ~KVQueryService_Count_result() throw();
-  int64_t success;
-
-  _KVQueryService_Count_result__isset __isset;
-
-  void __set_success(const int64_t val);
-
-  bool operator == (const KVQueryService_Count_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVQueryService_Count_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVQueryService_Count_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVQueryService_Count_presult__isset {
-  _KVQueryService_Count_presult__isset() : success(false) {}
-  bool success :1;
-} _KVQueryService_Count_presult__isset;
-
-class KVQueryService_Count_presult {
- public:
-
-
-  virtual ~KVQueryService_Count_presult() throw();
-  int64_t* success;
-
-  _KVQueryService_Count_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-
-class KVQueryService_GetNumKeys_args {
- public:
-
-  KVQueryService_GetNumKeys_args(const KVQueryService_GetNumKeys_args&);
-  KVQueryService_GetNumKeys_args& operator=(const KVQueryService_GetNumKeys_args&);
-  KVQueryService_GetNumKeys_args() {
-  }
-
-  virtual ~KVQueryService_GetNumKeys_args() throw();
-
-  bool operator == (const KVQueryService_GetNumKeys_args & /* rhs */) const
-  {
-    return true;
-  }
-  bool operator != (const KVQueryService_GetNumKeys_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVQueryService_GetNumKeys_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVQueryService_GetNumKeys_pargs {
- public:
-
-
-  virtual ~KVQueryService_GetNumKeys_pargs() throw();
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVQueryService_GetNumKeys_result__isset {
-  _KVQueryService_GetNumKeys_result__isset() : success(false) {}
-  bool success :1;
-} _KVQueryService_GetNumKeys_result__isset;
-
-class KVQueryService_GetNumKeys_result {
- public:
-
-  KVQueryService_GetNumKeys_result(const KVQueryService_GetNumKeys_result&);
-  KVQueryService_GetNumKeys_result& operator=(const KVQueryService_GetNumKeys_result&);
-  KVQueryService_GetNumKeys_result() : success(0) {
-  }
-
-  virtual ~KVQueryService_GetNumKeys_result() throw();
-  int32_t success;
-
-  _KVQueryService_GetNumKeys_result__isset __isset;
-
-  void __set_success(const int32_t val);
-
-  bool operator == (const KVQueryService_GetNumKeys_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVQueryService_GetNumKeys_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVQueryService_GetNumKeys_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVQueryService_GetNumKeys_presult__isset {
-  _KVQueryService_GetNumKeys_presult__isset() : success(false) {}
-  bool success :1;
-} _KVQueryService_GetNumKeys_presult__isset;
-
-class KVQueryService_GetNumKeys_presult {
- public:
-
-
-  virtual ~KVQueryService_GetNumKeys_presult() throw();
-  int32_t* success;
-
-  _KVQueryService_GetNumKeys_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-
-class KVQueryService_GetShardSize_args {
- public:
-
-  KVQueryService_GetShardSize_args(const KVQueryService_GetShardSize_args&);
-  KVQueryService_GetShardSize_args& operator=(const KVQueryService_GetShardSize_args&);
-  KVQueryService_GetShardSize_args() {
-  }
-
-  virtual ~KVQueryService_GetShardSize_args() throw();
-
-  bool operator == (const KVQueryService_GetShardSize_args & /* rhs */) const
-  {
-    return true;
-  }
-  bool operator != (const KVQueryService_GetShardSize_args &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVQueryService_GetShardSize_args & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-
-class KVQueryService_GetShardSize_pargs {
- public:
-
-
-  virtual ~KVQueryService_GetShardSize_pargs() throw();
-
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVQueryService_GetShardSize_result__isset {
-  _KVQueryService_GetShardSize_result__isset() : success(false) {}
-  bool success :1;
-} _KVQueryService_GetShardSize_result__isset;
-
-class KVQueryService_GetShardSize_result {
- public:
-
-  KVQueryService_GetShardSize_result(const KVQueryService_GetShardSize_result&);
-  KVQueryService_GetShardSize_result& operator=(const KVQueryService_GetShardSize_result&);
-  KVQueryService_GetShardSize_result() : success(0) {
-  }
-
-  virtual ~KVQueryService_GetShardSize_result() throw();
-  int64_t success;
-
-  _KVQueryService_GetShardSize_result__isset __isset;
-
-  void __set_success(const int64_t val);
-
-  bool operator == (const KVQueryService_GetShardSize_result & rhs) const
-  {
-    if (!(success == rhs.success))
-      return false;
-    return true;
-  }
-  bool operator != (const KVQueryService_GetShardSize_result &rhs) const {
-    return !(*this == rhs);
-  }
-
-  bool operator < (const KVQueryService_GetShardSize_result & ) const;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
-
-};
-
-typedef struct _KVQueryService_GetShardSize_presult__isset {
-  _KVQueryService_GetShardSize_presult__isset() : success(false) {}
-  bool success :1;
-} _KVQueryService_GetShardSize_presult__isset;
-
-class KVQueryService_GetShardSize_presult {
- public:
-
-
-  virtual ~KVQueryService_GetShardSize_presult() throw();
-  int64_t* success;
-
-  _KVQueryService_GetShardSize_presult__isset __isset;
-
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-
-};
-
-class KVQueryServiceClient : virtual public KVQueryServiceIf {
- public:
-  KVQueryServiceClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
-    setProtocol(prot);
-  }
-  KVQueryServiceClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> iprot, apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> oprot) {
-    setProtocol(iprot,oprot);
-  }
- private:
-  void setProtocol(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
-  setProtocol(prot,prot);
-  }
-  void setProtocol(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> iprot, apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> oprot) {
-    piprot_=iprot;
-    poprot_=oprot;
-    iprot_ = iprot.get();
-    oprot_ = oprot.get();
-  }
- public:
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> getInputProtocol() {
-    return piprot_;
-  }
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> getOutputProtocol() {
-    return poprot_;
-  }
-  int32_t Initialize(const int32_t id);
-  void send_Initialize(const int32_t id);
-  int32_t recv_Initialize();
-  void Get(std::string& _return, const int64_t key);
-  void send_Get(const int64_t key);
-  void recv_Get(std::string& _return);
-  void Access(std::string& _return, const int64_t key, const int32_t offset, const int32_t len);
-  void send_Access(const int64_t key, const int32_t offset, const int32_t len);
-  void recv_Access(std::string& _return);
-  void Search(std::set<int64_t> & _return, const std::string& query);
-  void send_Search(const std::string& query);
-  void recv_Search(std::set<int64_t> & _return);
-  void Regex(std::set<int64_t> & _return, const std::string& query);
-  void send_Regex(const std::string& query);
-  void recv_Regex(std::set<int64_t> & _return);
-  int64_t Count(const std::string& query);
-  void send_Count(const std::string& query);
-  int64_t recv_Count();
-  int32_t GetNumKeys();
-  void send_GetNumKeys();
-  int32_t recv_GetNumKeys();
-  int64_t GetShardSize();
-  void send_GetShardSize();
-  int64_t recv_GetShardSize();
- protected:
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
-  ::apache::thrift::protocol::TProtocol* iprot_;
-  ::apache::thrift::protocol::TProtocol* oprot_;
-};
-
-class KVQueryServiceProcessor : public ::apache::thrift::TDispatchProcessor {
- protected:
-  ::apache::thrift::stdcxx::shared_ptr<KVQueryServiceIf> iface_;
-  virtual bool dispatchCall(::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, const std::string& fname, int32_t seqid, void* callContext);
- private:
-  typedef  void (KVQueryServiceProcessor::*ProcessFunction)(int32_t, ::apache::thrift::protocol::TProtocol*, ::apache::thrift::protocol::TProtocol*, void*);
-  typedef std::map<std::string, ProcessFunction> ProcessMap;
-  ProcessMap processMap_;
-  void process_Initialize(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_Get(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_Access(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_Search(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_Regex(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_Count(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_GetNumKeys(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_GetShardSize(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
- public:
-  KVQueryServiceProcessor(::apache::thrift::stdcxx::shared_ptr<KVQueryServiceIf> iface) :
-    iface_(iface) {
-    processMap_["Initialize"] = &KVQueryServiceProcessor::process_Initialize;
-    processMap_["Get"] = &KVQueryServiceProcessor::process_Get;
-    processMap_["Access"] = &KVQueryServiceProcessor::process_Access;
-    processMap_["Search"] = &KVQueryServiceProcessor::process_Search;
-    processMap_["Regex"] = &KVQueryServiceProcessor::process_Regex;
-    processMap_["Count"] = &KVQueryServiceProcessor::process_Count;
-    processMap_["GetNumKeys"] = &KVQueryServiceProcessor::process_GetNumKeys;
-    processMap_["GetShardSize"] = &KVQueryServiceProcessor::process_GetShardSize;
-  }
-
-  virtual ~KVQueryServiceProcessor() {}
-};
-
-class KVQueryServiceProcessorFactory : public ::apache::thrift::TProcessorFactory {
- public:
-  KVQueryServiceProcessorFactory(const ::apache::thrift::stdcxx::shared_ptr< KVQueryServiceIfFactory >& handlerFactory) :
-      handlerFactory_(handlerFactory) {}
-
-  ::apache::thrift::stdcxx::shared_ptr< ::apache::thrift::TProcessor > getProcessor(const ::apache::thrift::TConnectionInfo& connInfo);
-
- protected:
-  ::apache::thrift::stdcxx::shared_ptr< KVQueryServiceIfFactory > handlerFactory_;
-};
-
-class KVQueryServiceMultiface : virtual public KVQueryServiceIf {
- public:
-  KVQueryServiceMultiface(std::vector<apache::thrift::stdcxx::shared_ptr<KVQueryServiceIf> >& ifaces) : ifaces_(ifaces) {
-  }
-  virtual ~KVQueryServiceMultiface() {}
- protected:
-  std::vector<apache::thrift::stdcxx::shared_ptr<KVQueryServiceIf> > ifaces_;
-  KVQueryServiceMultiface() {}
-  void add(::apache::thrift::stdcxx::shared_ptr<KVQueryServiceIf> iface) {
-    ifaces_.push_back(iface);
-  }
- public:
-  int32_t Initialize(const int32_t id) {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->Initialize(id);
-    }
-    return ifaces_[i]->Initialize(id);
-  }
-
-  void Get(std::string& _return, const int64_t key) {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->Get(_return, key);
-    }
-    ifaces_[i]->Get(_return, key);
-    return;
-  }
-
-  void Access(std::string& _return, const int64_t key, const int32_t offset, const int32_t len) {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->Access(_return, key, offset, len);
-    }
-    ifaces_[i]->Access(_return, key, offset, len);
-    return;
-  }
-
-  void Search(std::set<int64_t> & _return, const std::string& query) {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->Search(_return, query);
-    }
-    ifaces_[i]->Search(_return, query);
-    return;
-  }
-
-  void Regex(std::set<int64_t> & _return, const std::string& query) {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->Regex(_return, query);
-    }
-    ifaces_[i]->Regex(_return, query);
-    return;
-  }
-
-  int64_t Count(const std::string& query) {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->Count(query);
-    }
-    return ifaces_[i]->Count(query);
-  }
-
-  int32_t GetNumKeys() {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->GetNumKeys();
-    }
-    return ifaces_[i]->GetNumKeys();
-  }
-
-  int64_t GetShardSize() {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->GetShardSize();
-    }
-    return ifaces_[i]->GetShardSize();
-  }
-
-};
-
-// The 'concurrent' client is a thread safe client that correctly handles
-// out of order responses.  It is slower than the regular client, so should
-// only be used when you need to share a connection among multiple threads
-class KVQueryServiceConcurrentClient : virtual public KVQueryServiceIf {
- public:
-  KVQueryServiceConcurrentClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
-    setProtocol(prot);
-  }
-  KVQueryServiceConcurrentClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> iprot, apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> oprot) {
-    setProtocol(iprot,oprot);
-  }
- private:
-  void setProtocol(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
-  setProtocol(prot,prot);
-  }
-  void setProtocol(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> iprot, apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> oprot) {
-    piprot_=iprot;
-    poprot_=oprot;
-    iprot_ = iprot.get();
-    oprot_ = oprot.get();
-  }
- public:
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> getInputProtocol() {
-    return piprot_;
-  }
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> getOutputProtocol() {
-    return poprot_;
-  }
-  int32_t Initialize(const int32_t id);
-  int32_t send_Initialize(const int32_t id);
-  int32_t recv_Initialize(const int32_t seqid);
-  void Get(std::string& _return, const int64_t key);
-  int32_t send_Get(const int64_t key);
-  void recv_Get(std::string& _return, const int32_t seqid);
-  void Access(std::string& _return, const int64_t key, const int32_t offset, const int32_t len);
-  int32_t send_Access(const int64_t key, const int32_t offset, const int32_t len);
-  void recv_Access(std::string& _return, const int32_t seqid);
-  void Search(std::set<int64_t> & _return, const std::string& query);
-  int32_t send_Search(const std::string& query);
-  void recv_Search(std::set<int64_t> & _return, const int32_t seqid);
-  void Regex(std::set<int64_t> & _return, const std::string& query);
-  int32_t send_Regex(const std::string& query);
-  void recv_Regex(std::set<int64_t> & _return, const int32_t seqid);
-  int64_t Count(const std::string& query);
-  int32_t send_Count(const std::string& query);
-  int64_t recv_Count(const int32_t seqid);
-  int32_t GetNumKeys();
-  int32_t send_GetNumKeys();
-  int32_t recv_GetNumKeys(const int32_t seqid);
-  int64_t GetShardSize();
-  int32_t send_GetShardSize();
-  int64_t recv_GetShardSize(const int32_t seqid);
- protected:
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
-  ::apache::thrift::protocol::TProtocol* iprot_;
-  ::apache::thrift::protocol::TProtocol* oprot_;
-  ::apache::thrift::async::TConcurrentClientSyncInfo sync_;
-};
-
-#ifdef _MSC_VER
-  #pragma warning( pop )
-#endif
-
-
-
-#endif
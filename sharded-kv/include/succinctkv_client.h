@@ -16,9 +16,9 @@ class SuccinctKVClient {
  public:
   SuccinctKVClient(const std::string& host, const uint32_t port =
   KV_AGGREGATOR_PORT) {
-    socket_ = stdcxx::shared_ptr<TSocket>(new TSocket("localhost", port));
-    transport_ = stdcxx::shared_ptr<TTransport>(new TBufferedTransport(socket_));
-    protocol_ = stdcxx::shared_ptr<TProtocol>(new TBinaryProtocol(transport_));
+    socket_ = std::shared_ptr<TSocket>(new TSocket("localhost", port));
+    transport_ = std::shared_ptr<TTransport>(new TFramedTransport(socket_));
+    protocol_ = std::shared_ptr<TProtocol>(new TBinaryProtocol(transport_));
     transport_->open();
     client_ = new KVAggregatorServiceClient(protocol_);
     client_->ConnectToServers();
@@ -30,8 +30,9 @@ class SuccinctKVClient {
     delete client_;
   }
 
-  void Regex(std::set<int64_t> & _return, const std::string& query) {
-    client_->Regex(_return, query);
+  void Regex(std::vector<int64_t> & _return, const std::string& query,
+             int64_t offset = 0, int64_t limit = -1) {
+    client_->Regex(_return, query, offset, limit);
   }
 
   void Get(std::string& _return, const int64_t key) {
@@ -47,8 +48,9 @@ class SuccinctKVClient {
     return client_->Count(query);
   }
 
-  void Search(std::set<int64_t> & _return, const std::string& query) {
-    client_->Search(_return, query);
+  void Search(std::vector<int64_t> & _return, const std::string& query,
+              int64_t offset = 0, int64_t limit = -1) {
+    client_->Search(_return, query, offset, limit);
   }
 
   int32_t GetNumKeys() {
@@ -63,14 +65,21 @@ class SuccinctKVClient {
     return client_->GetNumShards();
   }
 
+  // Number of shards missing from the result of the last query, having
+  // missed its deadline
+  int32_t GetNumMissedShards() {
+    return client_->GetNumMissedShards();
+  }
+
   int64_t GetTotSize() {
     return client_->GetTotSize();
   }
 
   // Non-blocking send/receive calls
   // Send calls
-  void SendRegex(const std::string& query) {
-    client_->send_Regex(query);
+  void SendRegex(const std::string& query, int64_t offset = 0,
+                 int64_t limit = -1) {
+    client_->send_Regex(query, offset, limit);
   }
 
   void SendCount(const std::string& query) {
@@ -85,12 +94,13 @@ class SuccinctKVClient {
     client_->send_Access(key, offset, len);
   }
 
-  void SendSearch(const std::string& query) {
-    client_->send_Search(query);
+  void SendSearch(const std::string& query, int64_t offset = 0,
+                  int64_t limit = -1) {
+    client_->send_Search(query, offset, limit);
   }
 
   // Receive calls
-  void RecvRegex(std::set<int64_t> & _return) {
+  void RecvRegex(std::vector<int64_t> & _return) {
     client_->recv_Regex(_return);
   }
 
@@ -106,14 +116,14 @@ class SuccinctKVClient {
     client_->recv_Access(_return);
   }
 
-  void RecvSearch(std::set<int64_t>& _return) {
+  void RecvSearch(std::vector<int64_t> & _return) {
     client_->recv_Search(_return);
   }
 
  private:
-  stdcxx::shared_ptr<TSocket> socket_;
-  stdcxx::shared_ptr<TTransport> transport_;
-  stdcxx::shared_ptr<TProtocol> protocol_;
+  std::shared_ptr<TSocket> socket_;
+  std::shared_ptr<TTransport> transport_;
+  std::shared_ptr<TProtocol> protocol_;
   KVAggregatorServiceClient *client_;
 
 };
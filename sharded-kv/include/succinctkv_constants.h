@@ -1,24 +0,0 @@
-/**
- * Autogenerated by Thrift Compiler (0.12.0)
- *
- * DO NOT EDIT UNLESS YOU ARE SURE THAT YOU KNOW WHAT YOU ARE DOING
- *  @generated
- */
-#ifndef succinctkv_CONSTANTS_H
-#define succinctkv_CONSTANTS_H
-
-#include "succinctkv_types.h"
-
-
-
-class succinctkvConstants {
- public:
-  succinctkvConstants();
-
-};
-
-extern const succinctkvConstants g_succinctkv_constants;
-
-
-
-#endif
@@ -7,6 +7,7 @@
 #include <iterator>
 
 #include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/protocol/TMultiplexedProtocol.h>
 #include <thrift/server/TThreadedServer.h>
 #include <thrift/server/TNonblockingServer.h>
 #include <thrift/transport/TSocket.h>
@@ -14,9 +15,11 @@
 #include <thrift/concurrency/PosixThreadFactory.h>
 
 #include "succinct_shard.h"
+#include "utils/connection_pool.h"
+#include "utils/reply_gather.h"
+#include "utils/server_mode.h"
 #include "KVAggregatorService.h"
 #include "KVQueryService.h"
-#include "succinctkv_constants.h"
 #include "kv_ports.h"
 
 using namespace ::apache::thrift;
@@ -24,94 +27,181 @@ using namespace ::apache::thrift::protocol;
 using namespace ::apache::thrift::transport;
 using namespace ::apache::thrift::server;
 
-using stdcxx::shared_ptr;
+using std::shared_ptr;
+
+// Connection to a shard. Query servers host shards_per_server consecutive
+// shards each, under their index on the server.
+struct KVShardConnection {
+  KVShardConnection(uint32_t shard, uint32_t shards_per_server)
+      : socket(new TSocket("localhost",
+                           KV_SERVER_PORT + shard / shards_per_server)),
+        transport(new TFramedTransport(socket)),
+        client(std::shared_ptr<TProtocol>(new TMultiplexedProtocol(
+            std::shared_ptr<TProtocol>(new TBinaryProtocol(transport)),
+            std::to_string(shard % shards_per_server)))) {
+    transport->open();
+  }
+
+  // Make reads time out at deadline, so that a shard that stops sending
+  // half way through a reply cannot stall a query past it
+  void SetDeadline(ReplyGather::Clock::time_point deadline) {
+    socket->setRecvTimeout(ReplyGather::RecvTimeoutMs(deadline));
+  }
+
+  std::shared_ptr<TSocket> socket;
+  std::shared_ptr<TTransport> transport;
+  KVQueryServiceClient client;
+};
+
+typedef ConnectionPool<KVShardConnection> KVShardPool;
 
 class KVAggregatorServiceHandler : virtual public KVAggregatorServiceIf {
  public:
-  KVAggregatorServiceHandler(uint32_t num_shards) {
+  KVAggregatorServiceHandler(uint32_t num_shards, uint32_t shards_per_server,
+                             int32_t timeout_ms,
+                             std::shared_ptr<KVShardPool> pool) {
     num_shards_ = num_shards;
+    shards_per_server_ = shards_per_server;
+    timeout_ms_ = timeout_ms;
+    deadline_ = ReplyGather::NoDeadline();
+    pool_ = pool;
   }
 
   int32_t Initialize() {
     // Connect to query servers and start initialization
     fprintf(stderr, "Num shards = %u\n", num_shards_);
+    std::vector<std::shared_ptr<KVShardConnection>> qservers;
     for (uint32_t i = 0; i < num_shards_; i++) {
-      int port = KV_SERVER_PORT + i;
-      stdcxx::shared_ptr<TSocket> socket(new TSocket("localhost", port));
-      stdcxx::shared_ptr<TTransport> transport(new TBufferedTransport(socket));
-      stdcxx::shared_ptr<TProtocol> protocol(new TBinaryProtocol(transport));
-      KVQueryServiceClient client(protocol);
-      transport->open();
+      std::shared_ptr<KVShardConnection> qserver(
+          new KVShardConnection(i, shards_per_server_));
       fprintf(stderr, "Connected to QueryServer %u!\n", i);
-      client.send_Initialize(i);
-      qservers_.push_back(client);
-      qserver_transports_.push_back(transport);
+      qserver->client.send_Initialize(i);
+      qservers.push_back(qserver);
     }
 
-    for (auto client : qservers_) {
-      int32_t status = client.recv_Initialize();
+    for (auto qserver : qservers) {
+      int32_t status = qserver->client.recv_Initialize();
       if (status) {
         fprintf(stderr, "Initialization failed, status = %d!\n", status);
         return status;
       }
     }
 
-    for (auto transport : qserver_transports_) {
-      transport->close();
+    for (auto qserver : qservers) {
+      qserver->transport->close();
     }
 
-    qserver_transports_.clear();
-    qservers_.clear();
-
     fprintf(stderr, "All QueryServers successfully initialized!\n");
 
     return 0;
   }
 
   void Get(std::string& _return, const int64_t key) {
+    ShardLeases leases(this);
     uint32_t qserver_id = key / SuccinctShard::MAX_KEYS;
-    qservers_.at(qserver_id).Get(_return, key % SuccinctShard::MAX_KEYS);
+    Call(qserver_id).Get(_return, key % SuccinctShard::MAX_KEYS);
   }
 
   void Access(std::string& _return, const int64_t key, const int32_t offset,
               const int32_t len) {
+    ShardLeases leases(this);
     uint32_t qserver_id = key / SuccinctShard::MAX_KEYS;
-    qservers_.at(qserver_id).Access(_return, key % SuccinctShard::MAX_KEYS,
-                                    offset, len);
+    Call(qserver_id).Access(_return, key % SuccinctShard::MAX_KEYS, offset,
+                            len);
   }
 
-  void Search(std::set<int64_t> & _return, const std::string& query) {
-    for (int j = 0; j < qservers_.size(); j++) {
-      qservers_[j].send_Search(query);
+  void Search(std::vector<int64_t> & _return, const std::string& query,
+              const int64_t offset, const int64_t limit) {
+    ShardLeases leases(this);
+    StartQuery();
+
+    // Pages follow shard order. Past the first page, the number of results
+    // on each shard locates the page, so that shards skip the results
+    // before it rather than sending them.
+    std::vector<int64_t> shard_offsets(conns_.size(), 0);
+    std::vector<int64_t> shard_limits(conns_.size(), limit);
+    if (offset > 0) {
+      std::vector<int64_t> counts(conns_.size(), 0);
+      ScatterGather(AllShards(), [&](uint32_t j) {
+        Shard(j).send_Count(query);
+      }, [&](uint32_t j) {
+        counts[j] = Reply(j).recv_Count();
+      });
+      PlacePage(shard_offsets, shard_limits, counts, offset, limit);
     }
 
-    for (int j = 0; j < qservers_.size(); j++) {
-      std::set<int64_t> keys;
-      qservers_[j].recv_Search(keys);
-      _return.insert(keys.begin(), keys.end());
+    std::vector<uint32_t> shards;
+    for (uint32_t j = 0; j < conns_.size(); j++) {
+      if (shard_limits[j] != 0)
+        shards.push_back(j);
     }
-  }
-
-  void Regex(std::set<int64_t> & _return, const std::string& query) {
-    for (int j = 0; j < qservers_.size(); j++) {
-      qservers_[j].send_Regex(query);
+    std::vector<std::vector<int64_t>> keys(conns_.size());
+    ScatterGather(shards, [&](uint32_t j) {
+      Shard(j).send_Search(query, shard_offsets[j], shard_limits[j]);
+    }, [&](uint32_t j) {
+      // A reply cut short leaves nothing behind
+      std::vector<int64_t> shard_keys;
+      Reply(j).recv_Search(shard_keys);
+      keys[j].swap(shard_keys);
+    });
+
+    // Unpaged results are merged in one pass, as each shard returns sorted
+    // keys
+    if (offset <= 0 && limit < 0) {
+      SortedVector::MultiwayUnion(_return, keys);
+      return;
     }
+    for (int j = 0; j < conns_.size(); j++) {
+      for (auto key : keys[j]) {
+        if (limit >= 0 && (int64_t) _return.size() == limit)
+          return;
+        _return.push_back(key);
+      }
+    }
+  }
 
-    for (int j = 0; j < qservers_.size(); j++) {
-      std::set<int64_t> results;
-      qservers_[j].recv_Regex(results);
-      _return.insert(results.begin(), results.end());
+  void Regex(std::vector<int64_t> & _return, const std::string& query,
+             const int64_t offset, const int64_t limit) {
+    ShardLeases leases(this);
+    StartQuery();
+
+    // Each shard returns sorted results, so the page lies within the first
+    // offset + limit results of every shard
+    int64_t shard_limit = -1;
+    if (limit >= 0)
+      shard_limit = std::max<int64_t>(offset, 0) + limit;
+    std::vector<std::vector<int64_t>> results(conns_.size());
+    ScatterGather(AllShards(), [&](uint32_t j) {
+      Shard(j).send_Regex(query, 0, shard_limit);
+    }, [&](uint32_t j) {
+      std::vector<int64_t> shard_results;
+      Reply(j).recv_Regex(shard_results);
+      results[j].swap(shard_results);
+    });
+
+    // Merge the results in one pass
+    if (offset <= 0 && limit < 0) {
+      SortedVector::MultiwayUnion(_return, results);
+      return;
     }
+    std::vector<int64_t> merged;
+    SortedVector::MultiwayUnion(merged, results);
+    SortedVector::Page(_return, merged, offset, limit);
   }
 
   int64_t Count(const std::string& query) {
-    int64_t ret = 0;
-    for (int j = 0; j < qservers_.size(); j++) {
-      qservers_[j].send_Count(query);
-    }
+    ShardLeases leases(this);
+    StartQuery();
+    std::vector<int64_t> counts(conns_.size(), 0);
+    ScatterGather(AllShards(), [&](uint32_t j) {
+      Shard(j).send_Count(query);
+    }, [&](uint32_t j) {
+      counts[j] = Reply(j).recv_Count();
+    });
 
-    for (int j = 0; j < qservers_.size(); j++) {
-      ret += qservers_[j].recv_Count();
+    int64_t ret = 0;
+    for (auto count : counts) {
+      ret += count;
     }
     return ret;
   }
@@ -120,10 +210,15 @@ class KVAggregatorServiceHandler : virtual public KVAggregatorServiceIf {
     return num_shards_;
   }
 
+  int32_t GetNumMissedShards() {
+    return std::count(missed_shards_.begin(), missed_shards_.end(), true);
+  }
+
   int32_t GetNumKeys() {
+    ShardLeases leases(this);
     int32_t num_keys = 0;
-    for (auto client : qservers_) {
-      num_keys += client.GetNumKeys();
+    for (uint32_t j = 0; j < conns_.size(); j++) {
+      num_keys += Call(j).GetNumKeys();
     }
     return num_keys;
   }
@@ -132,100 +227,257 @@ class KVAggregatorServiceHandler : virtual public KVAggregatorServiceIf {
     if (shard_id < 0 || shard_id >= num_shards_) {
       return 0;
     }
-    return qservers_.at(shard_id).GetNumKeys();
+    ShardLeases leases(this);
+    return Call(shard_id).GetNumKeys();
   }
 
   int64_t GetTotSize() {
+    ShardLeases leases(this);
     int64_t tot_size = 0;
-    for (auto client : qservers_) {
-      tot_size += client.GetShardSize();
+    for (uint32_t j = 0; j < conns_.size(); j++) {
+      tot_size += Call(j).GetShardSize();
     }
     return tot_size;
   }
 
   int32_t ConnectToServers() {
+    // Connections come from the pool shared by all clients; check that every
+    // shard can be reached
+    ShardLeases leases(this);
+    conns_.resize(num_shards_);
     for (int i = 0; i < num_shards_; i++) {
       fprintf(stderr, "Connecting to local server %d...", i);
       try {
-        stdcxx::shared_ptr<TSocket> socket(
-            new TSocket("localhost", KV_SERVER_PORT + i));
-        stdcxx::shared_ptr<TTransport> transport(new TBufferedTransport(socket));
-        stdcxx::shared_ptr<TProtocol> protocol(new TBinaryProtocol(transport));
-        KVQueryServiceClient qsclient(protocol);
-        transport->open();
+        Shard(i);
         fprintf(stderr, "Connected!\n");
-        qservers_.push_back(qsclient);
-        qserver_transports_.push_back(transport);
-        fprintf(stderr, "Pushed!\n");
       } catch (std::exception& e) {
         fprintf(stderr, "Could not connect to server...: %s\n", e.what());
         return 1;
       }
     }
     fprintf(stderr, "Currently have %zu local server connections.\n",
-            qservers_.size());
+            conns_.size());
     return 0;
   }
 
   int32_t DisconnectFromServers() {
-    for (int i = 0; i < qservers_.size(); i++) {
+    ReleaseShards(false);
+    conns_.clear();
+    return 0;
+  }
+
+ private:
+  // Gives the connections leased during a call back to the pool when the
+  // call returns. A call that throws may leave replies unread, so its
+  // connections are closed instead.
+  class ShardLeases {
+   public:
+    ShardLeases(KVAggregatorServiceHandler *handler) {
+      handler_ = handler;
+    }
+
+    ~ShardLeases() {
+      handler_->ReleaseShards(std::uncaught_exception());
+    }
+
+   private:
+    KVAggregatorServiceHandler *handler_;
+  };
+
+  // Client for query server j, on a connection leased from the pool for
+  // the current call
+  KVQueryServiceClient& Shard(uint32_t j) {
+    if (!conns_.at(j))
+      conns_[j] = pool_->Lease(j);
+    return conns_[j]->client;
+  }
+
+  // Client for shard j, to receive the reply to a request sent with
+  // Shard(j) by the query deadline
+  KVQueryServiceClient& Reply(uint32_t j) {
+    conns_.at(j)->SetDeadline(deadline_);
+    return conns_[j]->client;
+  }
+
+  // Client for shard j, for a call that sends a request and waits up to
+  // timeout_ms for its reply
+  KVQueryServiceClient& Call(uint32_t j) {
+    Shard(j);
+    conns_[j]->SetDeadline(ReplyGather::DeadlineIn(timeout_ms_));
+    return conns_[j]->client;
+  }
+
+  // Give the leased connections back to the pool, or close them if drop is
+  // set
+  void ReleaseShards(bool drop) {
+    for (uint32_t j = 0; j < conns_.size(); j++) {
+      if (conns_[j] && !drop)
+        pool_->Return(j, conns_[j]);
+      conns_[j].reset();
+    }
+  }
+
+  std::vector<uint32_t> AllShards() {
+    std::vector<uint32_t> shards(conns_.size());
+    for (uint32_t j = 0; j < conns_.size(); j++) {
+      shards[j] = j;
+    }
+    return shards;
+  }
+
+  // Start the deadline of a query
+  void StartQuery() {
+    deadline_ = ReplyGather::DeadlineIn(timeout_ms_);
+    missed_shards_.assign(conns_.size(), false);
+  }
+
+  // Leave shard j out of the result of the current query, and close its
+  // connection so that its late reply is never read
+  void MissShard(uint32_t j) {
+    fprintf(stderr, "Shard %u missed the query deadline.\n", j);
+    missed_shards_[j] = true;
+    conns_[j].reset();
+  }
+
+  // Send a request to each of shards with send(j), and receive the replies
+  // with recv(j) in the order they arrive. Shards that cannot be reached or
+  // that miss the query deadline are left out of the result.
+  template<typename Send, typename Recv>
+  void ScatterGather(const std::vector<uint32_t>& shards, Send send,
+                     Recv recv) {
+    std::vector<int> fds(shards.size(), -1);
+    std::vector<uint32_t> missed;
+    for (size_t k = 0; k < shards.size(); k++) {
       try {
-        fprintf(stderr, "Disconnecting from local server %d\n", i);
-        qserver_transports_[i]->close();
-        fprintf(stderr, "Disconnected!\n");
+        send(shards[k]);
+        fds[k] = conns_[shards[k]]->socket->getSocketFD();
       } catch (std::exception& e) {
-        fprintf(stderr, "Could not close local connection: %s\n", e.what());
-        return 1;
+        missed.push_back(shards[k]);
       }
     }
-    qserver_transports_.clear();
-    qservers_.clear();
-    return 0;
+
+    std::vector<size_t> late = ReplyGather::Wait(fds, deadline_,
+                                                 [&](size_t k) {
+      recv(shards[k]);
+    });
+    for (auto k : late) {
+      missed.push_back(shards[k]);
+    }
+
+    for (auto j : missed) {
+      MissShard(j);
+    }
   }
 
- private:
-  std::vector<KVQueryServiceClient> qservers_;
-  std::vector<stdcxx::shared_ptr<TTransport>> qserver_transports_;
+  // Split the page [offset, offset + limit) of the results across the
+  // shards, in shard order, given the number of results on each shard
+  static void PlacePage(std::vector<int64_t>& shard_offsets,
+                        std::vector<int64_t>& shard_limits,
+                        const std::vector<int64_t>& counts, int64_t offset,
+                        int64_t limit) {
+    for (size_t j = 0; j < counts.size(); j++) {
+      shard_offsets[j] = std::min(offset, counts[j]);
+      shard_limits[j] = counts[j] - shard_offsets[j];
+      if (limit >= 0) {
+        shard_limits[j] = std::min(shard_limits[j], limit);
+        limit -= shard_limits[j];
+      }
+      offset -= shard_offsets[j];
+    }
+  }
+
+  std::shared_ptr<KVShardPool> pool_;
+  std::vector<std::shared_ptr<KVShardConnection>> conns_;
   uint32_t num_shards_;
+  uint32_t shards_per_server_;
+  int32_t timeout_ms_;
+  ReplyGather::Clock::time_point deadline_;
+  std::vector<bool> missed_shards_;
 };
 
 class KVHandlerProcessorFactory : public TProcessorFactory {
  public:
-  KVHandlerProcessorFactory(uint32_t num_shards) {
+  KVHandlerProcessorFactory(uint32_t num_shards, uint32_t shards_per_server,
+                            int32_t timeout_ms, uint32_t max_idle) {
     num_shards_ = num_shards;
+    shards_per_server_ = shards_per_server;
+    timeout_ms_ = timeout_ms;
+    pool_ = std::make_shared<KVShardPool>(
+        num_shards, [shards_per_server](uint32_t shard) {
+          return std::make_shared<KVShardConnection>(shard, shards_per_server);
+        },
+        [](KVShardConnection& connection) {
+          // Connections closed by a query server, e.g. on a restart, are
+          // readable even though no reply is outstanding on them
+          return connection.transport->isOpen()
+              && ReplyGather::IsQuiet(connection.socket->getSocketFD());
+        }, max_idle);
   }
 
-  stdcxx::shared_ptr<TProcessor> getProcessor(const TConnectionInfo&) {
-    stdcxx::shared_ptr<KVAggregatorServiceHandler> handler(
-        new KVAggregatorServiceHandler(num_shards_));
-    stdcxx::shared_ptr<TProcessor> handlerProcessor(
+  std::shared_ptr<TProcessor> getProcessor(const TConnectionInfo&) {
+    std::shared_ptr<KVAggregatorServiceHandler> handler(
+        new KVAggregatorServiceHandler(num_shards_, shards_per_server_,
+                                       timeout_ms_, pool_));
+    std::shared_ptr<TProcessor> handlerProcessor(
         new KVAggregatorServiceProcessor(handler));
     return handlerProcessor;
   }
 
  private:
   uint32_t num_shards_;
+  uint32_t shards_per_server_;
+  int32_t timeout_ms_;
+  std::shared_ptr<KVShardPool> pool_;
 };
 
 void print_usage(char *exec) {
-  fprintf(stderr, "Usage: %s [-s num_shards]\n", exec);
+  fprintf(stderr, "Usage: %s [-s num_shards] [-l shards_per_server] "
+          "[-t timeout_ms] [-n] [-w num_workers] [-q max_pending] "
+          "[-i max_idle]\n", exec);
 }
 
 int main(int argc, char **argv) {
-  if (argc < 1 || argc > 3) {
+  if (argc < 1 || argc > 14) {
     print_usage(argv[0]);
     return -1;
   }
 
   int c;
-  uint32_t num_shards = 1;
+  uint32_t num_shards = 1, shards_per_server = 1;
+  int32_t timeout_ms = 0;
+  uint32_t max_idle = KVShardPool::kDefaultMaxIdle;
+  ServerOptions server_options;
 
-  while ((c = getopt(argc, argv, "s:")) != -1) {
+  while ((c = getopt(argc, argv, "s:l:t:nw:q:i:")) != -1) {
     switch (c) {
       case 's': {
         num_shards = atoi(optarg);
         break;
       }
+      case 'l': {
+        shards_per_server = std::max(atoi(optarg), 1);
+        break;
+      }
+      case 't': {
+        timeout_ms = atoi(optarg);
+        break;
+      }
+      case 'n': {
+        server_options.mode = POOLED_SERVER;
+        break;
+      }
+      case 'w': {
+        server_options.num_workers = atoi(optarg);
+        break;
+      }
+      case 'q': {
+        server_options.max_pending = atoi(optarg);
+        break;
+      }
+      case 'i': {
+        max_idle = atoi(optarg);
+        break;
+      }
       default: {
         fprintf(stderr, "Error parsing command line arguments.\n");
         return -1;
@@ -236,14 +488,9 @@ int main(int argc, char **argv) {
   int port = KV_AGGREGATOR_PORT;
   try {
     shared_ptr<KVHandlerProcessorFactory> handlerFactory(
-        new KVHandlerProcessorFactory(num_shards));
-    shared_ptr<TServerSocket> server_transport(new TServerSocket(port));
-    shared_ptr<TBufferedTransportFactory> transport_factory(
-        new TBufferedTransportFactory());
-    shared_ptr<TProtocolFactory> protocol_factory(new TBinaryProtocolFactory());
-    TThreadedServer server(handlerFactory, server_transport, transport_factory,
-                           protocol_factory);
-    server.serve();
+        new KVHandlerProcessorFactory(num_shards, shards_per_server,
+                                      timeout_ms, max_idle));
+    Serve(handlerFactory, port, server_options);
   } catch (std::exception& e) {
     fprintf(stderr, "Exception at aggregator.cc:main(): %s\n", e.what());
   }
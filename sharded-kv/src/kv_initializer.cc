@@ -16,9 +16,9 @@ using namespace ::apache::thrift::server;
 // Dummy program to initialize the Aggregator and die;
 // Does not take any command line arguments
 int main() {
-  stdcxx::shared_ptr<TSocket> socket_(new TSocket("localhost", KV_AGGREGATOR_PORT));
-  stdcxx::shared_ptr<TTransport> transport_(new TBufferedTransport(socket_));
-  stdcxx::shared_ptr<TProtocol> protocol_(new TBinaryProtocol(transport_));
+  std::shared_ptr<TSocket> socket_(new TSocket("localhost", KV_AGGREGATOR_PORT));
+  std::shared_ptr<TTransport> transport_(new TFramedTransport(socket_));
+  std::shared_ptr<TProtocol> protocol_(new TBinaryProtocol(transport_));
   transport_->open();
   KVAggregatorServiceClient client_(protocol_);
   client_.Initialize();
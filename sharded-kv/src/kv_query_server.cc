@@ -1,6 +1,6 @@
 #include "KVQueryService.h"
-#include "succinctkv_constants.h"
 #include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/processor/TMultiplexedProcessor.h>
 #include <thrift/transport/TServerSocket.h>
 #include <thrift/transport/TBufferTransports.h>
 #include <thrift/server/TThreadedServer.h>
@@ -13,13 +13,14 @@
 
 #include "succinct_shard.h"
 #include "kv_ports.h"
+#include "utils/server_mode.h"
 
 using namespace ::apache::thrift;
 using namespace ::apache::thrift::protocol;
 using namespace ::apache::thrift::transport;
 using namespace ::apache::thrift::server;
 
-using stdcxx::shared_ptr;
+using std::shared_ptr;
 
 class KVQueryServiceHandler : virtual public KVQueryServiceIf {
  public:
@@ -27,7 +28,8 @@ class KVQueryServiceHandler : virtual public KVQueryServiceIf {
                         uint32_t sa_sampling_rate, uint32_t isa_sampling_rate,
                         SamplingScheme sampling_scheme,
                         NPA::NPAEncodingScheme npa_scheme,
-                        bool regex_opt = true) {
+                        bool regex_opt = true,
+                        const PageInConfig& page_in_config = PageInConfig()) {
     succinct_shard_ = NULL;
     mode_ = mode;
     filename_ = filename;
@@ -38,6 +40,7 @@ class KVQueryServiceHandler : virtual public KVQueryServiceIf {
     regex_opt_ = regex_opt;
     sampling_scheme_ = sampling_scheme;
     npa_scheme_ = npa_scheme;
+    page_in_config_ = page_in_config;
   }
 
   int32_t Initialize(int32_t id) {
@@ -63,7 +66,15 @@ class KVQueryServiceHandler : virtual public KVQueryServiceIf {
       succinct_shard_ = new SuccinctShard(id, filename_, mode,
                                           sa_sampling_rate_, isa_sampling_rate_,
                                           128, sampling_scheme_,
-                                          sampling_scheme_, npa_scheme_);
+                                          sampling_scheme_, npa_scheme_, 3,
+                                          1024, 1, page_in_config_);
+      if (!succinct_shard_->IsLoaded()) {
+        fprintf(stderr, "Failed to initialize shard: could not load %s\n",
+                filename_.c_str());
+        delete succinct_shard_;
+        succinct_shard_ = NULL;
+        return -1;
+      }
       if (mode_ == 0) {
         fprintf(stderr, "Serializing data structures for file %s\n",
                 filename_.c_str());
@@ -74,6 +85,10 @@ class KVQueryServiceHandler : virtual public KVQueryServiceIf {
       }
       fprintf(stderr, "Initialized shard with original size = %llu\n",
               succinct_shard_->GetOriginalSize());
+      fprintf(stderr, "Huge pages: %zu bytes explicit, %zu bytes transparent, "
+              "%zu fallbacks\n", SuccinctAllocator::HugeTLBBytes(),
+              SuccinctAllocator::TransparentHugePageBytes(),
+              SuccinctAllocator::NumFallbacks());
       is_init_ = true;
       num_keys_ = succinct_shard_->GetNumKeys();
       fprintf(stderr, "Waiting for queries...\n");
@@ -95,16 +110,23 @@ class KVQueryServiceHandler : virtual public KVQueryServiceIf {
     succinct_shard_->Access(_return, key, offset, len);
   }
 
-  void Search(std::set<int64_t>& _return, const std::string& query) {
-    succinct_shard_->Search(_return, query);
+  void Search(std::vector<int64_t>& _return, const std::string& query,
+              const int64_t offset, const int64_t limit) {
+    succinct_shard_->Search(_return, query, offset, limit);
   }
 
-  void Regex(std::set<int64_t> &_return, const std::string &query) {
-    std::set<std::pair<size_t, size_t>> results;
+  void Regex(std::vector<int64_t> &_return, const std::string &query,
+             const int64_t offset, const int64_t limit) {
+    std::vector<std::pair<size_t, size_t>> results;
     succinct_shard_->RegexSearch(results, query, regex_opt_);
+
+    // Matches are sorted on offset; keep one entry per offset
+    std::vector<int64_t> offsets;
     for (auto res : results) {
-      _return.insert((int64_t) res.first);
+      if (offsets.empty() || offsets.back() != (int64_t) res.first)
+        offsets.push_back((int64_t) res.first);
     }
+    SortedVector::Page(_return, offsets, offset, limit);
   }
 
   int64_t Count(const std::string& query) {
@@ -130,6 +152,7 @@ class KVQueryServiceHandler : virtual public KVQueryServiceIf {
   SamplingScheme sampling_scheme_;
   NPA::NPAEncodingScheme npa_scheme_;
   bool regex_opt_;
+  PageInConfig page_in_config_;
 };
 
 SamplingScheme SamplingSchemeFromOption(int opt) {
@@ -163,13 +186,13 @@ NPA::NPAEncodingScheme EncodingSchemeFromOption(int opt) {
 void print_usage(char *exec) {
   fprintf(
       stderr,
-      "Usage: %s [-m mode] [-p port] [-s sa_sampling_rate_] [-i isa_sampling_rate_] [-x sampling_scheme_] [-r npa_encoding_scheme] [-o] [file]\n",
+      "Usage: %s [-m mode] [-p port] [-s sa_sampling_rate_] [-i isa_sampling_rate_] [-x sampling_scheme_] [-r npa_encoding_scheme] [-o] [-n] [-w num_workers] [-q max_pending] [-g] [-l page_in_policy] [-b prefetch_mbps] [-N numa_node] [file...]\n",
       exec);
 }
 
 int main(int argc, char **argv) {
 
-  if (argc < 2 || argc > 15) {
+  if (argc < 2) {
     print_usage(argv[0]);
     return -1;
   }
@@ -187,8 +210,10 @@ int main(int argc, char **argv) {
   SamplingScheme scheme = SamplingScheme::FLAT_SAMPLE_BY_INDEX;
   NPA::NPAEncodingScheme npa_scheme =
       NPA::NPAEncodingScheme::ELIAS_GAMMA_ENCODED;
+  ServerOptions server_options;
+  PageInConfig page_in_config;
 
-  while ((c = getopt(argc, argv, "m:p:s:i:r:x:o")) != -1) {
+  while ((c = getopt(argc, argv, "m:p:s:i:r:x:onw:q:gl:b:N:")) != -1) {
     switch (c) {
       case 'm':
         mode = atoi(optarg);
@@ -211,6 +236,30 @@ int main(int argc, char **argv) {
       case 'o':
         regex_opt = true;
         break;
+      case 'n':
+        server_options.mode = POOLED_SERVER;
+        break;
+      case 'w':
+        server_options.num_workers = atoi(optarg);
+        break;
+      case 'q':
+        server_options.max_pending = atoi(optarg);
+        break;
+      case 'g':
+        SuccinctAllocator::UseHugePagesByDefault(true);
+        break;
+      case 'l':
+        if (!PageInConfig::Parse(optarg, &page_in_config)) {
+          fprintf(stderr, "Invalid page-in policy %s.\n", optarg);
+          return -1;
+        }
+        break;
+      case 'b':
+        page_in_config.prefetch_rate = atoll(optarg) * 1024 * 1024;
+        break;
+      case 'N':
+        page_in_config.numa_node = atoi(optarg);
+        break;
       default:
         fprintf(stderr, "Error parsing command line arguments.\n");
     }
@@ -221,22 +270,34 @@ int main(int argc, char **argv) {
     return -1;
   }
 
-  std::string filename = std::string(argv[optind]);
+  // Threads created from here on, including those handling requests, run on
+  // the cores of the node and allocate from its memory; the shards are
+  // placed on it as they are loaded
+  if (page_in_config.numa_node >= 0) {
+    if (!NumaUtils::BindThread(page_in_config.numa_node)) {
+      fprintf(stderr, "Could not bind to NUMA node %d.\n",
+              page_in_config.numa_node);
+      return -1;
+    }
+    fprintf(stderr, "Bound to NUMA node %d.\n", page_in_config.numa_node);
+  }
 
-  shared_ptr<KVQueryServiceHandler> handler(
-      new KVQueryServiceHandler(filename, mode, sa_sampling_rate,
-                                isa_sampling_rate, scheme, npa_scheme,
-                                regex_opt));
-  shared_ptr<TProcessor> processor(new KVQueryServiceProcessor(handler));
+  // Each file is a shard, served under its index among the files
+  shared_ptr<TMultiplexedProcessor> processor(new TMultiplexedProcessor());
+  for (int i = optind; i < argc; i++) {
+    shared_ptr<KVQueryServiceHandler> handler(
+        new KVQueryServiceHandler(argv[i], mode, sa_sampling_rate,
+                                  isa_sampling_rate, scheme, npa_scheme,
+                                  regex_opt, page_in_config));
+    processor->registerProcessor(
+        std::to_string(i - optind),
+        shared_ptr<TProcessor>(new KVQueryServiceProcessor(handler)));
+  }
 
   try {
-    shared_ptr<TServerSocket> server_transport(new TServerSocket(port));
-    shared_ptr<TBufferedTransportFactory> transport_factory(
-        new TBufferedTransportFactory());
-    shared_ptr<TProtocolFactory> protocol_factory(new TBinaryProtocolFactory());
-    TThreadedServer server(processor, server_transport, transport_factory,
-                           protocol_factory);
-    server.serve();
+    shared_ptr<TProcessorFactory> processor_factory(
+        new TSingletonProcessorFactory(processor));
+    Serve(processor_factory, port, server_options);
   } catch (std::exception& e) {
     fprintf(stderr, "Exception at query_server.cc:main(): %s\n", e.what());
   }
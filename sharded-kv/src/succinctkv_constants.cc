@@ -1,17 +0,0 @@
-/**
- * Autogenerated by Thrift Compiler (0.12.0)
- *
- * DO NOT EDIT UNLESS YOU ARE SURE THAT YOU KNOW WHAT YOU ARE DOING
- *  @generated
- */
-#include "succinctkv_constants.h"
-
-
-
-const succinctkvConstants g_succinctkv_constants;
-
-succinctkvConstants::succinctkvConstants() {
-}
-
-
-
@@ -5,11 +5,30 @@ service KVAggregatorService {
 
     string Get(1:i64 key),
     string Access(1:i64 key, 2:i32 offset, 3:i32 len),
-    set<i64> Search(1:string query),
-    set<i64> Regex(1:string query),
+    /**
+     * Keys whose values contain query, a page of up to limit keys after
+     * skipping offset of them; a negative limit gets all of the remaining
+     * keys. Each shard walks every occurrence of query up to its page, the
+     * skipped ones included, so a page costs more the deeper it is; the
+     * walk is bounded by looking up every occurrence in the suffix array.
+     */
+    list<i64> Search(1:string query, 2:i64 offset = 0, 3:i64 limit = -1),
+    /**
+     * Offsets of the matches of query, a page of up to limit matches after
+     * skipping offset of them; a negative limit gets all of the remaining
+     * matches. Every page computes all of the matches on each shard, and
+     * only the page is returned, so a page costs as much as getting every
+     * match.
+     */
+    list<i64> Regex(1:string query, 2:i64 offset = 0, 3:i64 limit = -1),
     i64 Count(1:string query),
 
     i32 GetNumShards(),
+    /**
+     * Number of shards left out of the result of the last query on this
+     * connection, because they were unreachable or missed the deadline
+     */
+    i32 GetNumMissedShards(),
     i32 GetNumKeys(),
     i32 GetNumKeysShard(1:i32 shard_id),
     i64 GetTotSize(),
@@ -20,8 +39,22 @@ service KVQueryService {
     
     string Get(1:i64 key),
     string Access(1:i64 key, 2:i32 offset, 3:i32 len),
-    set<i64> Search(1:string query),
-    set<i64> Regex(1:string query),
+    /**
+     * Keys whose values contain query, a page of up to limit keys after
+     * skipping offset of them; a negative limit gets all of the remaining
+     * keys. Each shard walks every occurrence of query up to its page, the
+     * skipped ones included, so a page costs more the deeper it is; the
+     * walk is bounded by looking up every occurrence in the suffix array.
+     */
+    list<i64> Search(1:string query, 2:i64 offset = 0, 3:i64 limit = -1),
+    /**
+     * Offsets of the matches of query, a page of up to limit matches after
+     * skipping offset of them; a negative limit gets all of the remaining
+     * matches. Every page computes all of the matches on each shard, and
+     * only the page is returned, so a page costs as much as getting every
+     * match.
+     */
+    list<i64> Regex(1:string query, 2:i64 offset = 0, 3:i64 limit = -1),
     i64 Count(1:string query),
     
     i32 GetNumKeys(),
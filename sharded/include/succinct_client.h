@@ -15,9 +15,9 @@ using namespace ::apache::thrift::transport;
 class SuccinctClient {
  public:
   SuccinctClient(const std::string& host, const uint32_t port = AGGREGATOR_PORT) {
-    socket_ = stdcxx::shared_ptr<TSocket>(new TSocket("localhost", port));
-    transport_ = stdcxx::shared_ptr<TTransport>(new TBufferedTransport(socket_));
-    protocol_ = stdcxx::shared_ptr<TProtocol>(new TBinaryProtocol(transport_));
+    socket_ = std::shared_ptr<TSocket>(new TSocket("localhost", port));
+    transport_ = std::shared_ptr<TTransport>(new TFramedTransport(socket_));
+    protocol_ = std::shared_ptr<TProtocol>(new TBinaryProtocol(transport_));
     transport_->open();
     client_ = new AggregatorServiceClient(protocol_);
     client_->ConnectToServers();
@@ -29,8 +29,9 @@ class SuccinctClient {
     delete client_;
   }
 
-  void Regex(std::set<int64_t> & _return, const std::string& query) {
-    client_->Regex(_return, query);
+  void Regex(std::vector<int64_t> & _return, const std::string& query,
+             int64_t offset = 0, int64_t limit = -1) {
+    client_->Regex(_return, query, offset, limit);
   }
 
   int64_t Count(const std::string& query) {
@@ -42,22 +43,30 @@ class SuccinctClient {
     client_->Extract(_return, offset, len);
   }
 
-  void Search(std::vector<int64_t> & _return, const std::string& query) {
-    client_->Search(_return, query);
+  void Search(std::vector<int64_t> & _return, const std::string& query,
+              int64_t offset = 0, int64_t limit = -1) {
+    client_->Search(_return, query, offset, limit);
   }
 
   int32_t GetNumShards() {
     return client_->GetNumShards();
   }
 
+  // Number of shards missing from the result of the last query, having
+  // missed its deadline
+  int32_t GetNumMissedShards() {
+    return client_->GetNumMissedShards();
+  }
+
   int64_t GetTotSize() {
     return client_->GetTotSize();
   }
 
   // Non-blocking send/receive calls
   // Send calls
-  void SendRegex(const std::string& query) {
-    client_->send_Regex(query);
+  void SendRegex(const std::string& query, int64_t offset = 0,
+                 int64_t limit = -1) {
+    client_->send_Regex(query, offset, limit);
   }
 
   void SendCount(const std::string& query) {
@@ -68,12 +77,13 @@ class SuccinctClient {
     client_->send_Extract(offset, len);
   }
 
-  void SendSearch(const std::string& query) {
-    client_->send_Search(query);
+  void SendSearch(const std::string& query, int64_t offset = 0,
+                  int64_t limit = -1) {
+    client_->send_Search(query, offset, limit);
   }
 
   // Receive calls
-  void RecvRegex(std::set<int64_t> & _return) {
+  void RecvRegex(std::vector<int64_t> & _return) {
     client_->recv_Regex(_return);
   }
 
@@ -90,9 +100,9 @@ class SuccinctClient {
   }
 
  private:
-  stdcxx::shared_ptr<TSocket> socket_;
-  stdcxx::shared_ptr<TTransport> transport_;
-  stdcxx::shared_ptr<TProtocol> protocol_;
+  std::shared_ptr<TSocket> socket_;
+  std::shared_ptr<TTransport> transport_;
+  std::shared_ptr<TProtocol> protocol_;
   AggregatorServiceClient *client_;
 
 };
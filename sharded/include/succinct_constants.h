@@ -1,24 +0,0 @@
-/**
- * Autogenerated by Thrift Compiler (0.12.0)
- *
- * DO NOT EDIT UNLESS YOU ARE SURE THAT YOU KNOW WHAT YOU ARE DOING
- *  @generated
- */
-#ifndef succinct_CONSTANTS_H
-#define succinct_CONSTANTS_H
-
-#include "succinct_types.h"
-
-
-
-class succinctConstants {
- public:
-  succinctConstants();
-
-};
-
-extern const succinctConstants g_succinct_constants;
-
-
-
-#endif
@@ -7,6 +7,7 @@
 #include <iterator>
 
 #include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/protocol/TMultiplexedProtocol.h>
 #include <thrift/server/TThreadedServer.h>
 #include <thrift/server/TNonblockingServer.h>
 #include <thrift/transport/TSocket.h>
@@ -14,8 +15,10 @@
 #include <thrift/concurrency/PosixThreadFactory.h>
 
 #include "succinct_shard.h"
+#include "utils/connection_pool.h"
+#include "utils/reply_gather.h"
+#include "utils/server_mode.h"
 #include "AggregatorService.h"
-#include "succinct_constants.h"
 #include "QueryService.h"
 #include "ports.h"
 
@@ -24,32 +27,66 @@ using namespace ::apache::thrift::protocol;
 using namespace ::apache::thrift::transport;
 using namespace ::apache::thrift::server;
 
-using stdcxx::shared_ptr;
+using std::shared_ptr;
+
+// Connection to a shard. Query servers host shards_per_server consecutive
+// shards each, under their index on the server.
+struct ShardConnection {
+  ShardConnection(uint32_t shard, uint32_t shards_per_server)
+      : socket(new TSocket("localhost",
+                           SERVER_PORT + shard / shards_per_server)),
+        transport(new TFramedTransport(socket)),
+        client(std::shared_ptr<TProtocol>(new TMultiplexedProtocol(
+            std::shared_ptr<TProtocol>(new TBinaryProtocol(transport)),
+            std::to_string(shard % shards_per_server)))) {
+    transport->open();
+  }
+
+  // Make reads time out at deadline, so that a shard that stops sending
+  // half way through a reply cannot stall a query past it
+  void SetDeadline(ReplyGather::Clock::time_point deadline) {
+    socket->setRecvTimeout(ReplyGather::RecvTimeoutMs(deadline));
+  }
+
+  std::shared_ptr<TSocket> socket;
+  std::shared_ptr<TTransport> transport;
+  QueryServiceClient client;
+};
+
+typedef ConnectionPool<ShardConnection> ShardPool;
 
 class AggregatorServiceHandler : virtual public AggregatorServiceIf {
  public:
-  AggregatorServiceHandler(uint32_t num_shards) {
+  AggregatorServiceHandler(uint32_t num_shards, uint32_t shards_per_server,
+                           int32_t timeout_ms,
+                           std::shared_ptr<ShardPool> pool) {
     num_shards_ = num_shards;
+    shards_per_server_ = shards_per_server;
+    timeout_ms_ = timeout_ms;
+    deadline_ = ReplyGather::NoDeadline();
+    pool_ = pool;
+    stream_.open = false;
+  }
+
+  ~AggregatorServiceHandler() {
+    CloseStream();
+    ReleaseShards(false);
   }
 
   int32_t Initialize() {
     // Connect to query servers and start initialization
     fprintf(stderr, "Num shards = %u\n", num_shards_);
+    std::vector<std::shared_ptr<ShardConnection>> qservers;
     for (uint32_t i = 0; i < num_shards_; i++) {
-      int port = SERVER_PORT + i;
-      stdcxx::shared_ptr<TSocket> socket(new TSocket("localhost", port));
-      stdcxx::shared_ptr<TTransport> transport(new TBufferedTransport(socket));
-      stdcxx::shared_ptr<TProtocol> protocol(new TBinaryProtocol(transport));
-      QueryServiceClient client(protocol);
-      transport->open();
+      std::shared_ptr<ShardConnection> qserver(
+          new ShardConnection(i, shards_per_server_));
       fprintf(stderr, "Connected to QueryServer %u!\n", i);
-      client.send_Initialize(i);
-      qservers_.push_back(client);
-      qserver_transports_.push_back(transport);
+      qserver->client.send_Initialize(i);
+      qservers.push_back(qserver);
     }
 
-    for (auto client : qservers_) {
-      int32_t status = client.recv_Initialize();
+    for (auto qserver : qservers) {
+      int32_t status = qserver->client.recv_Initialize();
       if (status) {
         fprintf(stderr, "Initialization failed, status = %d!\n", status);
         return status;
@@ -57,55 +94,65 @@ class AggregatorServiceHandler : virtual public AggregatorServiceIf {
     }
 
     size_t offset = 0, client_id = 0;
-    for (auto client : qservers_) {
+    for (auto qserver : qservers) {
       shard_map_[offset] = client_id;
       offset_map_[client_id] = offset;
       fprintf(stderr, "(%zu, %zu)\n", offset, client_id);
       client_id++;
-      offset += client.GetShardSize();
+      offset += qserver->client.GetShardSize();
     }
 
     fprintf(stderr, "All QueryServers successfully initialized!\n");
 
-    for (auto transport : qserver_transports_) {
-      transport->close();
+    for (auto qserver : qservers) {
+      qserver->transport->close();
     }
-    qserver_transports_.clear();
-    qservers_.clear();
 
     return 0;
   }
 
-  void Regex(std::set<int64_t> & _return, const std::string& query) {
-    for (int j = 0; j < qservers_.size(); j++) {
-      qservers_[j].send_Regex(query);
-    }
-
-    for (int j = 0; j < qservers_.size(); j++) {
-      std::set<int64_t> results;
-      qservers_[j].recv_Regex(results);
-      _return.insert(results.begin(), results.end());
+  void Regex(std::vector<int64_t> & _return, const std::string& query,
+             const int64_t offset, const int64_t limit) {
+    // Shards hold consecutive ranges of the file and return sorted matches,
+    // so matches in shard order are sorted
+    ShardLeases leases(this);
+    if (ResumeStream(REGEX_STREAM, query, offset)) {
+      deadline_ = ReplyGather::DeadlineIn(timeout_ms_);
+    } else {
+      StartQuery();
+      OpenStream(REGEX_STREAM, query,
+                 std::vector<int64_t>(conns_.size(), 0));
     }
+    ReadStream(_return, std::max<int64_t>(offset, 0) - stream_.position,
+               limit);
   }
 
   int64_t Count(const std::string& query) {
-    int64_t ret = 0;
-    for (int j = 0; j < qservers_.size(); j++) {
-      qservers_[j].send_Count(query);
-    }
+    ShardLeases leases(this);
+    StartQuery();
+    CloseStream();
+    std::vector<int64_t> counts(conns_.size(), 0);
+    ScatterGather(AllShards(), [&](uint32_t j) {
+      Shard(j).send_Count(query);
+    }, [&](uint32_t j) {
+      counts[j] = Reply(j).recv_Count();
+    });
 
-    for (int j = 0; j < qservers_.size(); j++) {
-      ret += qservers_[j].recv_Count();
+    int64_t ret = 0;
+    for (auto count : counts) {
+      ret += count;
     }
     return ret;
   }
 
   void Extract(std::string& _return, const int64_t offset, const int64_t len) {
+    ShardLeases leases(this);
+    CloseStream();
     auto it = greatest_less(shard_map_, offset);
     if(it != shard_map_.end()) {
       size_t shard_id = it->second;
       size_t shard_offset = it->first;
-      qservers_.at(shard_id).Extract(_return, offset - shard_offset, len);
+      Call(shard_id).Extract(_return, offset - shard_offset, len);
     } else {
       // TODO: Thrift does not support empty string/null string returns
       // Find a better way to indicate invalid offset
@@ -113,73 +160,398 @@ class AggregatorServiceHandler : virtual public AggregatorServiceIf {
     }
   }
 
-  void Search(std::vector<int64_t> & _return, const std::string& query) {
-    for (int j = 0; j < qservers_.size(); j++) {
-      qservers_[j].send_Search(query);
-    }
-
-    for (int j = 0; j < qservers_.size(); j++) {
-      std::vector<int64_t> results;
-      qservers_[j].recv_Search(results);
-      for (auto offset : results) {
-        _return.push_back(offset_map_[j] + offset);
+  void Search(std::vector<int64_t> & _return, const std::string& query,
+              const int64_t offset, const int64_t limit) {
+    // Results follow shard order. Past the first page, the number of results
+    // on each shard locates the page, so that shards skip the results
+    // before it rather than sending them.
+    ShardLeases leases(this);
+    if (ResumeStream(SEARCH_STREAM, query, offset)) {
+      deadline_ = ReplyGather::DeadlineIn(timeout_ms_);
+    } else {
+      StartQuery();
+      CloseStream();
+      std::vector<int64_t> shard_offsets(conns_.size(), 0);
+      if (offset > 0) {
+        std::vector<int64_t> counts(conns_.size(), 0);
+        ScatterGather(AllShards(), [&](uint32_t j) {
+          Shard(j).send_Count(query);
+        }, [&](uint32_t j) {
+          counts[j] = Reply(j).recv_Count();
+        });
+        int64_t skip = offset;
+        for (int j = 0; j < conns_.size(); j++) {
+          shard_offsets[j] = std::min(skip, counts[j]);
+          skip -= shard_offsets[j];
+        }
       }
+      OpenStream(SEARCH_STREAM, query, shard_offsets);
     }
+    ReadStream(_return, std::max<int64_t>(offset, 0) - stream_.position,
+               limit);
   }
 
   int32_t GetNumShards() {
     return num_shards_;
   }
 
+  int32_t GetNumMissedShards() {
+    return std::count(missed_shards_.begin(), missed_shards_.end(), true);
+  }
+
   int64_t GetTotSize() {
+    ShardLeases leases(this);
+    CloseStream();
     int64_t tot_size = 0;
-    for (auto client : qservers_) {
-      tot_size += client.GetShardSize();
+    for (uint32_t j = 0; j < conns_.size(); j++) {
+      tot_size += Call(j).GetShardSize();
     }
     return tot_size;
   }
 
   int32_t ConnectToServers() {
+    // Connections come from the pool shared by all clients; check that every
+    // shard can be reached
+    ShardLeases leases(this);
+    CloseStream();
+    conns_.resize(num_shards_);
     for (int i = 0; i < num_shards_; i++) {
       fprintf(stderr, "Connecting to local server %d...", i);
       try {
-        stdcxx::shared_ptr<TSocket> socket(
-            new TSocket("localhost", SERVER_PORT + i));
-        stdcxx::shared_ptr<TTransport> transport(new TBufferedTransport(socket));
-        stdcxx::shared_ptr<TProtocol> protocol(new TBinaryProtocol(transport));
-        QueryServiceClient qsclient(protocol);
-        transport->open();
+        Shard(i);
         fprintf(stderr, "Connected!\n");
-        qservers_.push_back(qsclient);
-        qserver_transports_.push_back(transport);
-        fprintf(stderr, "Pushed!\n");
       } catch (std::exception& e) {
         fprintf(stderr, "Could not connect to server...: %s\n", e.what());
         return 1;
       }
     }
     fprintf(stderr, "Currently have %zu local server connections.\n",
-            qservers_.size());
+            conns_.size());
+
+    // Shards hold consecutive ranges of the file, in shard order
+    int64_t offset = 0;
+    for (uint32_t i = 0; i < conns_.size(); i++) {
+      shard_map_[offset] = i;
+      offset_map_[i] = offset;
+      offset += Call(i).GetShardSize();
+    }
     return 0;
   }
 
   int32_t DisconnectFromServers() {
-    for (int i = 0; i < qservers_.size(); i++) {
+    CloseStream();
+    ReleaseShards(false);
+    conns_.clear();
+    return 0;
+  }
+
+ private:
+  // Gives the connections leased during a call back to the pool when the
+  // call returns, except those of an open stream that still await a batch.
+  // A call that throws may leave replies unread, so its connections are
+  // closed instead.
+  class ShardLeases {
+   public:
+    ShardLeases(AggregatorServiceHandler *handler) {
+      handler_ = handler;
+    }
+
+    ~ShardLeases() {
+      handler_->ReleaseShards(std::uncaught_exception());
+    }
+
+   private:
+    AggregatorServiceHandler *handler_;
+  };
+
+  // Client for query server j, on a connection leased from the pool until
+  // the current call, or the stream it opens, is done with it
+  QueryServiceClient& Shard(uint32_t j) {
+    if (!conns_.at(j))
+      conns_[j] = pool_->Lease(j);
+    return conns_[j]->client;
+  }
+
+  // Client for shard j, to receive the reply to a request sent with
+  // Shard(j) by the query deadline
+  QueryServiceClient& Reply(uint32_t j) {
+    conns_.at(j)->SetDeadline(deadline_);
+    return conns_[j]->client;
+  }
+
+  // Client for shard j, for a call that sends a request and waits up to
+  // timeout_ms for its reply
+  QueryServiceClient& Call(uint32_t j) {
+    Shard(j);
+    conns_[j]->SetDeadline(ReplyGather::DeadlineIn(timeout_ms_));
+    return conns_[j]->client;
+  }
+
+  // Give the leased connections back to the pool, or close them along with
+  // the open stream if drop is set. Between calls, an open stream keeps
+  // only the connections with a batch in flight; the others are leased
+  // again when the stream requests its next batch from them.
+  void ReleaseShards(bool drop) {
+    if (drop)
+      stream_.open = false;
+    else if (stream_.open)
+      CollectBatches();
+    for (uint32_t j = 0; j < conns_.size(); j++) {
+      if (!conns_[j] || (stream_.open && stream_.in_flight[j]))
+        continue;
+      if (!drop)
+        pool_->Return(j, conns_[j]);
+      conns_[j].reset();
+    }
+  }
+
+  std::vector<uint32_t> AllShards() {
+    std::vector<uint32_t> shards(conns_.size());
+    for (uint32_t j = 0; j < conns_.size(); j++) {
+      shards[j] = j;
+    }
+    return shards;
+  }
+
+  // Start the deadline of a query
+  void StartQuery() {
+    deadline_ = ReplyGather::DeadlineIn(timeout_ms_);
+    missed_shards_.assign(conns_.size(), false);
+  }
+
+  // Leave shard j out of the result of the current query, and close its
+  // connection so that its late reply is never read
+  void MissShard(uint32_t j) {
+    fprintf(stderr, "Shard %u missed the query deadline.\n", j);
+    missed_shards_[j] = true;
+    conns_[j].reset();
+  }
+
+  // Send a request to each of shards with send(j), and receive the replies
+  // with recv(j) in the order they arrive. Shards that cannot be reached or
+  // that miss the query deadline are left out of the result.
+  template<typename Send, typename Recv>
+  void ScatterGather(const std::vector<uint32_t>& shards, Send send,
+                     Recv recv) {
+    std::vector<int> fds(shards.size(), -1);
+    std::vector<uint32_t> missed;
+    for (size_t k = 0; k < shards.size(); k++) {
       try {
-        fprintf(stderr, "Disconnecting from local server %d\n", i);
-        qserver_transports_[i]->close();
-        fprintf(stderr, "Disconnected!\n");
+        send(shards[k]);
+        fds[k] = conns_[shards[k]]->socket->getSocketFD();
       } catch (std::exception& e) {
-        fprintf(stderr, "Could not close local connection: %s\n", e.what());
-        return 1;
+        missed.push_back(shards[k]);
       }
     }
-    qserver_transports_.clear();
-    qservers_.clear();
-    return 0;
+
+    std::vector<size_t> late = ReplyGather::Wait(fds, deadline_,
+                                                 [&](size_t k) {
+      recv(shards[k]);
+    });
+    for (auto k : late) {
+      missed.push_back(shards[k]);
+    }
+    for (auto j : missed) {
+      MissShard(j);
+    }
   }
 
- private:
+  enum StreamOp {
+    SEARCH_STREAM = 0,
+    REGEX_STREAM = 1
+  };
+
+  // Results of the last Search or Regex, delivered in shard order as the
+  // client pages through them. Shards send their results in batches of at
+  // most kStreamBatchSize, and the request for the next batch of a shard is
+  // sent as soon as its current batch arrives, so that shards work ahead of
+  // the client while the aggregator holds one batch per shard. When a call
+  // returns, batches that have already arrived are received, and the batch
+  // after each is requested only once it is used up; an idle stream thus
+  // holds only the connections still awaiting a batch.
+  struct ResultStream {
+    bool open;
+    StreamOp op;
+    std::string query;
+    int64_t position;                           // Results passed so far
+    size_t shard;                               // Shard being read
+    std::vector<std::vector<int64_t>> batches;  // Current batch of each shard
+    std::vector<size_t> batch_pos;              // Next result in each batch
+    std::vector<int64_t> next_offsets;          // Shard offset of next batch
+    std::vector<bool> in_flight;                // Next batch requested
+    std::vector<bool> more;                     // Shard may have more
+  };
+
+  static const int64_t kStreamBatchSize = 1 << 16;
+
+  // Check if the open stream can deliver the results of query from offset
+  bool ResumeStream(StreamOp op, const std::string& query, int64_t offset) {
+    return stream_.open && stream_.op == op && stream_.query == query
+        && std::max<int64_t>(offset, 0) >= stream_.position;
+  }
+
+  // Start streaming the results of query, from shard_offsets[j] on shard j
+  void OpenStream(StreamOp op, const std::string& query,
+                  const std::vector<int64_t>& shard_offsets) {
+    CloseStream();
+    stream_.open = true;
+    stream_.op = op;
+    stream_.query = query;
+    stream_.position = 0;
+    stream_.shard = 0;
+    stream_.batches.assign(conns_.size(), std::vector<int64_t>());
+    stream_.batch_pos.assign(conns_.size(), 0);
+    stream_.next_offsets = shard_offsets;
+    stream_.in_flight.assign(conns_.size(), false);
+    stream_.more.assign(conns_.size(), false);
+    for (size_t j = 0; j < conns_.size(); j++) {
+      stream_.position += shard_offsets[j];
+      if (!missed_shards_[j])
+        RequestBatch(j);
+    }
+  }
+
+  // Discard the open stream. Batches still in flight are received and
+  // dropped as they arrive, so that the connections can carry other
+  // requests; the connections of shards that miss the deadline are closed
+  // instead.
+  void CloseStream() {
+    if (!stream_.open)
+      return;
+    std::vector<int> fds(stream_.in_flight.size(), -1);
+    for (size_t j = 0; j < stream_.in_flight.size(); j++) {
+      if (stream_.in_flight[j])
+        fds[j] = conns_[j]->socket->getSocketFD();
+    }
+    std::vector<size_t> late = ReplyGather::Wait(fds, deadline_,
+                                                 [&](size_t j) {
+      ReceiveBatch(j, false);
+    });
+    for (auto j : late) {
+      conns_[j].reset();
+    }
+    stream_.open = false;
+    stream_.batches.clear();
+  }
+
+  void RequestBatch(size_t j) {
+    try {
+      if (stream_.op == SEARCH_STREAM) {
+        Shard(j).send_Search(stream_.query, stream_.next_offsets[j],
+                                 kStreamBatchSize);
+      } else {
+        Shard(j).send_Regex(stream_.query, stream_.next_offsets[j],
+                                kStreamBatchSize);
+      }
+      stream_.in_flight[j] = true;
+    } catch (std::exception& e) {
+      stream_.more[j] = false;
+      MissShard(j);
+    }
+  }
+
+  // Wait for the next batch of shard j until the query deadline; a shard
+  // that misses it is left out of the rest of the stream
+  void WaitForBatch(size_t j) {
+    std::vector<int> fds(1, conns_[j]->socket->getSocketFD());
+    std::vector<size_t> late = ReplyGather::Wait(fds, deadline_,
+                                                 [&](size_t) {
+      ReceiveBatch(j, true);
+    });
+    if (!late.empty())
+      DropBatch(j);
+  }
+
+  // Leave shard j out of the rest of the stream
+  void DropBatch(size_t j) {
+    stream_.in_flight[j] = false;
+    stream_.more[j] = false;
+    stream_.batches[j].clear();
+    stream_.batch_pos[j] = 0;
+    MissShard(j);
+  }
+
+  // Receive the batches that have already arrived for shards whose current
+  // batch is used up, without waiting for the others, so that their
+  // connections can go back to the pool between calls
+  void CollectBatches() {
+    std::vector<int> fds(stream_.in_flight.size(), -1);
+    for (size_t j = 0; j < stream_.in_flight.size(); j++) {
+      if (stream_.in_flight[j]
+          && stream_.batch_pos[j] == stream_.batches[j].size())
+        fds[j] = conns_[j]->socket->getSocketFD();
+    }
+    std::vector<size_t> failed;
+    ReplyGather::Wait(fds, ReplyGather::Clock::now(), [&](size_t j) {
+      try {
+        ReceiveBatch(j, false);
+      } catch (std::exception& e) {
+        failed.push_back(j);
+      }
+    });
+    for (auto j : failed) {
+      DropBatch(j);
+    }
+  }
+
+  // Receive the next batch of shard j, and if request_next is set, request
+  // the one after it unless the shard has run out of results; otherwise it
+  // is requested once the batch is used up (see ReadStream)
+  void ReceiveBatch(size_t j, bool request_next) {
+    std::vector<int64_t>& batch = stream_.batches[j];
+    batch.clear();
+    if (stream_.op == SEARCH_STREAM) {
+      Reply(j).recv_Search(batch);
+    } else {
+      Reply(j).recv_Regex(batch);
+    }
+    stream_.in_flight[j] = false;
+    stream_.batch_pos[j] = 0;
+    stream_.next_offsets[j] += batch.size();
+    stream_.more[j] = (int64_t) batch.size() == kStreamBatchSize;
+    if (request_next && stream_.more[j])
+      RequestBatch(j);
+  }
+
+  // Skip skip results of the open stream, then append up to limit results
+  // (all, if limit is negative) to out; the stream closes once every shard
+  // has been read
+  void ReadStream(std::vector<int64_t>& out, int64_t skip, int64_t limit) {
+    int64_t remaining = limit;
+    while (stream_.shard < conns_.size()) {
+      if (skip <= 0 && remaining == 0)
+        return;
+      size_t j = stream_.shard;
+      std::vector<int64_t>& batch = stream_.batches[j];
+      if (stream_.batch_pos[j] == batch.size()) {
+        if (!stream_.in_flight[j] && stream_.more[j])
+          RequestBatch(j);
+        if (!stream_.in_flight[j]) {
+          stream_.shard++;
+          continue;
+        }
+        WaitForBatch(j);
+        continue;
+      }
+
+      int64_t n = batch.size() - stream_.batch_pos[j];
+      if (skip > 0) {
+        n = std::min(n, skip);
+        skip -= n;
+      } else {
+        if (remaining > 0) {
+          n = std::min(n, remaining);
+          remaining -= n;
+        }
+        for (int64_t k = 0; k < n; k++) {
+          out.push_back(offset_map_[j] + batch[stream_.batch_pos[j] + k]);
+        }
+      }
+      stream_.batch_pos[j] += n;
+      stream_.position += n;
+    }
+    CloseStream();
+  }
 
   template<typename Map> typename Map::const_iterator greatest_less(
       Map const& m, typename Map::key_type const& k) {
@@ -199,50 +571,101 @@ class AggregatorServiceHandler : virtual public AggregatorServiceIf {
     return m.end();
   }
 
-  std::vector<QueryServiceClient> qservers_;
-  std::vector<stdcxx::shared_ptr<TTransport>> qserver_transports_;
+  std::shared_ptr<ShardPool> pool_;
+  std::vector<std::shared_ptr<ShardConnection>> conns_;
   std::map<int64_t, size_t> shard_map_;
   std::map<size_t, int64_t> offset_map_;
   uint32_t num_shards_;
+  uint32_t shards_per_server_;
+  int32_t timeout_ms_;
+  ReplyGather::Clock::time_point deadline_;
+  std::vector<bool> missed_shards_;
+  ResultStream stream_;
 };
 
 class HandlerProcessorFactory : public TProcessorFactory {
  public:
-  HandlerProcessorFactory(uint32_t num_shards) {
+  HandlerProcessorFactory(uint32_t num_shards, uint32_t shards_per_server,
+                          int32_t timeout_ms, uint32_t max_idle) {
     num_shards_ = num_shards;
+    shards_per_server_ = shards_per_server;
+    timeout_ms_ = timeout_ms;
+    pool_ = std::make_shared<ShardPool>(
+        num_shards, [shards_per_server](uint32_t shard) {
+          return std::make_shared<ShardConnection>(shard, shards_per_server);
+        },
+        [](ShardConnection& connection) {
+          // Connections closed by a query server, e.g. on a restart, are
+          // readable even though no reply is outstanding on them
+          return connection.transport->isOpen()
+              && ReplyGather::IsQuiet(connection.socket->getSocketFD());
+        }, max_idle);
   }
 
-  stdcxx::shared_ptr<TProcessor> getProcessor(const TConnectionInfo&) {
-    stdcxx::shared_ptr<AggregatorServiceHandler> handler(
-        new AggregatorServiceHandler(num_shards_));
-    stdcxx::shared_ptr<TProcessor> handlerProcessor(
+  std::shared_ptr<TProcessor> getProcessor(const TConnectionInfo&) {
+    std::shared_ptr<AggregatorServiceHandler> handler(
+        new AggregatorServiceHandler(num_shards_, shards_per_server_,
+                                     timeout_ms_, pool_));
+    std::shared_ptr<TProcessor> handlerProcessor(
         new AggregatorServiceProcessor(handler));
     return handlerProcessor;
   }
 
  private:
   uint32_t num_shards_;
+  uint32_t shards_per_server_;
+  int32_t timeout_ms_;
+  std::shared_ptr<ShardPool> pool_;
 };
 
 void print_usage(char *exec) {
-  fprintf(stderr, "Usage: %s [-s num_shards]\n", exec);
+  fprintf(stderr, "Usage: %s [-s num_shards] [-l shards_per_server] "
+          "[-t timeout_ms] [-n] [-w num_workers] [-q max_pending] "
+          "[-i max_idle]\n", exec);
 }
 
 int main(int argc, char **argv) {
-  if (argc < 1 || argc > 3) {
+  if (argc < 1 || argc > 14) {
     print_usage(argv[0]);
     return -1;
   }
 
   int c;
-  uint32_t num_shards = 1;
+  uint32_t num_shards = 1, shards_per_server = 1;
+  int32_t timeout_ms = 0;
+  uint32_t max_idle = ShardPool::kDefaultMaxIdle;
+  ServerOptions server_options;
 
-  while ((c = getopt(argc, argv, "s:")) != -1) {
+  while ((c = getopt(argc, argv, "s:l:t:nw:q:i:")) != -1) {
     switch (c) {
       case 's': {
         num_shards = atoi(optarg);
         break;
       }
+      case 'l': {
+        shards_per_server = std::max(atoi(optarg), 1);
+        break;
+      }
+      case 't': {
+        timeout_ms = atoi(optarg);
+        break;
+      }
+      case 'n': {
+        server_options.mode = POOLED_SERVER;
+        break;
+      }
+      case 'w': {
+        server_options.num_workers = atoi(optarg);
+        break;
+      }
+      case 'q': {
+        server_options.max_pending = atoi(optarg);
+        break;
+      }
+      case 'i': {
+        max_idle = atoi(optarg);
+        break;
+      }
       default: {
         fprintf(stderr, "Error parsing command line arguments.\n");
         return -1;
@@ -253,14 +676,9 @@ int main(int argc, char **argv) {
   int port = AGGREGATOR_PORT;
   try {
     shared_ptr<HandlerProcessorFactory> handlerFactory(
-        new HandlerProcessorFactory(num_shards));
-    shared_ptr<TServerSocket> server_transport(new TServerSocket(port));
-    shared_ptr<TBufferedTransportFactory> transport_factory(
-        new TBufferedTransportFactory());
-    shared_ptr<TProtocolFactory> protocol_factory(new TBinaryProtocolFactory());
-    TThreadedServer server(handlerFactory, server_transport, transport_factory,
-                           protocol_factory);
-    server.serve();
+        new HandlerProcessorFactory(num_shards, shards_per_server,
+                                    timeout_ms, max_idle));
+    Serve(handlerFactory, port, server_options);
   } catch (std::exception& e) {
     fprintf(stderr, "Exception at aggregator.cc:main(): %s\n", e.what());
   }
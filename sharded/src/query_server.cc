@@ -1,6 +1,6 @@
 #include "QueryService.h"
-#include "succinct_constants.h"
 #include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/processor/TMultiplexedProcessor.h>
 #include <thrift/transport/TServerSocket.h>
 #include <thrift/transport/TBufferTransports.h>
 #include <thrift/server/TThreadedServer.h>
@@ -10,23 +10,29 @@
 #include <cstdio>
 #include <fstream>
 #include <cstdint>
+#include <chrono>
+#include <list>
+#include <mutex>
+#include <thread>
 
 #include "succinct_file.h"
 #include "ports.h"
+#include "utils/server_mode.h"
 
 using namespace ::apache::thrift;
 using namespace ::apache::thrift::protocol;
 using namespace ::apache::thrift::transport;
 using namespace ::apache::thrift::server;
 
-using stdcxx::shared_ptr;
+using std::shared_ptr;
 
 class QueryServiceHandler : virtual public QueryServiceIf {
  public:
   QueryServiceHandler(std::string filename, int mode, uint32_t sa_sampling_rate,
                       uint32_t isa_sampling_rate,
                       SamplingScheme sampling_scheme,
-                      NPA::NPAEncodingScheme npa_scheme) {
+                      NPA::NPAEncodingScheme npa_scheme, uint32_t delay_ms,
+                      const PageInConfig& page_in_config) {
     succinct_file_ = NULL;
     mode_ = mode;
     filename_ = filename;
@@ -35,6 +41,8 @@ class QueryServiceHandler : virtual public QueryServiceIf {
     isa_sampling_rate_ = isa_sampling_rate;
     sampling_scheme_ = sampling_scheme;
     npa_scheme_ = npa_scheme;
+    delay_ms_ = delay_ms;
+    page_in_config_ = page_in_config;
   }
 
   int32_t Initialize(int32_t id) {
@@ -60,7 +68,15 @@ class QueryServiceHandler : virtual public QueryServiceIf {
       succinct_file_ = new SuccinctFile(filename_, mode, sa_sampling_rate_,
                                         isa_sampling_rate_, 128,
                                         sampling_scheme_, sampling_scheme_,
-                                        npa_scheme_);
+                                        npa_scheme_, 3, 1024, 1,
+                                        page_in_config_);
+      if (!succinct_file_->IsLoaded()) {
+        fprintf(stderr, "Failed to initialize shard: could not load %s\n",
+                filename_.c_str());
+        delete succinct_file_;
+        succinct_file_ = NULL;
+        return -1;
+      }
       if (mode_ == 0) {
         fprintf(stderr, "Serializing data structures for file %s\n",
                 filename_.c_str());
@@ -71,6 +87,10 @@ class QueryServiceHandler : virtual public QueryServiceIf {
       }
       fprintf(stderr, "Initialized shard with original size = %llu\n",
               succinct_file_->GetOriginalSize());
+      fprintf(stderr, "Huge pages: %zu bytes explicit, %zu bytes transparent, "
+              "%zu fallbacks\n", SuccinctAllocator::HugeTLBBytes(),
+              SuccinctAllocator::TransparentHugePageBytes(),
+              SuccinctAllocator::NumFallbacks());
       is_init_ = true;
       fprintf(stderr, "Waiting for queries...\n");
       return 0;
@@ -82,12 +102,27 @@ class QueryServiceHandler : virtual public QueryServiceIf {
     }
   }
 
-  void Regex(std::set<int64_t> &_return, const std::string &query) {
-    std::set<std::pair<size_t, size_t>> results;
-    succinct_file_->RegexSearch(results, query);
-    for (auto res : results) {
-      _return.insert((int64_t) res.first);
+  void Regex(std::vector<int64_t> &_return, const std::string &query,
+             const int64_t offset, const int64_t limit) {
+    InjectDelay();
+    if (offset <= 0 && limit < 0) {
+      std::vector<int64_t> offsets;
+      RegexOffsets(offsets, query);
+      _return.swap(offsets);
+      return;
+    }
+
+    // Pages of a query are usually read in turn, until a page comes back
+    // short, so its matches are kept until then
+    shared_ptr<std::vector<int64_t>> offsets = LookupRegex(query);
+    if (!offsets) {
+      offsets = shared_ptr<std::vector<int64_t>>(new std::vector<int64_t>);
+      RegexOffsets(*offsets, query);
+      CacheRegex(query, offsets);
     }
+    SortedVector::Page(_return, *offsets, offset, limit);
+    if (limit < 0 || (int64_t) _return.size() < limit)
+      EvictRegex(query);
   }
 
   void Extract(std::string& _return, const int64_t offset,
@@ -96,11 +131,14 @@ class QueryServiceHandler : virtual public QueryServiceIf {
   }
 
   int64_t Count(const std::string& query) {
+    InjectDelay();
     return succinct_file_->Count(query);
   }
 
-  void Search(std::vector<int64_t>& _return, const std::string& query) {
-    succinct_file_->Search(_return, query);
+  void Search(std::vector<int64_t>& _return, const std::string& query,
+              const int64_t offset, const int64_t limit) {
+    InjectDelay();
+    succinct_file_->Search(_return, query, offset, limit);
   }
 
   int64_t GetShardSize() {
@@ -108,6 +146,52 @@ class QueryServiceHandler : virtual public QueryServiceIf {
   }
 
  private:
+  // Hold up a query by the configured delay, to emulate a slow shard
+  void InjectDelay() {
+    if (delay_ms_ > 0)
+      std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms_));
+  }
+
+  // Offsets that match a regex, sorted, one entry per offset
+  void RegexOffsets(std::vector<int64_t> &offsets, const std::string &query) {
+    std::vector<std::pair<size_t, size_t>> results;
+    succinct_file_->RegexSearch(results, query);
+    for (auto res : results) {
+      if (offsets.empty() || offsets.back() != (int64_t) res.first)
+        offsets.push_back((int64_t) res.first);
+    }
+  }
+
+  shared_ptr<std::vector<int64_t>> LookupRegex(const std::string &query) {
+    std::lock_guard<std::mutex> lock(regex_cache_mutex_);
+    for (auto &entry : regex_cache_) {
+      if (entry.first == query)
+        return entry.second;
+    }
+    return shared_ptr<std::vector<int64_t>>();
+  }
+
+  // Cache the matches of query, evicting the oldest entry if full
+  void CacheRegex(const std::string &query,
+                  shared_ptr<std::vector<int64_t>> offsets) {
+    std::lock_guard<std::mutex> lock(regex_cache_mutex_);
+    if (regex_cache_.size() == kRegexCacheSize)
+      regex_cache_.pop_front();
+    regex_cache_.push_back(std::make_pair(query, offsets));
+  }
+
+  void EvictRegex(const std::string &query) {
+    std::lock_guard<std::mutex> lock(regex_cache_mutex_);
+    for (auto it = regex_cache_.begin(); it != regex_cache_.end(); it++) {
+      if (it->first == query) {
+        regex_cache_.erase(it);
+        return;
+      }
+    }
+  }
+
+  static const size_t kRegexCacheSize = 16;
+
   SuccinctFile *succinct_file_;
   int mode_;
   std::string filename_;
@@ -116,6 +200,14 @@ class QueryServiceHandler : virtual public QueryServiceIf {
   uint32_t isa_sampling_rate_;
   SamplingScheme sampling_scheme_;
   NPA::NPAEncodingScheme npa_scheme_;
+  uint32_t delay_ms_;
+  PageInConfig page_in_config_;
+
+  // Matches of recent paged regex queries; the handler serves every
+  // connection, so the cache is shared
+  std::list<std::pair<std::string, shared_ptr<std::vector<int64_t>>>>
+      regex_cache_;
+  std::mutex regex_cache_mutex_;
 };
 
 SamplingScheme SamplingSchemeFromOption(int opt) {
@@ -149,13 +241,13 @@ NPA::NPAEncodingScheme EncodingSchemeFromOption(int opt) {
 void print_usage(char *exec) {
   fprintf(
       stderr,
-      "Usage: %s [-m mode] [-p port] [-s sa_sampling_rate_] [-i isa_sampling_rate_] [-x sampling_scheme_] [-r npa_encoding_scheme] [-o] [file]\n",
+      "Usage: %s [-m mode] [-p port] [-s sa_sampling_rate_] [-i isa_sampling_rate_] [-x sampling_scheme_] [-r npa_encoding_scheme] [-d delay_ms] [-o] [-n] [-w num_workers] [-q max_pending] [-g] [-l page_in_policy] [-b prefetch_mbps] [-N numa_node] [file...]\n",
       exec);
 }
 
 int main(int argc, char **argv) {
 
-  if (argc < 2 || argc > 14) {
+  if (argc < 2) {
     print_usage(argv[0]);
     return -1;
   }
@@ -168,12 +260,14 @@ int main(int argc, char **argv) {
 
   int c;
   uint32_t mode = 0, port = SERVER_PORT, sa_sampling_rate = 32,
-      isa_sampling_rate = 32;
+      isa_sampling_rate = 32, delay_ms = 0;
   SamplingScheme scheme = SamplingScheme::FLAT_SAMPLE_BY_INDEX;
   NPA::NPAEncodingScheme npa_scheme =
       NPA::NPAEncodingScheme::ELIAS_GAMMA_ENCODED;
+  ServerOptions server_options;
+  PageInConfig page_in_config;
 
-  while ((c = getopt(argc, argv, "m:p:s:i:r:x:")) != -1) {
+  while ((c = getopt(argc, argv, "m:p:s:i:r:x:d:nw:q:gl:b:N:")) != -1) {
     switch (c) {
       case 'm':
         mode = atoi(optarg);
@@ -193,6 +287,33 @@ int main(int argc, char **argv) {
       case 'r':
         npa_scheme = EncodingSchemeFromOption(atoi(optarg));
         break;
+      case 'd':
+        delay_ms = atoi(optarg);
+        break;
+      case 'n':
+        server_options.mode = POOLED_SERVER;
+        break;
+      case 'w':
+        server_options.num_workers = atoi(optarg);
+        break;
+      case 'q':
+        server_options.max_pending = atoi(optarg);
+        break;
+      case 'g':
+        SuccinctAllocator::UseHugePagesByDefault(true);
+        break;
+      case 'l':
+        if (!PageInConfig::Parse(optarg, &page_in_config)) {
+          fprintf(stderr, "Invalid page-in policy %s.\n", optarg);
+          return -1;
+        }
+        break;
+      case 'b':
+        page_in_config.prefetch_rate = atoll(optarg) * 1024 * 1024;
+        break;
+      case 'N':
+        page_in_config.numa_node = atoi(optarg);
+        break;
       default:
         fprintf(stderr, "Error parsing command line arguments.\n");
     }
@@ -203,21 +324,34 @@ int main(int argc, char **argv) {
     return -1;
   }
 
-  std::string filename = std::string(argv[optind]);
+  // Threads created from here on, including those handling requests, run on
+  // the cores of the node and allocate from its memory; the shards are
+  // placed on it as they are loaded
+  if (page_in_config.numa_node >= 0) {
+    if (!NumaUtils::BindThread(page_in_config.numa_node)) {
+      fprintf(stderr, "Could not bind to NUMA node %d.\n",
+              page_in_config.numa_node);
+      return -1;
+    }
+    fprintf(stderr, "Bound to NUMA node %d.\n", page_in_config.numa_node);
+  }
 
-  shared_ptr<QueryServiceHandler> handler(
-      new QueryServiceHandler(filename, mode, sa_sampling_rate,
-                              isa_sampling_rate, scheme, npa_scheme));
-  shared_ptr<TProcessor> processor(new QueryServiceProcessor(handler));
+  // Each file is a shard, served under its index among the files
+  shared_ptr<TMultiplexedProcessor> processor(new TMultiplexedProcessor());
+  for (int i = optind; i < argc; i++) {
+    shared_ptr<QueryServiceHandler> handler(
+        new QueryServiceHandler(argv[i], mode, sa_sampling_rate,
+                                isa_sampling_rate, scheme, npa_scheme,
+                                delay_ms, page_in_config));
+    processor->registerProcessor(
+        std::to_string(i - optind),
+        shared_ptr<TProcessor>(new QueryServiceProcessor(handler)));
+  }
 
   try {
-    shared_ptr<TServerSocket> server_transport(new TServerSocket(port));
-    shared_ptr<TBufferedTransportFactory> transport_factory(
-        new TBufferedTransportFactory());
-    shared_ptr<TProtocolFactory> protocol_factory(new TBinaryProtocolFactory());
-    TThreadedServer server(processor, server_transport, transport_factory,
-                           protocol_factory);
-    server.serve();
+    shared_ptr<TProcessorFactory> processor_factory(
+        new TSingletonProcessorFactory(processor));
+    Serve(processor_factory, port, server_options);
   } catch (std::exception& e) {
     fprintf(stderr, "Exception at query_server.cc:main(): %s\n", e.what());
   }
@@ -1,17 +0,0 @@
-/**
- * Autogenerated by Thrift Compiler (0.12.0)
- *
- * DO NOT EDIT UNLESS YOU ARE SURE THAT YOU KNOW WHAT YOU ARE DOING
- *  @generated
- */
-#include "succinct_constants.h"
-
-
-
-const succinctConstants g_succinct_constants;
-
-succinctConstants::succinctConstants() {
-}
-
-
-
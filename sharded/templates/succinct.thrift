@@ -3,22 +3,57 @@ service AggregatorService {
     i32 DisconnectFromServers(),
     i32 Initialize(),
 
-    set<i64> Regex(1:string query),
+    /**
+     * Offsets of the matches of query, a page of up to limit matches after
+     * skipping offset of them; a negative limit gets all of the remaining
+     * matches. Every page computes all of the matches on each shard, and
+     * only the page is returned; servers cache the matches of recent
+     * queries, but a page that misses the cache costs as much as getting
+     * every match.
+     */
+    list<i64> Regex(1:string query, 2:i64 offset = 0, 3:i64 limit = -1),
     string Extract(1:i64 offset, 2:i64 length),
     i64 Count(1:string query),
-    list<i64> Search(1:string query),
+    /**
+     * Keys whose values contain query, a page of up to limit keys after
+     * skipping offset of them; a negative limit gets all of the remaining
+     * keys. Each shard walks every occurrence of query up to its page, the
+     * skipped ones included, so a page costs more the deeper it is; the
+     * walk is bounded by looking up every occurrence in the suffix array.
+     */
+    list<i64> Search(1:string query, 2:i64 offset = 0, 3:i64 limit = -1),
 
     i32 GetNumShards(),
+    /**
+     * Number of shards left out of the result of the last query on this
+     * connection, because they were unreachable or missed the deadline
+     */
+    i32 GetNumMissedShards(),
     i64 GetTotSize(),
 }
 
 service QueryService {
     i32 Initialize(1:i32 id),
     
-    set<i64> Regex(1:string query),
+    /**
+     * Offsets of the matches of query, a page of up to limit matches after
+     * skipping offset of them; a negative limit gets all of the remaining
+     * matches. Every page computes all of the matches on each shard, and
+     * only the page is returned; servers cache the matches of recent
+     * queries, but a page that misses the cache costs as much as getting
+     * every match.
+     */
+    list<i64> Regex(1:string query, 2:i64 offset = 0, 3:i64 limit = -1),
     string Extract(1:i64 offset, 2:i64 length),
     i64 Count(1:string query),
-    list<i64> Search(1:string query), 
+    /**
+     * Keys whose values contain query, a page of up to limit keys after
+     * skipping offset of them; a negative limit gets all of the remaining
+     * keys. Each shard walks every occurrence of query up to its page, the
+     * skipped ones included, so a page costs more the deeper it is; the
+     * walk is bounded by looking up every occurrence in the suffix array.
+     */
+    list<i64> Search(1:string query, 2:i64 offset = 0, 3:i64 limit = -1), 
     
     i64 GetShardSize(),
 }
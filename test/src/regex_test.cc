@@ -0,0 +1,136 @@
+#include "succinct_file.h"
+
+#include "gtest/gtest.h"
+
+#include <fstream>
+#include <iterator>
+
+extern std::string data_path;
+
+class RegExTest : public testing::Test {
+ protected:
+  typedef std::pair<size_t, size_t> OffsetLength;
+  typedef std::vector<OffsetLength> Results;
+
+  virtual void SetUp() {
+    s_file = new SuccinctFile(data_path + "/test_file");
+
+    std::ifstream input(data_path + "/test_file");
+    text.assign(std::istreambuf_iterator<char>(input),
+                std::istreambuf_iterator<char>());
+  }
+
+  virtual void TearDown() {
+    delete s_file;
+  }
+
+  Results Query(const std::string &query, bool opt) {
+    Results results;
+    SRegEx re(query, s_file, opt);
+    re.Execute();
+    re.GetResults(results);
+    return results;
+  }
+
+  // Matches of a pattern of literal characters and [...] classes, found by
+  // scanning the text
+  Results Scan(const std::string &pattern) {
+    std::vector<std::string> classes;
+    for (size_t i = 0; i < pattern.length(); i++) {
+      if (pattern[i] != '[') {
+        classes.push_back(std::string(1, pattern[i]));
+        continue;
+      }
+      std::string chars;
+      for (i++; pattern[i] != ']'; i++) {
+        if (pattern[i] == '-') {
+          for (char c = pattern[i - 1] + 1; c <= pattern[i + 1]; c++)
+            chars += c;
+          i++;
+        } else {
+          chars += pattern[i];
+        }
+      }
+      classes.push_back(chars);
+    }
+
+    Results results;
+    for (size_t i = 0; i + classes.size() <= text.length(); i++) {
+      size_t k = 0;
+      while (k < classes.size()
+          && classes[k].find(text[i + k]) != std::string::npos)
+        k++;
+      if (k == classes.size())
+        results.push_back(OffsetLength(i, classes.size()));
+    }
+    return results;
+  }
+
+  // Matches of left followed, after any gap, by a match of right
+  Results Wildcard(const Results &left, const Results &right) {
+    Results results;
+    for (auto l : left) {
+      for (auto r : right) {
+        if (r.first >= l.first + l.second)
+          results.push_back(OffsetLength(l.first,
+                                         r.first + r.second - l.first));
+      }
+    }
+    SortedVector::SortUnique(results);
+    return results;
+  }
+
+  Results Union(const Results &a, const Results &b) {
+    Results results;
+    SortedVector::Union(results, a, b);
+    return results;
+  }
+
+  SuccinctFile *s_file;
+  std::string text;
+};
+
+TEST_F(RegExTest, MgramTest) {
+  Results expected = Scan("return");
+  ASSERT_FALSE(expected.empty());
+  ASSERT_EQ(expected, Query("return", true));
+  ASSERT_EQ(expected, Query("return", false));
+}
+
+TEST_F(RegExTest, ConcatTest) {
+  // A range after an m-gram runs forward, and one before it backward
+  const char *queries[] = { "in[gt]", "re[a-z]", "[gt]he", "[A-Z]AX",
+      "i[a-z]t" };
+  for (auto query : queries) {
+    Results expected = Scan(query);
+    ASSERT_FALSE(expected.empty()) << query;
+    ASSERT_EQ(expected, Query(query, true)) << query;
+  }
+
+  // The partial scan joins the m-grams and ranges in turn
+  const char *scanned[] = { "in[gt]", "re[a-z]" };
+  for (auto query : scanned) {
+    ASSERT_EQ(Scan(query), Query(query, false)) << query;
+  }
+}
+
+TEST_F(RegExTest, UnionTest) {
+  Results expected = Union(Scan("int "), Scan("char "));
+  ASSERT_FALSE(expected.empty());
+  ASSERT_EQ(expected, Query("(int|char) ", true));
+}
+
+TEST_F(RegExTest, WildcardTest) {
+  Results expected = Wildcard(Scan("define"), Scan("MIN"));
+  ASSERT_FALSE(expected.empty());
+  ASSERT_EQ(expected, Query("define.*MIN", true));
+  ASSERT_EQ(expected, Query("define.*MIN", false));
+
+  expected = Wildcard(Wildcard(Scan("MAX"), Scan("[A-Z]IN")), Scan("0x"));
+  ASSERT_FALSE(expected.empty());
+  ASSERT_EQ(expected, Query("MAX.*[A-Z]IN.*0x", true));
+
+  // Every match of the right side after each match of the left side
+  ASSERT_EQ(Wildcard(Scan("int"), Scan("return")),
+            Query("int.*return", true));
+}
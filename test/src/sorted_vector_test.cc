@@ -0,0 +1,110 @@
+#include "utils/sorted_vector.h"
+
+#include "gtest/gtest.h"
+
+#include <random>
+#include <set>
+
+class SortedVectorTest : public testing::Test {
+ protected:
+  // n random values below max
+  std::vector<int64_t> RandomValues(size_t n, int64_t max) {
+    std::uniform_int_distribution<int64_t> value(0, max - 1);
+    std::vector<int64_t> values(n);
+    for (size_t i = 0; i < n; i++) {
+      values[i] = value(rng);
+    }
+    return values;
+  }
+
+  std::mt19937_64 rng;
+};
+
+TEST_F(SortedVectorTest, RadixSortTest) {
+  // Below the radix sort threshold, and above it with one, two and four
+  // 16-bit digits
+  size_t sizes[] = { 100, 100000 };
+  int64_t maxes[] = { 1000, 1LL << 16, 1LL << 20, 1LL << 40, INT64_MAX };
+  for (auto n : sizes) {
+    for (auto max : maxes) {
+      std::vector<int64_t> values = RandomValues(n, max);
+      std::vector<int64_t> expected = values;
+      std::sort(expected.begin(), expected.end());
+      SortedVector::RadixSort(values);
+      ASSERT_EQ(expected, values);
+    }
+  }
+
+  std::vector<int64_t> empty;
+  SortedVector::RadixSort(empty);
+  ASSERT_TRUE(empty.empty());
+
+  std::vector<int64_t> zeros(10000, 0);
+  SortedVector::RadixSort(zeros);
+  ASSERT_EQ(std::vector<int64_t>(10000, 0), zeros);
+}
+
+TEST_F(SortedVectorTest, SortUniqueTest) {
+  std::vector<int64_t> values = RandomValues(50000, 1000);
+  std::set<int64_t> expected(values.begin(), values.end());
+  SortedVector::SortUnique(values);
+  ASSERT_EQ(std::vector<int64_t>(expected.begin(), expected.end()), values);
+
+  typedef std::pair<size_t, size_t> OffsetLength;
+  std::vector<OffsetLength> pairs = { { 3, 1 }, { 1, 2 }, { 3, 1 }, { 1, 1 } };
+  SortedVector::SortUnique(pairs);
+  std::vector<OffsetLength> expected_pairs = { { 1, 1 }, { 1, 2 }, { 3, 1 } };
+  ASSERT_EQ(expected_pairs, pairs);
+}
+
+TEST_F(SortedVectorTest, MultiwayUnionTest) {
+  // Inputs overlap with each other, and some are empty
+  std::vector<std::vector<int64_t>> inputs(8);
+  std::set<int64_t> expected;
+  for (size_t k = 0; k < inputs.size(); k += 2) {
+    inputs[k] = RandomValues(1000 * (k + 1), 5000);
+    SortedVector::SortUnique(inputs[k]);
+    expected.insert(inputs[k].begin(), inputs[k].end());
+  }
+
+  std::vector<int64_t> out = { -1 };
+  SortedVector::MultiwayUnion(out, inputs);
+  std::vector<int64_t> expected_out = { -1 };
+  expected_out.insert(expected_out.end(), expected.begin(), expected.end());
+  ASSERT_EQ(expected_out, out);
+
+  // Same with a comparator, in decreasing order
+  for (auto &input : inputs) {
+    std::reverse(input.begin(), input.end());
+  }
+  std::vector<int64_t> reversed;
+  SortedVector::MultiwayUnion(reversed, inputs, std::greater<int64_t>());
+  ASSERT_EQ(std::vector<int64_t>(expected.rbegin(), expected.rend()),
+            reversed);
+
+  std::vector<int64_t> none;
+  SortedVector::MultiwayUnion(none, std::vector<std::vector<int64_t>>(3));
+  ASSERT_TRUE(none.empty());
+}
+
+TEST_F(SortedVectorTest, UnionAndPageTest) {
+  std::vector<int64_t> a = { 1, 3, 5, 7 };
+  std::vector<int64_t> b = { 2, 3, 6, 7, 9 };
+  std::vector<int64_t> expected = { 1, 2, 3, 5, 6, 7, 9 };
+
+  std::vector<int64_t> out;
+  SortedVector::Union(out, a, b);
+  ASSERT_EQ(expected, out);
+  SortedVector::UnionInto(a, b);
+  ASSERT_EQ(expected, a);
+
+  std::vector<int64_t> page;
+  SortedVector::Page(page, expected, 2, 3);
+  ASSERT_EQ(std::vector<int64_t>({ 3, 5, 6 }), page);
+  page.clear();
+  SortedVector::Page(page, expected, 5, -1);
+  ASSERT_EQ(std::vector<int64_t>({ 7, 9 }), page);
+  page.clear();
+  SortedVector::Page(page, expected, 10, 2);
+  ASSERT_TRUE(page.empty());
+}
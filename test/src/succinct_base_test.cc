@@ -0,0 +1,257 @@
+#include "succinct_base.h"
+#include "utils/packed_array.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+class SuccinctBaseTest : public testing::Test {
+ protected:
+  virtual void SetUp() {
+    s_base = new SuccinctBase();
+  }
+
+  virtual void TearDown() {
+    delete s_base;
+  }
+
+  // Generate a sorted array with n values, with gaps in [0, max_gap]
+  std::vector<uint64_t> GenerateSortedArray(uint64_t n, uint64_t max_gap) {
+    std::vector<uint64_t> values;
+    uint64_t val = 0;
+    for (uint64_t i = 0; i < n; i++) {
+      val += (max_gap == 0) ? 1 : rand() % (max_gap + 1);
+      values.push_back(val);
+    }
+    return values;
+  }
+
+  // Generate a random bitmap with roughly the given percentage of bits set
+  SuccinctBase::Bitmap *GenerateBitmap(uint64_t size, uint32_t percent_set) {
+    SuccinctBase::Bitmap *B = new SuccinctBase::Bitmap;
+    SuccinctBase::InitBitmap(&B, size, s_allocator);
+    for (uint64_t i = 0; i < size; i++) {
+      if ((uint32_t) (rand() % 100) < percent_set) {
+        SETBITVAL(B, i);
+      }
+    }
+    return B;
+  }
+
+  void CheckDictionary(SuccinctBase::Dictionary *D, SuccinctBase::Bitmap *B) {
+    uint64_t ones = 0, zeros = 0;
+    for (uint64_t i = 0; i < B->size; i++) {
+      if (ACCESSBIT(B, i)) {
+        ASSERT_EQ(i, SuccinctBase::GetSelect1(D, ones));
+        ones++;
+      } else {
+        ASSERT_EQ(i, SuccinctBase::GetSelect0(D, zeros));
+        zeros++;
+      }
+      ASSERT_EQ(ones, SuccinctBase::GetRank1(D, i));
+      ASSERT_EQ(zeros, SuccinctBase::GetRank0(D, i));
+    }
+  }
+
+  void CheckEliasFanoVector(SuccinctBase::EliasFanoVector *E,
+                            std::vector<uint64_t> &values) {
+    ASSERT_EQ(values.size(), E->size);
+    for (uint64_t i = 0; i < values.size(); i++) {
+      ASSERT_EQ(values[i], SuccinctBase::LookupEliasFanoVector(E, i));
+    }
+
+    uint64_t max_val = values.empty() ? 0 : values.back();
+    for (uint64_t val = 0; val <= max_val + 2; val++) {
+      int64_t expected = std::upper_bound(values.begin(), values.end(), val)
+          - values.begin() - 1;
+      ASSERT_EQ(expected, SuccinctBase::GetPredecessor(E, val));
+    }
+  }
+
+  SuccinctBase *s_base;
+  SuccinctAllocator s_allocator;
+};
+
+TEST_F(SuccinctBaseTest, DictionaryTest) {
+  uint64_t sizes[] = { 1, 63, 512, 1000, 70000 };
+  uint32_t percents[] = { 0, 1, 50, 99, 100 };
+  SuccinctBase::DictionaryType types[] = {
+      SuccinctBase::DictionaryType::CLASS_OFFSET_ENCODED,
+      SuccinctBase::DictionaryType::RANK9 };
+  for (uint64_t size : sizes) {
+    for (uint32_t percent : percents) {
+      SuccinctBase::Bitmap *B = GenerateBitmap(size, percent);
+      for (SuccinctBase::DictionaryType type : types) {
+        SuccinctBase::Dictionary D;
+        SuccinctBase::CreateDictionary(B, &D, s_allocator, type);
+        CheckDictionary(&D, B);
+      }
+      SuccinctBase::DestroyBitmap(&B, s_allocator);
+    }
+  }
+}
+
+TEST_F(SuccinctBaseTest, DictionarySerializeTest) {
+  SuccinctBase::Bitmap *B = GenerateBitmap(70000, 30);
+  SuccinctBase::DictionaryType types[] = {
+      SuccinctBase::DictionaryType::CLASS_OFFSET_ENCODED,
+      SuccinctBase::DictionaryType::RANK9 };
+  for (SuccinctBase::DictionaryType type : types) {
+    SuccinctBase::Dictionary D;
+    SuccinctBase::CreateDictionary(B, &D, s_allocator, type);
+
+    std::stringstream stream;
+    SuccinctBase::SerializeDictionary(&D, stream);
+    std::string serialized = stream.str();
+    ASSERT_EQ(SuccinctBase::DictionarySize(&D), serialized.size());
+
+    SuccinctBase::Dictionary D_in;
+    SuccinctBase::DeserializeDictionary(&D_in, stream);
+    ASSERT_EQ(type, D_in.type);
+    CheckDictionary(&D_in, B);
+
+    std::vector<uint64_t> buf(BITS2BLOCKS(serialized.size() * 8));
+    memcpy(&buf[0], serialized.data(), serialized.size());
+    SuccinctBase::Dictionary *D_mapped;
+    ASSERT_EQ(serialized.size(),
+              SuccinctBase::MemoryMapDictionary(&D_mapped,
+                                                (uint8_t *) &buf[0]));
+    ASSERT_EQ(type, D_mapped->type);
+    CheckDictionary(D_mapped, B);
+  }
+  SuccinctBase::DestroyBitmap(&B, s_allocator);
+}
+
+TEST_F(SuccinctBaseTest, SelectInWordTest) {
+  auto random_word = []() {
+    return ((uint64_t) rand() << 42) ^ ((uint64_t) rand() << 21) ^ rand();
+  };
+  for (uint64_t t = 0; t < 10000; t++) {
+    // Single-bit, sparse, and dense words
+    uint64_t word = random_word();
+    if (t < 64)
+      word = 1ULL << t;
+    else if (t % 3 == 1)
+      word &= random_word();
+    else if (t % 3 == 2)
+      word |= random_word();
+    uint64_t r = 0;
+    for (uint32_t pos = 0; pos < 64; pos++) {
+      if ((word >> (63 - pos)) & 1) {
+        ASSERT_EQ(pos, SuccinctUtils::SelectInWord(word, r));
+        r++;
+      }
+    }
+  }
+  ASSERT_EQ(63U, SuccinctUtils::SelectInWord(~0ULL, 63));
+}
+
+TEST_F(SuccinctBaseTest, PackedArrayTest) {
+  // Not a multiple of four, so batch lookups also run their scalar tail
+  uint64_t n = 1003;
+  std::vector<uint64_t> idx(n);
+  for (uint64_t i = 0; i < n; i++) {
+    idx[i] = (i * 7919) % n;
+  }
+
+  for (uint32_t bits = 0; bits <= 64; bits++) {
+    std::vector<uint64_t> values(n);
+    for (uint64_t i = 0; i < n; i++) {
+      uint64_t val = ((uint64_t) rand() << 32) ^ rand();
+      values[i] = (bits == 0) ? 0 : val >> (64 - bits);
+    }
+    SuccinctBase::Bitmap *B = new SuccinctBase::Bitmap;
+    SuccinctBase::CreateBitmapArray(&B, &values[0], n, bits, s_allocator);
+
+    PackedArrayReader reader;
+    reader.Reset((B == nullptr) ? nullptr : B->bitmap, bits);
+    for (uint64_t i = 0; i < n; i++) {
+      ASSERT_EQ(values[i], reader[i]);
+    }
+
+    std::vector<uint64_t> out(n);
+    reader.LookupBatch(&idx[0], &out[0], n);
+    for (uint64_t i = 0; i < n; i++) {
+      ASSERT_EQ(values[idx[i]], out[i]);
+    }
+
+    if (B != nullptr) {
+      SuccinctBase::DestroyBitmap(&B, s_allocator);
+    }
+  }
+}
+
+TEST_F(SuccinctBaseTest, EliasFanoVectorTest) {
+  uint64_t max_gaps[] = { 0, 1, 3, 100 };
+  for (uint64_t max_gap : max_gaps) {
+    std::vector<uint64_t> values = GenerateSortedArray(5000, max_gap);
+    SuccinctBase::EliasFanoVector E;
+    SuccinctBase::CreateEliasFanoVector(&E, &values[0], values.size(),
+                                        s_allocator);
+    CheckEliasFanoVector(&E, values);
+  }
+
+  std::vector<uint64_t> empty;
+  SuccinctBase::EliasFanoVector E;
+  SuccinctBase::CreateEliasFanoVector(&E, nullptr, 0, s_allocator);
+  CheckEliasFanoVector(&E, empty);
+}
+
+TEST_F(SuccinctBaseTest, EliasFanoVectorSerializeTest) {
+  std::vector<uint64_t> values = GenerateSortedArray(5000, 10);
+  SuccinctBase::EliasFanoVector E;
+  SuccinctBase::CreateEliasFanoVector(&E, &values[0], values.size(),
+                                      s_allocator);
+
+  std::stringstream stream;
+  size_t out_size = SuccinctBase::SerializeEliasFanoVector(&E, stream);
+  std::string serialized = stream.str();
+
+  SuccinctBase::EliasFanoVector E_in;
+  ASSERT_EQ(out_size, SuccinctBase::DeserializeEliasFanoVector(&E_in, stream));
+  CheckEliasFanoVector(&E_in, values);
+
+  std::vector<uint64_t> buf(BITS2BLOCKS(serialized.size() * 8));
+  memcpy(&buf[0], serialized.data(), serialized.size());
+  SuccinctBase::EliasFanoVector *E_mapped;
+  ASSERT_EQ(serialized.size(),
+            SuccinctBase::MemoryMapEliasFanoVector(&E_mapped,
+                                                   (uint8_t *) &buf[0]));
+  CheckEliasFanoVector(E_mapped, values);
+}
+
+TEST_F(SuccinctBaseTest, HugePageBitmapTest) {
+  SuccinctAllocator huge_allocator(true);
+  size_t mapped = SuccinctAllocator::HugeTLBBytes()
+      + SuccinctAllocator::TransparentHugePageBytes();
+
+  // Large enough to be mapped on huge pages, unless the system has none
+  uint64_t n = SuccinctAllocator::kHugePageSize / 2, bits = 33;
+  std::vector<uint64_t> values(n);
+  for (uint64_t i = 0; i < n; i++) {
+    values[i] = rand() % (1ULL << bits);
+  }
+  SuccinctBase::Bitmap *B = new SuccinctBase::Bitmap;
+  SuccinctBase::CreateBitmapArray(&B, &values[0], n, bits, huge_allocator);
+  ASSERT_TRUE(SuccinctAllocator::NumFallbacks() > 0
+              || SuccinctAllocator::HugeTLBBytes()
+                  + SuccinctAllocator::TransparentHugePageBytes() > mapped);
+  for (uint64_t i = 0; i < n; i++) {
+    ASSERT_EQ(values[i], SuccinctBase::LookupBitmapArray(B, i, bits));
+  }
+
+  // Growing the block keeps its contents
+  uint64_t words = BITS2BLOCKS(n * bits);
+  B->bitmap = (uint64_t *) huge_allocator.s_realloc(
+      B->bitmap, 2 * words * sizeof(uint64_t));
+  for (uint64_t i = 0; i < n; i++) {
+    ASSERT_EQ(values[i], SuccinctBase::LookupBitmapArray(B, i, bits));
+  }
+
+  SuccinctBase::DestroyBitmap(&B, huge_allocator);
+  ASSERT_EQ(mapped, SuccinctAllocator::HugeTLBBytes()
+      + SuccinctAllocator::TransparentHugePageBytes());
+}
@@ -2,6 +2,8 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <fstream>
 #include <iostream>
 #include <unistd.h>
 #define GetCurrentDir getcwd
@@ -65,3 +67,249 @@ TEST_F(SuccinctCoreTest, LookupISATest) {
     ASSERT_EQ(ISA[i], s_core->LookupISA(i));
   }
 }
+
+TEST_F(SuccinctCoreTest, LookupBatchTest) {
+  std::vector<uint64_t> NPA = LoadArrayFromFile(data_path + "/test_file.npa");
+  std::vector<uint64_t> SA = LoadArrayFromFile(data_path + "/test_file.sa");
+  std::vector<uint64_t> ISA = LoadArrayFromFile(data_path + "/test_file.isa");
+
+  std::vector<uint64_t> idx(NPA.size()), out(NPA.size());
+  for (uint64_t i = 0; i < idx.size(); i++) {
+    idx[i] = (i * 7919) % idx.size();
+  }
+
+  s_core->LookupNPABatch(&idx[0], &out[0], idx.size());
+  for (uint64_t i = 0; i < idx.size(); i++) {
+    ASSERT_EQ(NPA[idx[i]], out[i]);
+  }
+
+  s_core->LookupSABatch(&idx[0], &out[0], idx.size());
+  for (uint64_t i = 0; i < idx.size(); i++) {
+    ASSERT_EQ(SA[idx[i]], out[i]);
+  }
+
+  s_core->LookupISABatch(&idx[0], &out[0], idx.size());
+  for (uint64_t i = 0; i < idx.size(); i++) {
+    ASSERT_EQ(ISA[idx[i]], out[i]);
+  }
+}
+
+TEST_F(SuccinctCoreTest, SampleByValueTest) {
+  std::vector<uint64_t> SA = LoadArrayFromFile(data_path + "/test_file.sa");
+  std::vector<uint64_t> ISA = LoadArrayFromFile(data_path + "/test_file.isa");
+
+  SuccinctCore core(data_path + "/test_file", SuccinctMode::CONSTRUCT_IN_MEMORY,
+                    32, 32, 128, 3, SamplingScheme::FLAT_SAMPLE_BY_VALUE,
+                    SamplingScheme::FLAT_SAMPLE_BY_VALUE);
+
+  for (uint64_t i = 0; i < SA.size(); i++) {
+    ASSERT_EQ(SA[i], core.LookupSA(i));
+    ASSERT_EQ(ISA[i], core.LookupISA(i));
+  }
+}
+
+TEST_F(SuccinctCoreTest, LookupCTest) {
+  std::ifstream input(data_path + "/test_file");
+  std::string data((std::istreambuf_iterator<char>(input)),
+                   std::istreambuf_iterator<char>());
+
+  NPA *npa = s_core->GetNPA();
+  for (uint64_t i = 0; i < npa->GetSize(); i++) {
+    ASSERT_EQ(SuccinctBase::GetRank1(&npa->col_offsets_, i) - 1,
+              s_core->LookupC(i));
+  }
+
+  for (uint64_t i = 0; i < data.length(); i++) {
+    ASSERT_EQ(data[i], s_core->CharAt(i));
+  }
+}
+
+TEST_F(SuccinctCoreTest, ColumnRangeTest) {
+  // Bytes at and above 128 index the alphabet map as unsigned
+  std::string data = "caf\xc3\xa9 na\xc3\xafve \xff\xfe caf\xc3\xa9\n";
+  std::string path = "core_column_range_test";
+  std::ofstream(path).write(data.c_str(), data.length());
+  SuccinctCore core(path);
+
+  // Byte 1 ends the input
+  for (uint32_t c = 2; c < SuccinctCore::kAlphabetMapSize; c++) {
+    int64_t expected = std::count(data.begin(), data.end(), (char) c);
+    SuccinctCore::Range range = core.GetColumnRange((char) c);
+    ASSERT_EQ(expected, range.second - range.first + 1);
+  }
+
+  SuccinctCore::Range range = core.BwdSearch("f\xc3\xa9");
+  ASSERT_EQ(2, range.second - range.first + 1);
+  range = core.BwdSearch("\xff\xfe");
+  ASSERT_EQ(1, range.second - range.first + 1);
+  range = core.BwdSearch("\xfe\xff");
+  ASSERT_GT(range.first, range.second);
+  range = core.BwdSearch("z\xc3");
+  ASSERT_GT(range.first, range.second);
+}
+
+TEST_F(SuccinctCoreTest, BinarySearchRangeTest) {
+  std::vector<uint64_t> npa_vals = LoadArrayFromFile(data_path + "/test_file.npa");
+
+  NPA *npa = s_core->GetNPA();
+  std::vector<uint64_t> &col_offsets = npa->col_offsets_;
+  for (uint64_t c = 0; c < col_offsets.size(); c++) {
+    uint64_t col_end = (c + 1 < col_offsets.size()) ?
+        col_offsets[c + 1] : npa_vals.size();
+    for (uint64_t s = col_offsets[c]; s < col_end; s += 97) {
+      for (uint64_t l = 0; l < npa_vals.size(); l += 389) {
+        for (uint64_t r = l; r < npa_vals.size(); r += 1031) {
+          // NPA values are sorted within a column
+          int64_t left = std::lower_bound(npa_vals.begin() + s,
+                                          npa_vals.begin() + col_end, l)
+              - npa_vals.begin();
+          int64_t right = std::upper_bound(npa_vals.begin() + left,
+                                           npa_vals.begin() + col_end, r)
+              - npa_vals.begin() - 1;
+          std::pair<int64_t, int64_t> range = npa->BinarySearchRange(
+              std::pair<int64_t, int64_t>(l, r), s, col_end - 1);
+          ASSERT_EQ(left, range.first);
+          ASSERT_EQ(right, range.second);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(SuccinctCoreTest, ParallelConstructTest) {
+  std::vector<uint64_t> NPA = LoadArrayFromFile(data_path + "/test_file.npa");
+  std::vector<uint64_t> SA = LoadArrayFromFile(data_path + "/test_file.sa");
+  std::vector<uint64_t> ISA = LoadArrayFromFile(data_path + "/test_file.isa");
+
+  SuccinctCore core(data_path + "/test_file", SuccinctMode::CONSTRUCT_IN_MEMORY,
+                    32, 32, 128, 3, SamplingScheme::FLAT_SAMPLE_BY_INDEX,
+                    SamplingScheme::FLAT_SAMPLE_BY_INDEX,
+                    NPA::NPAEncodingScheme::ELIAS_GAMMA_ENCODED, 1024, 4);
+
+  for (uint64_t i = 0; i < SA.size(); i++) {
+    ASSERT_EQ(NPA[i], core.LookupNPA(i));
+    ASSERT_EQ(SA[i], core.LookupSA(i));
+    ASSERT_EQ(ISA[i], core.LookupISA(i));
+  }
+}
+
+TEST_F(SuccinctCoreTest, MemoryMappedConstructTest) {
+  std::vector<uint64_t> NPA = LoadArrayFromFile(data_path + "/test_file.npa");
+  std::vector<uint64_t> SA = LoadArrayFromFile(data_path + "/test_file.sa");
+  std::vector<uint64_t> ISA = LoadArrayFromFile(data_path + "/test_file.isa");
+
+  SuccinctCore core(data_path + "/test_file",
+                    SuccinctMode::CONSTRUCT_MEMORY_MAPPED);
+
+  for (uint64_t i = 0; i < SA.size(); i++) {
+    ASSERT_EQ(NPA[i], core.LookupNPA(i));
+    ASSERT_EQ(SA[i], core.LookupSA(i));
+    ASSERT_EQ(ISA[i], core.LookupISA(i));
+  }
+}
+
+TEST_F(SuccinctCoreTest, ExtractCharsTest) {
+  std::ifstream input(data_path + "/test_file");
+  std::string data((std::istreambuf_iterator<char>(input)),
+                   std::istreambuf_iterator<char>());
+
+  NPA::NPAEncodingScheme schemes[] = {
+      NPA::NPAEncodingScheme::ELIAS_GAMMA_ENCODED,
+      NPA::NPAEncodingScheme::ELIAS_DELTA_ENCODED };
+  for (auto scheme : schemes) {
+    SuccinctCore core(data_path + "/test_file",
+                      SuccinctMode::CONSTRUCT_IN_MEMORY, 32, 32, 128, 3,
+                      SamplingScheme::FLAT_SAMPLE_BY_INDEX,
+                      SamplingScheme::FLAT_SAMPLE_BY_INDEX, scheme);
+
+    std::string out(data.length(), '\0');
+    uint64_t idx = core.ExtractChars(core.LookupISA(0), data.length(), &out[0]);
+    ASSERT_EQ(data, out);
+    ASSERT_EQ(core.LookupISA(data.length() - 1), idx);
+
+    for (uint64_t offset = 0; offset < data.length(); offset += 101) {
+      uint64_t len = std::min<uint64_t>(data.length() - offset, offset % 300);
+      std::string chunk(len, '\0');
+      core.ExtractChars(core.LookupISA(offset), len, &chunk[0]);
+      ASSERT_EQ(data.substr(offset, len), chunk);
+    }
+  }
+}
+
+TEST(ParallelSuffixSortTest, MatchesDivSufSortTest) {
+  std::vector<std::string> texts;
+  texts.push_back("a");
+  texts.push_back(std::string(5000, 'a'));
+  std::string periodic, random;
+  for (uint32_t i = 0; i < 5000; i++) {
+    periodic += "abcab"[i % 5];
+    random += (char) ('a' + (i * 2654435761U >> 13) % 3);
+  }
+  texts.push_back(periodic);
+  texts.push_back(random);
+
+  // Texts whose largest buckets are sorted by all threads
+  texts.push_back(std::string(100000, 'a'));
+  std::string long_periodic;
+  for (uint32_t i = 0; i < 100000; i++) {
+    long_periodic += "abcab"[i % 5];
+  }
+  texts.push_back(long_periodic);
+
+  for (auto &text : texts) {
+    const uint8_t *data = (const uint8_t *) text.data();
+    int64_t n = text.length();
+    std::vector<int64_t> expected(n), actual(n);
+    divsufsortxx::constructSA(data, data + n, &expected[0], &expected[0] + n,
+                              256);
+    for (uint32_t num_threads = 1; num_threads <= 8; num_threads++) {
+      parallelsa::constructSA(data, n, &actual[0], num_threads);
+      ASSERT_EQ(expected, actual) << num_threads << " threads";
+    }
+  }
+}
+
+TEST(EliasGammaEncodedNPATest, PrefixSumTest) {
+  SuccinctAllocator s_allocator;
+
+  // Mostly small deltas, with occasional codes longer than 16 and 32 bits
+  std::vector<uint64_t> deltas;
+  for (uint64_t i = 0; i < 10000; i++) {
+    uint64_t h = i * 2654435761U;
+    if (i % 97 == 0) {
+      deltas.push_back((1ULL << (h % 32)) + h % 1000);
+    } else {
+      deltas.push_back(1 + (h >> 7) % (1 << (i % 12)));
+    }
+  }
+
+  std::vector<uint64_t> offsets;
+  uint64_t size = 0;
+  for (auto delta : deltas) {
+    offsets.push_back(size);
+    size += EliasGammaEncodedNPA::EliasGammaEncodingSize(delta);
+  }
+
+  SuccinctBase::Bitmap *B = new SuccinctBase::Bitmap;
+  SuccinctBase::InitBitmap(&B, size, s_allocator);
+  for (uint64_t i = 0; i < deltas.size(); i++) {
+    SuccinctBase::SetBitmapAtPos(
+        &B, offsets[i], deltas[i],
+        EliasGammaEncodedNPA::EliasGammaEncodingSize(deltas[i]));
+  }
+
+  for (uint64_t s = 0; s < deltas.size(); s += 37) {
+    uint64_t expected = 0;
+    for (uint64_t i = 0; s + i <= deltas.size() && i <= 128; i++) {
+      ASSERT_EQ(expected,
+                EliasGammaEncodedNPA::EliasGammaPrefixSum(B, offsets[s], i));
+      ASSERT_EQ(expected,
+                EliasGammaEncodedNPA::EliasGammaPrefixSumTable(B, offsets[s],
+                                                               i));
+      if (s + i < deltas.size())
+        expected += deltas[s + i];
+    }
+  }
+
+  SuccinctBase::DestroyBitmap(&B, s_allocator);
+}
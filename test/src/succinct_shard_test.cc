@@ -0,0 +1,420 @@
+#include "succinct_shard.h"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <sys/stat.h>
+#include <thread>
+
+extern std::string data_path;
+
+class SuccinctShardTest : public testing::Test {
+ protected:
+  virtual void SetUp() {
+    s_shard = new SuccinctShard(0, data_path + "/test_file");
+
+    std::ifstream input(data_path + "/test_file");
+    std::string line;
+    while (std::getline(input, line)) {
+      values.push_back(line);
+    }
+  }
+
+  virtual void TearDown() {
+    delete s_shard;
+  }
+
+  SuccinctShard *s_shard;
+  std::vector<std::string> values;
+};
+
+TEST_F(SuccinctShardTest, GetTest) {
+  for (int64_t i = 0; i < (int64_t) values.size(); i++) {
+    std::string result;
+    s_shard->Get(result, i);
+    ASSERT_EQ(values[i], result);
+  }
+}
+
+TEST_F(SuccinctShardTest, LoadTest) {
+  std::string path = "shard_test.succinct";
+  s_shard->Serialize(path);
+
+  SuccinctShard in_memory(0, path, SuccinctMode::LOAD_IN_MEMORY);
+  SuccinctShard memory_mapped(0, path, SuccinctMode::LOAD_MEMORY_MAPPED);
+  ASSERT_EQ(s_shard->GetNumKeys(), in_memory.GetNumKeys());
+  ASSERT_EQ(s_shard->GetNumKeys(), memory_mapped.GetNumKeys());
+
+  for (int64_t i = 0; i < (int64_t) values.size(); i++) {
+    std::string result;
+    in_memory.Get(result, i);
+    ASSERT_EQ(values[i], result);
+    memory_mapped.Get(result, i);
+    ASSERT_EQ(values[i], result);
+  }
+
+  std::vector<int64_t> expected, in_memory_result, memory_mapped_result;
+  s_shard->Search(expected, "int");
+  in_memory.Search(in_memory_result, "int");
+  memory_mapped.Search(memory_mapped_result, "int");
+  ASSERT_FALSE(expected.empty());
+  ASSERT_EQ(expected, in_memory_result);
+  ASSERT_EQ(expected, memory_mapped_result);
+}
+
+TEST_F(SuccinctShardTest, LoadSampleByValueTest) {
+  SuccinctShard by_value(0, data_path + "/test_file",
+                         SuccinctMode::CONSTRUCT_IN_MEMORY, 32, 32, 128,
+                         SamplingScheme::FLAT_SAMPLE_BY_VALUE,
+                         SamplingScheme::FLAT_SAMPLE_BY_VALUE);
+  std::string path = "shard_by_value_test.succinct";
+  by_value.Serialize(path);
+
+  // The sampled positions are loaded along with the sampled values
+  SuccinctShard in_memory(0, path, SuccinctMode::LOAD_IN_MEMORY, 32, 32, 128,
+                          SamplingScheme::FLAT_SAMPLE_BY_VALUE,
+                          SamplingScheme::FLAT_SAMPLE_BY_VALUE);
+  SuccinctShard memory_mapped(0, path, SuccinctMode::LOAD_MEMORY_MAPPED, 32,
+                              32, 128, SamplingScheme::FLAT_SAMPLE_BY_VALUE,
+                              SamplingScheme::FLAT_SAMPLE_BY_VALUE);
+  for (int64_t i = 0; i < (int64_t) values.size(); i++) {
+    std::string result;
+    in_memory.Get(result, i);
+    ASSERT_EQ(values[i], result);
+    memory_mapped.Get(result, i);
+    ASSERT_EQ(values[i], result);
+  }
+
+  std::vector<int64_t> expected, in_memory_result, memory_mapped_result;
+  s_shard->Search(expected, "int");
+  in_memory.Search(in_memory_result, "int");
+  memory_mapped.Search(memory_mapped_result, "int");
+  ASSERT_EQ(expected, in_memory_result);
+  ASSERT_EQ(expected, memory_mapped_result);
+}
+
+TEST_F(SuccinctShardTest, ContainerTest) {
+  std::string path = "shard_container_test.succinct";
+  s_shard->Serialize(path);
+
+  const char *names[] = { "metadata", "sa", "isa", "npa", "keyval" };
+  SuccinctContainer container(path);
+  ASSERT_EQ(SuccinctContainer::kVersion, container.GetVersion());
+  for (const char *name : names) {
+    ASSERT_TRUE(container.HasSection(name));
+    ASSERT_EQ(0U, (uintptr_t) container.MapSection(name)
+                  % SuccinctContainer::kAlignment);
+    ASSERT_TRUE(container.VerifySection(name));
+  }
+
+  // Split the container into the directory layout, and convert it back
+  std::string dir = "shard_container_test.dir";
+  mkdir(dir.c_str(), S_IRWXU);
+  for (const char *name : names) {
+    std::ofstream out(dir + "/" + name);
+    out.write((const char *) container.MapSection(name),
+              container.SectionSize(name));
+  }
+  std::string converted = "shard_container_test.converted";
+  ASSERT_TRUE(SuccinctContainer::ConvertDirectory(dir, converted));
+  SuccinctContainer converted_container(converted);
+  for (const char *name : names) {
+    ASSERT_EQ(container.SectionSize(name),
+              converted_container.SectionSize(name));
+    ASSERT_EQ(0, memcmp(container.MapSection(name),
+                        converted_container.MapSection(name),
+                        container.SectionSize(name)));
+  }
+
+  SuccinctShard from_dir(0, dir, SuccinctMode::LOAD_IN_MEMORY);
+  SuccinctShard from_converted(0, converted, SuccinctMode::LOAD_MEMORY_MAPPED);
+  for (int64_t i = 0; i < (int64_t) values.size(); i++) {
+    std::string result;
+    from_dir.Get(result, i);
+    ASSERT_EQ(values[i], result);
+    from_converted.Get(result, i);
+    ASSERT_EQ(values[i], result);
+  }
+}
+
+TEST_F(SuccinctShardTest, CorruptContainerTest) {
+  std::string path = "shard_corrupt_test.succinct";
+  s_shard->Serialize(path);
+  std::ifstream in(path, std::ios::binary);
+  std::string contents((std::istreambuf_iterator<char>(in)),
+                       std::istreambuf_iterator<char>());
+  in.close();
+
+  auto write = [](const std::string& file, const std::string& data) {
+    std::ofstream out(file, std::ios::binary | std::ios::trunc);
+    out.write(data.data(), data.size());
+  };
+  auto load = [](const std::string& file, SuccinctMode mode) {
+    return SuccinctShard(0, file, mode).IsLoaded();
+  };
+
+  // Flip a byte in the middle of the npa section; it is caught by the
+  // checksum when read into memory
+  SuccinctContainer::Header header;
+  memcpy(&header, contents.data(), sizeof(header));
+  const SuccinctContainer::SectionEntry *entries =
+      (const SuccinctContainer::SectionEntry *) (contents.data()
+          + sizeof(header));
+  std::string corrupt = contents;
+  for (uint32_t i = 0; i < header.num_sections; i++) {
+    if (std::string(entries[i].name) == "npa")
+      corrupt[entries[i].offset + entries[i].size / 2] ^= 1;
+  }
+  write(path, corrupt);
+  SuccinctContainer container(path);
+  SuccinctAllocator allocator;
+  ASSERT_TRUE(container.IsOpen());
+  ASSERT_FALSE(container.VerifySection("npa"));
+  ASSERT_TRUE(container.ReadSection("npa", allocator) == NULL);
+  ASSERT_FALSE(load(path, SuccinctMode::LOAD_IN_MEMORY));
+
+  // Missing sections
+  ASSERT_EQ(0U, container.SectionSize("missing"));
+  ASSERT_TRUE(container.MapSection("missing") == NULL);
+  ASSERT_FALSE(container.VerifySection("missing"));
+
+  // Another format version
+  std::string other_version = contents;
+  header.version = SuccinctContainer::kVersion + 1;
+  memcpy(&other_version[0], &header, sizeof(header));
+  write(path, other_version);
+  ASSERT_FALSE(SuccinctContainer(path).IsOpen());
+  ASSERT_FALSE(load(path, SuccinctMode::LOAD_MEMORY_MAPPED));
+
+  // Truncated file, with sections past its end
+  write(path, contents.substr(0, contents.size() / 2));
+  ASSERT_FALSE(SuccinctContainer(path).IsOpen());
+  ASSERT_FALSE(load(path, SuccinctMode::LOAD_IN_MEMORY));
+  ASSERT_FALSE(load(path, SuccinctMode::LOAD_MEMORY_MAPPED));
+
+  // Missing file, and a directory without a npa file
+  ASSERT_FALSE(load("shard_corrupt_test.missing", SuccinctMode::LOAD_IN_MEMORY));
+  std::string dir = "shard_corrupt_test.dir";
+  mkdir(dir.c_str(), S_IRWXU);
+  write(dir + "/metadata", contents.substr(entries[0].offset, entries[0].size));
+  ASSERT_FALSE(load(dir, SuccinctMode::LOAD_IN_MEMORY));
+  ASSERT_FALSE(load(dir, SuccinctMode::LOAD_MEMORY_MAPPED));
+  ASSERT_FALSE(SuccinctContainer::ConvertDirectory(
+      "shard_corrupt_test.missing", "shard_corrupt_test.converted"));
+}
+
+TEST_F(SuccinctShardTest, PageInTest) {
+  std::string path = "shard_page_in_test.succinct";
+  s_shard->Serialize(path);
+
+  PageInConfig config;
+  ASSERT_FALSE(PageInConfig::Parse("eager", &config));
+  ASSERT_FALSE(PageInConfig::Parse("lazy,npa", &config));
+  config.prefetch_rate = 16 * 1024 * 1024;
+  ASSERT_TRUE(PageInConfig::Parse("prefetch,keyval=lazy,sa=populate", &config));
+  ASSERT_EQ(PAGE_IN_PREFETCH, config.GetPolicy("npa"));
+  ASSERT_EQ(PAGE_IN_LAZY, config.GetPolicy("keyval"));
+  ASSERT_EQ(PAGE_IN_POPULATE, config.GetPolicy("sa"));
+  ASSERT_EQ(16U * 1024 * 1024, config.prefetch_rate);
+
+  // Queries are served while the remaining sections are prefetched
+  SuccinctShard shard(0, path, SuccinctMode::LOAD_MEMORY_MAPPED, 32, 32, 128,
+                      SamplingScheme::FLAT_SAMPLE_BY_INDEX,
+                      SamplingScheme::FLAT_SAMPLE_BY_INDEX,
+                      NPA::NPAEncodingScheme::ELIAS_GAMMA_ENCODED, 3, 1024, 1,
+                      config);
+  for (int64_t i = 0; i < (int64_t) values.size(); i++) {
+    std::string result;
+    shard.Get(result, i);
+    ASSERT_EQ(values[i], result);
+  }
+
+  SuccinctContainer container(path);
+  ASSERT_EQ(container.SectionSize("metadata") + container.SectionSize("isa")
+                + container.SectionSize("npa"),
+            shard.WaitForPrefetch());
+
+  // A warmer held back by its bandwidth stops without finishing its range
+  std::vector<uint8_t> range(2 * PageWarmer::kChunkSize);
+  auto start = std::chrono::steady_clock::now();
+  {
+    PageWarmer warmer(1024);
+    warmer.Add(&range[0], range.size());
+  }
+  ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+}
+
+TEST_F(SuccinctShardTest, NumaTest) {
+  std::string path = "shard_numa_test.succinct";
+  s_shard->Serialize(path);
+
+  int node = NumaUtils::NumNodes() - 1;
+  std::vector<int> cpus;
+  ASSERT_TRUE(NumaUtils::NodeCpus(node, &cpus));
+  ASSERT_FALSE(cpus.empty());
+  ASSERT_FALSE(NumaUtils::NodeCpus(NumaUtils::NumNodes(), &cpus));
+
+  PageInConfig config;
+  config.numa_node = node;
+
+  // Sections read into the heap are placed by the policy of the thread that
+  // loads them
+  SuccinctShard *in_memory = nullptr;
+  std::thread loader([&] {
+    NumaUtils::BindThread(node);
+    in_memory = new SuccinctShard(0, path, SuccinctMode::LOAD_IN_MEMORY, 32,
+                                  32, 128, SamplingScheme::FLAT_SAMPLE_BY_INDEX,
+                                  SamplingScheme::FLAT_SAMPLE_BY_INDEX,
+                                  NPA::NPAEncodingScheme::ELIAS_GAMMA_ENCODED,
+                                  3, 1024, 1, config);
+  });
+  loader.join();
+  SuccinctShard memory_mapped(0, path, SuccinctMode::LOAD_MEMORY_MAPPED, 32, 32,
+                              128, SamplingScheme::FLAT_SAMPLE_BY_INDEX,
+                              SamplingScheme::FLAT_SAMPLE_BY_INDEX,
+                              NPA::NPAEncodingScheme::ELIAS_GAMMA_ENCODED, 3,
+                              1024, 1, config);
+  for (int64_t i = 0; i < (int64_t) values.size(); i++) {
+    std::string result;
+    in_memory->Get(result, i);
+    ASSERT_EQ(values[i], result);
+    memory_mapped.Get(result, i);
+    ASSERT_EQ(values[i], result);
+  }
+
+  // Placement is only checked where the kernel reports it
+  for (const char *alphabet : { in_memory->GetAlphabet(),
+      memory_mapped.GetAlphabet() }) {
+    int alphabet_node = NumaUtils::NodeOf(alphabet);
+    if (alphabet_node >= 0)
+      ASSERT_EQ(node, alphabet_node);
+  }
+  delete in_memory;
+}
+
+TEST_F(SuccinctShardTest, CountTest) {
+  std::vector<std::string> queries = { "int", "the", "a", "return", "zzzq" };
+  for (size_t i = 0; i < values.size(); i += 53) {
+    if (values[i].length() >= 4)
+      queries.push_back(values[i].substr(values[i].length() / 2, 4));
+  }
+
+  // The start of the longest value is far from its end, so counting it falls
+  // back to looking up the SA
+  size_t longest = 0;
+  for (size_t i = 0; i < values.size(); i++) {
+    if (values[i].length() > values[longest].length())
+      longest = i;
+  }
+  size_t start = values[longest].find_first_not_of(' ');
+  queries.push_back(values[longest].substr(start, 24));
+
+  for (auto &query : queries) {
+    std::vector<int64_t> expected_keys;
+    for (int64_t i = 0; i < (int64_t) values.size(); i++) {
+      if (values[i].find(query) != std::string::npos)
+        expected_keys.push_back(i);
+    }
+    int64_t expected = expected_keys.size();
+
+    std::vector<int64_t> keys;
+    s_shard->Search(keys, query);
+    ASSERT_EQ(expected_keys, keys);
+    ASSERT_EQ(expected, s_shard->Count(query));
+    ASSERT_EQ(s_shard->FlatCount(query), s_shard->Count(query, true));
+    ASSERT_LE(expected, s_shard->Count(query, true));
+  }
+}
+
+TEST_F(SuccinctShardTest, SearchPageTest) {
+  std::vector<std::string> queries = { "int", "the", "a", "zzzq" };
+
+  // Walking from the start of the longest value to its end takes longer
+  // than looking up the SA, so its pages are found from the SA
+  size_t longest = 0;
+  for (size_t i = 0; i < values.size(); i++) {
+    if (values[i].length() > values[longest].length())
+      longest = i;
+  }
+  size_t start = values[longest].find_first_not_of(' ');
+  queries.push_back(values[longest].substr(start, 24));
+  for (auto &query : queries) {
+    std::vector<int64_t> expected;
+    s_shard->Search(expected, query);
+
+    // Pages partition the keys, and are sorted within
+    for (int64_t limit : { 1, 7, 100 }) {
+      std::vector<int64_t> all;
+      for (int64_t offset = 0; ; offset += limit) {
+        std::vector<int64_t> page;
+        s_shard->Search(page, query, offset, limit);
+        ASSERT_LE((int64_t) page.size(), limit);
+        ASSERT_TRUE(std::is_sorted(page.begin(), page.end()));
+        all.insert(all.end(), page.begin(), page.end());
+        if ((int64_t) page.size() < limit)
+          break;
+      }
+      std::sort(all.begin(), all.end());
+      ASSERT_EQ(expected, all);
+    }
+
+    std::vector<int64_t> rest;
+    s_shard->Search(rest, query, 3, -1);
+    ASSERT_EQ(std::max<int64_t>((int64_t) expected.size() - 3, 0),
+              (int64_t) rest.size());
+  }
+}
+
+// Shard whose invalid bitmap can be set, as by an external writer of the
+// serialized format
+class InvalidatedShard : public SuccinctShard {
+ public:
+  explicit InvalidatedShard(const std::string &datafile)
+      : SuccinctShard(0, datafile) {
+  }
+
+  void Invalidate(int64_t key) {
+    SETBITVAL(invalid_offsets_, GetValueOffsetPos(key));
+  }
+};
+
+TEST_F(SuccinctShardTest, InvalidValuesTest) {
+  std::string query = "int";
+  std::vector<int64_t> expected;
+  s_shard->Search(expected, query);
+  ASSERT_GE(expected.size(), 3U);
+
+  InvalidatedShard invalidated(data_path + "/test_file");
+  int64_t invalid_key = expected[1];
+  invalidated.Invalidate(invalid_key);
+  std::string path = "shard_invalid_test.succinct";
+  invalidated.Serialize(path);
+  expected.erase(expected.begin() + 1);
+
+  // Get, Search, paged Search and Count skip the invalid value
+  SuccinctShard in_memory(0, path, SuccinctMode::LOAD_IN_MEMORY);
+  SuccinctShard memory_mapped(0, path, SuccinctMode::LOAD_MEMORY_MAPPED);
+  for (SuccinctShard *shard : { &in_memory, &memory_mapped }) {
+    std::string result;
+    shard->Get(result, invalid_key);
+    ASSERT_EQ("", result);
+    shard->Get(result, expected[0]);
+    ASSERT_EQ(values[expected[0]], result);
+    std::vector<int64_t> keys;
+    shard->Search(keys, query);
+    ASSERT_EQ(expected, keys);
+    ASSERT_EQ((int64_t) expected.size(), shard->Count(query));
+    std::vector<int64_t> all;
+    for (int64_t offset = 0; ; offset += 2) {
+      std::vector<int64_t> page;
+      shard->Search(page, query, offset, 2);
+      all.insert(all.end(), page.begin(), page.end());
+      if (page.size() < 2)
+        break;
+    }
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(expected, all);
+  }
+}